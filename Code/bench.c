@@ -0,0 +1,650 @@
+/**
+ * ========================================================================
+ * BENCHMARK KERNEL PELURUHAN DAN TATA LETAK HASIL SIMULASI
+ * ========================================================================
+ *
+ * Mode default adalah harness skala: untuk jumlah step 10^2..10^9 (per
+ * dekade) setiap tahap diukur terpisah, yaitu kernel integrasi, pengisian
+ * kolom analitik/error, reduksi error, ekspor CSV, ekspor biner, dan pipeline
+ * streaming end-to-end. Setiap tahap dilaporkan sebagai mean, simpangan baku,
+ * dan waktu terbaik atas beberapa sampel, dalam ns/step, step/detik, dan
+ * GB/s, lalu ditulis ke file JSON.
+ *
+ * Dengan argumen posisional, program ini mengukur perbedaan bandwidth antara tata letak array-of-structs
+ * (SimulationStep, kolom berjarak 40 byte) dan structure-of-arrays (kolom
+ * kontigu) untuk jumlah baris besar (default 10^7):
+ *
+ * 1. Kernel Euler lengkap (loop sekuensial + pengisian kolom analitik/error)
+ * 2. Pengisian kolom analitik/error saja (kernel exp tervektorisasi)
+ * 3. Pemindaian satu kolom (seperti ekspor satu field atau pencarian error akhir)
+ *
+ * Setelah itu ekspor CSV diukur: fprintf per baris (cara lama) dibandingkan
+ * dengan CsvWriter (formatter sendiri + satu write per blok), dalam baris/detik.
+ *
+ * Bagian terakhir membandingkan mode presisi loop Euler (lihat simulation.h):
+ * biaya per step dan lantai error pembulatan, yaitu error relatif N akhir
+ * terhadap rekurensi eksak dan drift waktu akhir terhadap t_initial + i Δt.
+ *
+ * Penggunaan: ./bench [OPSI]  atau  ./bench jumlah_baris [repetisi]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "simulation.h"
+#include "output.h"
+#include "stats.h"
+#include "vexp.h"
+
+/**
+ * PEMINDAIAN SATU KOLOM
+ * =====================
+ * Menjumlahkan satu kolom lewat pointer kolom dan stride kontainer; untuk AoS
+ * setiap elemen menarik satu struct 40 byte, untuk SoA hanya 8 byte.
+ */
+static double scan_column(const double* column, size_t stride, int num_rows) {
+    double sum = 0.0;
+    for (int i = 0; i < num_rows; i++) {
+        sum += column[(size_t)i * stride];
+    }
+    return sum;
+}
+
+// File sementara untuk benchmark ekspor (dihapus setelah selesai)
+#define BENCH_CSV_FILENAME "bench_csv.tmp"
+#define BENCH_BINARY_FILENAME "bench_bin.tmp"
+
+/**
+ * EKSPOR CSV DENGAN fprintf PER BARIS (PEMBANDING)
+ * ================================================
+ * Sama dengan loop ekspor lama di main: lima konversi %e/%f per baris.
+ */
+static int csv_export_fprintf(const SimulationResults* results) {
+    FILE* fp = fopen(BENCH_CSV_FILENAME, "w");
+    if (fp == NULL) return 0;
+    fprintf(fp, "Time_s,N_Numerical,N_Analytical,Error_Absolute,Error_Relative_Percent\n");
+    for (int i = 0; i < results->num_rows; i++) {
+        SimulationStep row = results_row(results, i);
+        fprintf(fp, "%.4f,%.6e,%.6e,%.6e,%.6f\n",
+                row.time_s, row.N_numerical, row.N_analytical,
+                row.error_absolute, row.error_relative_percent);
+    }
+    return fclose(fp) == 0;
+}
+
+/**
+ * EKSPOR CSV DENGAN CsvWriter
+ */
+static int csv_export_writer(const SimulationResults* results) {
+    CsvWriter writer;
+    if (!csv_writer_open(&writer, BENCH_CSV_FILENAME)) return 0;
+    int ok = csv_writer_write_header(&writer) && csv_writer_write_rows(&writer, results);
+    return csv_writer_close(&writer) && ok;
+}
+
+/**
+ * PERBANDINGAN TATA LETAK, EKSPOR CSV, DAN MODE PRESISI
+ * =====================================================
+ *
+ * @param num_rows     - Jumlah baris hasil
+ * @param repetitions  - Jumlah repetisi (waktu terbaik yang dilaporkan)
+ * @return int - 0 jika berhasil, 1 jika ekspor gagal
+ */
+static int run_layout_comparison(int num_rows, int repetitions) {
+
+    // PARAMETER RADON-222 (SAMA DENGAN main.c)
+    // ========================================
+    double N0 = 1.0e15;
+    double T_half_seconds = 3.8235 * 24.0 * 60.0 * 60.0;
+    double lambda = log(2.0) / T_half_seconds;
+    double t_end = 4.0 * T_half_seconds;
+    double delta_t = t_end / (double)(num_rows - 1);
+
+    double column_bytes = (double)num_rows * sizeof(double);
+    double row_bytes = (double)num_rows * sizeof(SimulationStep);
+
+    printf("Benchmark tata letak hasil: %d baris, %d repetisi (waktu terbaik)\n", num_rows, repetitions);
+    printf("-----------------------------------------------------------------------------\n");
+    printf("| Layout | Tahap                  | Waktu (ms) | ns/baris | GB/s efektif    |\n");
+    printf("|--------|------------------------|------------|----------|-----------------|\n");
+
+    double checksum = 0.0;
+    ResultLayout layouts[] = { RESULT_LAYOUT_AOS, RESULT_LAYOUT_SOA };
+    for (int l = 0; l < 2; l++) {
+        double best_kernel = 1e30, best_fill = 1e30, best_scan = 1e30;
+
+        for (int rep = 0; rep < repetitions; rep++) {
+            SimulationResults results = results_empty(layouts[l]);
+
+            double t0 = stats_now();
+            euler_radioactive_decay(N0, lambda, 0.0, t_end, delta_t, &results, EULER_MODE_SEQUENTIAL);
+            double t1 = stats_now();
+            fill_analytic_columns(N0, lambda, &results, 0, results.num_rows);
+            double t2 = stats_now();
+            checksum += scan_column(results.error_absolute, results.stride, results.num_rows);
+            double t3 = stats_now();
+
+            if (t1 - t0 < best_kernel) best_kernel = t1 - t0;
+            if (t2 - t1 < best_fill) best_fill = t2 - t1;
+            if (t3 - t2 < best_scan) best_scan = t3 - t2;
+
+            results_free(&results);
+        }
+
+        // Byte berguna: kernel menulis 5 kolom; pengisian analitik membaca 2 dan
+        // menulis 3 kolom; pemindaian membaca 1 kolom
+        const char* name = results_layout_name(layouts[l]);
+        printf("| %-6s | %-22s | %10.2f | %8.3f | %15.2f |\n", name, "kernel Euler lengkap",
+               best_kernel * 1e3, best_kernel * 1e9 / num_rows, row_bytes / best_kernel / 1e9);
+        printf("| %-6s | %-22s | %10.2f | %8.3f | %15.2f |\n", name, "isi kolom analitik",
+               best_fill * 1e3, best_fill * 1e9 / num_rows, row_bytes / best_fill / 1e9);
+        printf("| %-6s | %-22s | %10.2f | %8.3f | %15.2f |\n", name, "pindai satu kolom",
+               best_scan * 1e3, best_scan * 1e9 / num_rows, column_bytes / best_scan / 1e9);
+    }
+
+    printf("-----------------------------------------------------------------------------\n");
+
+    // BENCHMARK EKSPOR CSV
+    // ====================
+    SimulationResults results = results_empty(RESULT_LAYOUT_AOS);
+    euler_radioactive_decay(N0, lambda, 0.0, t_end, delta_t, &results, EULER_MODE_SEQUENTIAL);
+
+    printf("\nBenchmark ekspor CSV: %d baris, %d repetisi (waktu terbaik)\n", results.num_rows, repetitions);
+    printf("-----------------------------------------------------------------------------\n");
+    printf("| Metode                   | Waktu (ms) | ns/baris | Juta baris/detik       |\n");
+    printf("|--------------------------|------------|----------|------------------------|\n");
+
+    const char* method_names[] = { "fprintf per baris", "CsvWriter (blok 1 MiB)" };
+    int (*exporters[])(const SimulationResults*) = { csv_export_fprintf, csv_export_writer };
+    for (int m = 0; m < 2; m++) {
+        double best = 1e30;
+        for (int rep = 0; rep < repetitions; rep++) {
+            double t0 = stats_now();
+            if (!exporters[m](&results)) {
+                printf("Error: Gagal menulis file %s.\n", BENCH_CSV_FILENAME);
+                results_free(&results);
+                remove(BENCH_CSV_FILENAME);
+                return 1;
+            }
+            double t1 = stats_now();
+            if (t1 - t0 < best) best = t1 - t0;
+        }
+        printf("| %-24s | %10.2f | %8.1f | %22.2f |\n", method_names[m],
+               best * 1e3, best * 1e9 / results.num_rows, results.num_rows / best / 1e6);
+    }
+    printf("-----------------------------------------------------------------------------\n");
+
+    results_free(&results);
+    remove(BENCH_CSV_FILENAME);
+
+    // BENCHMARK MODE PRESISI
+    // ======================
+    // Waktu decay_simulate lengkap; pengisian kolom analitik sama untuk semua
+    // mode, sehingga selisih antar baris adalah selisih biaya loop
+    int num_steps = num_rows - 1;
+    double exact = euler_recurrence_exact(N0, lambda, delta_t, num_steps);
+    printf("\nBenchmark mode presisi Euler: %d step (lambda*delta_t = %.3e), %d repetisi (waktu terbaik)\n",
+           num_steps, lambda * delta_t, repetitions);
+    printf("-----------------------------------------------------------------------------\n");
+    printf("| Mode           | Waktu (ms) | ns/step  | Error Relatif N Akhir | Drift t (s) |\n");
+    printf("|----------------|------------|----------|-----------------------|-------------|\n");
+    for (int m = 0; m < EULER_MODE_COUNT; m++) {
+        EulerEvaluationMode mode = (EulerEvaluationMode)m;
+        if (mode == EULER_MODE_DIRECT) continue;
+        double best = 1e30, error = 0.0, drift = 0.0;
+        for (int rep = 0; rep < repetitions; rep++) {
+            SimulationResults precision_results = results_empty(RESULT_LAYOUT_SOA);
+            double t0 = stats_now();
+            decay_simulate(N0, lambda, 0.0, t_end, delta_t, INTEGRATOR_EULER, mode, &precision_results);
+            double t1 = stats_now();
+            if (t1 - t0 < best) best = t1 - t0;
+            if (precision_results.num_rows == num_rows) {
+                error = fabs(precision_results.N_numerical[num_steps] - exact) / exact;
+                // t_akhir - num_steps * Δt dengan satu pembulatan
+                drift = fabs(fma(-(double)num_steps, delta_t, precision_results.time_s[num_steps]));
+                checksum += precision_results.N_numerical[num_steps];
+            }
+            results_free(&precision_results);
+        }
+        printf("| %-14s | %10.2f | %8.3f | %21.3e | %11.3e |\n", evaluation_mode_name(mode),
+               best * 1e3, best * 1e9 / num_steps, error, drift);
+    }
+    printf("-----------------------------------------------------------------------------\n");
+
+    printf("checksum = %.6e\n", checksum);
+    return 0;
+}
+
+/**
+ * ========================================================================
+ * HARNESS SKALA: WAKTU PER TAHAP UNTUK 10^2..10^9 STEP
+ * ========================================================================
+ */
+
+// Batas atas jumlah step (jumlah baris harus muat di int)
+#define BENCH_MAX_STEPS 1000000000LL
+
+// Jumlah step minimum per sampel waktu: ukuran kecil dipanggil berulang
+// dalam satu sampel agar resolusi timer dan overhead tidak mendominasi
+#define BENCH_MIN_SAMPLE_STEPS 1000000
+
+// Jumlah hasil maksimum (8 dekade x 6 tahap)
+#define BENCH_MAX_RESULTS 64
+
+typedef enum {
+    BENCH_STAGE_KERNEL = 0,           // decay_integrate (alokasi + loop step)
+    BENCH_STAGE_ANALYTIC,             // fill_analytic_columns
+    BENCH_STAGE_REDUCE,               // error_reducer_consume atas kontainer penuh
+    BENCH_STAGE_CSV,                  // CsvWriter
+    BENCH_STAGE_BINARY,               // BinaryWriter
+    BENCH_STAGE_STREAM,               // decay_simulate_stream + ErrorReducer
+    BENCH_STAGE_COUNT
+} BenchStage;
+
+static const char* const BENCH_STAGE_NAMES[BENCH_STAGE_COUNT] = {
+    "kernel", "analytic", "error-reduce", "export-csv", "export-binary", "stream"
+};
+
+typedef struct {
+    IntegratorMethod method;
+    EulerEvaluationMode mode;
+    ResultLayout layout;
+    double N0;
+    double lambda;
+    double t_end;
+    long long min_steps;
+    long long max_steps;
+    int repetitions;
+    double memory_bytes;              // Batas kontainer penuh
+    long long export_max_steps;       // Batas tahap ekspor
+    const char* json_filename;
+} BenchConfig;
+
+/**
+ * STATISTIK SATU TAHAP PADA SATU UKURAN
+ *
+ * Waktu per pemanggilan; simpangan baku antar sampel (pembagi n - 1).
+ * bytes = 0 jika lalu lintas memori tidak dimodelkan (tahap streaming:
+ * chunk tetap di cache).
+ */
+typedef struct {
+    BenchStage stage;
+    long long steps;
+    int samples;
+    int calls_per_sample;
+    double mean_s;
+    double stddev_s;
+    double min_s;
+    double bytes;
+} BenchResult;
+
+/**
+ * SATU PEMANGGILAN TAHAP
+ * ======================
+ *
+ * @param full   - Kontainer hasil lengkap (tahap analitik/reduksi/ekspor)
+ * @param bytes  - Keluaran: byte yang dibaca/ditulis pemanggilan ini
+ * @return int - 1 jika berhasil, 0 jika gagal
+ */
+static int bench_stage_call(const BenchConfig* config, BenchStage stage, int steps,
+                            SimulationResults* full, double* bytes) {
+    double delta_t = config->t_end / steps;
+    double rows = (double)steps + 1.0;
+    // Byte per baris satu kolom dan satu baris penuh
+    double column = sizeof(double);
+    double row = sizeof(SimulationStep);
+
+    switch (stage) {
+    case BENCH_STAGE_KERNEL: {
+        SimulationResults results = results_empty(config->layout);
+        int n = decay_integrate(config->N0, config->lambda, 0.0, config->t_end, delta_t,
+                                config->method, config->mode, &results);
+        results_free(&results);
+        // Menulis kolom waktu dan N (AoS: seluruh struct ikut ditarik)
+        *bytes = rows * ((config->layout == RESULT_LAYOUT_SOA) ? 2.0 * column : row);
+        return n == steps;
+    }
+    case BENCH_STAGE_ANALYTIC:
+        fill_analytic_columns(config->N0, config->lambda, full, 0, full->num_rows);
+        // Membaca 2 kolom, menulis 3 kolom
+        *bytes = rows * row;
+        return 1;
+    case BENCH_STAGE_REDUCE: {
+        ErrorReducer reducer;
+        error_reducer_init(&reducer);
+        int ok = error_reducer_consume(&reducer, full, 0);
+        // Membaca 2 kolom error
+        *bytes = rows * ((config->layout == RESULT_LAYOUT_SOA) ? 2.0 * column : row);
+        return ok && reducer.num_rows == full->num_rows;
+    }
+    case BENCH_STAGE_CSV: {
+        CsvWriter writer;
+        if (!csv_writer_open(&writer, BENCH_CSV_FILENAME)) return 0;
+        int ok = csv_writer_write_header(&writer) && csv_writer_write_rows(&writer, full);
+        ok = csv_writer_close(&writer) && ok;
+        *bytes = (double)writer.bytes_written;
+        return ok;
+    }
+    case BENCH_STAGE_BINARY: {
+        char label[64];
+        simulation_method_label(config->method, config->mode, label, sizeof(label));
+        OutputMetadata metadata = { config->N0, config->lambda, 0.0, delta_t, label };
+        BinaryWriter writer;
+        if (!binary_writer_open(&writer, BENCH_BINARY_FILENAME, &metadata, full->num_rows)) return 0;
+        *bytes = (double)writer.header_bytes + rows * row;
+        int ok = binary_writer_write_rows(&writer, full, 0);
+        return binary_writer_close(&writer) && ok;
+    }
+    case BENCH_STAGE_STREAM: {
+        ErrorReducer reducer;
+        error_reducer_init(&reducer);
+        ResultSink sink = { error_reducer_consume, &reducer };
+        int n = decay_simulate_stream(config->N0, config->lambda, 0.0, config->t_end, delta_t,
+                                      config->method, config->mode, config->layout, &sink, 1);
+        *bytes = 0.0;
+        return n == steps && reducer.num_rows == steps + 1;
+    }
+    default:
+        return 0;
+    }
+}
+
+/**
+ * MENGUKUR SATU TAHAP
+ * ===================
+ *
+ * Satu pemanggilan pemanasan (tidak diukur), lalu config->repetitions sampel.
+ * Untuk ukuran kecil setiap sampel berisi beberapa pemanggilan hingga minimal
+ * BENCH_MIN_SAMPLE_STEPS step. Mean dan varians dengan algoritma Welford.
+ *
+ * @return int - 1 jika berhasil, 0 jika salah satu pemanggilan gagal
+ */
+static int bench_measure(const BenchConfig* config, BenchStage stage, int steps,
+                         SimulationResults* full, BenchResult* result) {
+    int calls = (steps >= BENCH_MIN_SAMPLE_STEPS) ? 1 : BENCH_MIN_SAMPLE_STEPS / steps;
+    *result = (BenchResult){ stage, steps, 0, calls, 0.0, 0.0, 1e30, 0.0 };
+
+    if (!bench_stage_call(config, stage, steps, full, &result->bytes)) return 0;
+
+    double m2 = 0.0;
+    for (int rep = 0; rep < config->repetitions; rep++) {
+        double t0 = stats_now();
+        for (int c = 0; c < calls; c++) {
+            if (!bench_stage_call(config, stage, steps, full, &result->bytes)) return 0;
+        }
+        double elapsed = (stats_now() - t0) / calls;
+
+        result->samples++;
+        double delta = elapsed - result->mean_s;
+        result->mean_s += delta / result->samples;
+        m2 += delta * (elapsed - result->mean_s);
+        if (elapsed < result->min_s) result->min_s = elapsed;
+    }
+    result->stddev_s = (result->samples > 1) ? sqrt(m2 / (result->samples - 1)) : 0.0;
+    return 1;
+}
+
+static void bench_print_result(const BenchResult* r) {
+    double ns_per_step = r->mean_s * 1e9 / r->steps;
+    double cv = (r->mean_s > 0.0) ? r->stddev_s / r->mean_s * 100.0 : 0.0;
+    printf("| %-13s | %10lld | %11.4f | %6.2f | %11.4f | %8.3f | %11.2f |",
+           BENCH_STAGE_NAMES[r->stage], r->steps, r->mean_s * 1e3, cv, r->min_s * 1e3,
+           ns_per_step, r->steps / r->mean_s / 1e6);
+    if (r->bytes > 0.0) {
+        printf(" %7.2f |\n", r->bytes / r->mean_s / 1e9);
+    } else {
+        printf(" %7s |\n", "-");
+    }
+}
+
+/**
+ * Menulis string JSON (nama tahap, metode, versi kompiler) dengan escape
+ * untuk tanda kutip, backslash, dan karakter kontrol.
+ */
+static void json_write_string(FILE* fp, const char* s) {
+    fputc('"', fp);
+    for (; *s != '\0'; s++) {
+        unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\') {
+            fprintf(fp, "\\%c", c);
+        } else if (c < 0x20) {
+            fprintf(fp, "\\u%04x", c);
+        } else {
+            fputc(c, fp);
+        }
+    }
+    fputc('"', fp);
+}
+
+/**
+ * EKSPOR HASIL HARNESS KE JSON
+ * ============================
+ *
+ * Satu objek per (tahap, ukuran); gb_per_s bernilai null jika lalu lintas
+ * memori tahap tersebut tidak dimodelkan.
+ *
+ * @return int - 1 jika berhasil, 0 jika file gagal ditulis
+ */
+static int bench_write_json(const BenchConfig* config, const BenchResult* results, int num_results) {
+    FILE* fp = fopen(config->json_filename, "w");
+    if (fp == NULL) return 0;
+
+#ifdef __VERSION__
+    const char* compiler = __VERSION__;
+#else
+    const char* compiler = "unknown";
+#endif
+
+    fprintf(fp, "{\n  \"benchmark\": \"decay-kernels\",\n  \"method\": ");
+    json_write_string(fp, integrator_info(config->method)->name);
+    fprintf(fp, ",\n  \"precision\": ");
+    json_write_string(fp, evaluation_mode_name(config->mode));
+    fprintf(fp, ",\n  \"layout\": ");
+    json_write_string(fp, results_layout_name(config->layout));
+    fprintf(fp, ",\n  \"vexp_isa\": ");
+    json_write_string(fp, vexp_isa_name(vexp_active_isa()));
+    fprintf(fp, ",\n  \"compiler\": ");
+    json_write_string(fp, compiler);
+    fprintf(fp, ",\n  \"repetitions\": %d,\n  \"results\": [\n", config->repetitions);
+
+    for (int i = 0; i < num_results; i++) {
+        const BenchResult* r = &results[i];
+        fprintf(fp, "    {\"stage\": ");
+        json_write_string(fp, BENCH_STAGE_NAMES[r->stage]);
+        fprintf(fp, ", \"steps\": %lld, \"samples\": %d, \"calls_per_sample\": %d, "
+                    "\"mean_s\": %.9e, \"stddev_s\": %.9e, \"min_s\": %.9e, "
+                    "\"ns_per_step\": %.6g, \"steps_per_second\": %.6g, \"bytes\": %.0f, ",
+                r->steps, r->samples, r->calls_per_sample, r->mean_s, r->stddev_s, r->min_s,
+                r->mean_s * 1e9 / r->steps, r->steps / r->mean_s, r->bytes);
+        if (r->bytes > 0.0) {
+            fprintf(fp, "\"gb_per_s\": %.6g}", r->bytes / r->mean_s / 1e9);
+        } else {
+            fprintf(fp, "\"gb_per_s\": null}");
+        }
+        fprintf(fp, "%s\n", (i + 1 < num_results) ? "," : "");
+    }
+    fprintf(fp, "  ]\n}\n");
+    return fclose(fp) == 0;
+}
+
+/**
+ * MENJALANKAN HARNESS
+ * ===================
+ *
+ * Untuk setiap dekade jumlah step: kernel diukur dengan alokasinya sendiri,
+ * lalu satu kontainer penuh dibuat (di luar pengukuran) untuk tahap analitik,
+ * reduksi error, dan ekspor. Tahap kontainer penuh dilewati jika kontainer
+ * melebihi batas memori; tahap streaming berjalan untuk semua ukuran dengan
+ * memori konstan (STREAM_CHUNK_ROWS baris).
+ *
+ * @return int - 0 jika berhasil, 1 jika ada tahap atau ekspor JSON yang gagal
+ */
+static int run_scaling_harness(const BenchConfig* config) {
+    BenchResult results[BENCH_MAX_RESULTS];
+    int num_results = 0;
+    int status = 0;
+
+    printf("Harness kernel peluruhan: metode %s, presisi %s, layout %s, ISA vexp %s\n",
+           integrator_info(config->method)->name, evaluation_mode_name(config->mode),
+           results_layout_name(config->layout), vexp_isa_name(vexp_active_isa()));
+    printf("%d sampel per tahap (mean, koefisien variasi, waktu terbaik); batas kontainer %.0f MiB\n",
+           config->repetitions, config->memory_bytes / (1024.0 * 1024.0));
+    printf("-----------------------------------------------------------------------------------------------------\n");
+    printf("| Tahap         | Step       | Mean (ms)   | CV (%%) | Min (ms)    | ns/step  | Juta step/s | GB/s    |\n");
+    printf("|---------------|------------|-------------|--------|-------------|----------|-------------|---------|\n");
+
+    for (long long steps = config->min_steps; steps <= config->max_steps; steps *= 10) {
+        int n = (int)steps;
+        double full_bytes = ((double)steps + 1.0) * sizeof(SimulationStep);
+        int fits = full_bytes <= config->memory_bytes;
+
+        BenchStage stages[BENCH_STAGE_COUNT];
+        int num_stages = 0;
+        if (fits) {
+            stages[num_stages++] = BENCH_STAGE_KERNEL;
+            stages[num_stages++] = BENCH_STAGE_ANALYTIC;
+            stages[num_stages++] = BENCH_STAGE_REDUCE;
+            if (steps <= config->export_max_steps) {
+                stages[num_stages++] = BENCH_STAGE_CSV;
+                stages[num_stages++] = BENCH_STAGE_BINARY;
+            }
+        }
+        stages[num_stages++] = BENCH_STAGE_STREAM;
+
+        SimulationResults full = results_empty(config->layout);
+        if (fits) {
+            decay_simulate(config->N0, config->lambda, 0.0, config->t_end, config->t_end / n,
+                           config->method, config->mode, &full);
+            if (full.num_rows != n + 1) {
+                printf("Error: Gagal mengalokasikan kontainer %d baris.\n", n + 1);
+                results_free(&full);
+                status = 1;
+                continue;
+            }
+        }
+
+        for (int s = 0; s < num_stages && num_results < BENCH_MAX_RESULTS; s++) {
+            BenchResult* r = &results[num_results];
+            if (!bench_measure(config, stages[s], n, &full, r)) {
+                printf("Error: Tahap %s gagal untuk %lld step.\n", BENCH_STAGE_NAMES[stages[s]], steps);
+                status = 1;
+                continue;
+            }
+            bench_print_result(r);
+            num_results++;
+        }
+        results_free(&full);
+        fflush(stdout);
+    }
+    printf("-----------------------------------------------------------------------------------------------------\n");
+    remove(BENCH_CSV_FILENAME);
+    remove(BENCH_BINARY_FILENAME);
+
+    if (config->json_filename != NULL) {
+        if (bench_write_json(config, results, num_results)) {
+            printf("Hasil JSON: %s\n", config->json_filename);
+        } else {
+            printf("Error: Gagal menulis file %s.\n", config->json_filename);
+            status = 1;
+        }
+    }
+    return status;
+}
+
+static void print_usage(const char* program) {
+    printf("Penggunaan:\n");
+    printf("  %s [OPSI]                     Harness skala per tahap (default)\n", program);
+    printf("  %s BARIS [REPETISI]           Perbandingan layout, ekspor CSV, mode presisi\n", program);
+    printf("\nOpsi harness:\n");
+    printf("  --steps MIN:MAX        Rentang step, per dekade (default 100:1000000000)\n");
+    printf("  --reps R               Sampel per tahap (default 5)\n");
+    printf("  --method NAMA          Metode integrasi (default euler)\n");
+    printf("  --precision PRESISI    Mode presisi loop (default double)\n");
+    printf("  --layout aos|soa       Tata letak kontainer (default soa)\n");
+    printf("  --memory-mib M         Batas kontainer penuh (default 1024)\n");
+    printf("  --export-max N         Step maksimum untuk tahap ekspor (default 1000000)\n");
+    printf("  --json FILE            File hasil JSON (default bench_results.json, \"-\" = tidak ada)\n");
+}
+
+int main(int argc, char** argv) {
+    // Argumen posisional: mode perbandingan lama
+    if (argc > 1 && argv[1][0] >= '0' && argv[1][0] <= '9') {
+        int num_rows = atoi(argv[1]);
+        int repetitions = (argc > 2) ? atoi(argv[2]) : 5;
+        if (num_rows < 2 || repetitions < 1) {
+            printf("Penggunaan: %s [jumlah_baris >= 2] [repetisi >= 1]\n", argv[0]);
+            return 1;
+        }
+        return run_layout_comparison(num_rows, repetitions);
+    }
+
+    // PARAMETER RADON-222 (SAMA DENGAN main.c)
+    // ========================================
+    double T_half_seconds = 3.8235 * 24.0 * 60.0 * 60.0;
+    BenchConfig config = {
+        INTEGRATOR_EULER, EULER_MODE_SEQUENTIAL, RESULT_LAYOUT_SOA,
+        1.0e15, log(2.0) / T_half_seconds, 4.0 * T_half_seconds,
+        100, BENCH_MAX_STEPS, 5, 1024.0 * 1024.0 * 1024.0, 1000000, "bench_results.json"
+    };
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* value = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (strcmp(arg, "--help") == 0 || strcmp(arg, "-h") == 0) {
+            print_usage(argv[0]);
+            return 0;
+        }
+        if (value == NULL) {
+            printf("Error: Opsi %s tidak dikenal atau tanpa nilai.\n", arg);
+            print_usage(argv[0]);
+            return 1;
+        }
+        i++;
+        if (strcmp(arg, "--steps") == 0) {
+            if (sscanf(value, "%lld:%lld", &config.min_steps, &config.max_steps) != 2) {
+                printf("Error: Format --steps adalah MIN:MAX.\n");
+                return 1;
+            }
+        } else if (strcmp(arg, "--reps") == 0) {
+            config.repetitions = atoi(value);
+        } else if (strcmp(arg, "--method") == 0) {
+            if (!integrator_from_name(value, &config.method)) {
+                printf("Error: Metode '%s' tidak dikenal.\n", value);
+                return 1;
+            }
+        } else if (strcmp(arg, "--precision") == 0) {
+            if (!evaluation_mode_from_name(value, &config.mode) || config.mode == EULER_MODE_DIRECT) {
+                printf("Error: Mode presisi '%s' tidak dikenal.\n", value);
+                return 1;
+            }
+        } else if (strcmp(arg, "--layout") == 0) {
+            if (strcmp(value, "aos") == 0) {
+                config.layout = RESULT_LAYOUT_AOS;
+            } else if (strcmp(value, "soa") == 0) {
+                config.layout = RESULT_LAYOUT_SOA;
+            } else {
+                printf("Error: Layout harus aos atau soa.\n");
+                return 1;
+            }
+        } else if (strcmp(arg, "--memory-mib") == 0) {
+            config.memory_bytes = atof(value) * 1024.0 * 1024.0;
+        } else if (strcmp(arg, "--export-max") == 0) {
+            config.export_max_steps = atoll(value);
+        } else if (strcmp(arg, "--json") == 0) {
+            config.json_filename = (strcmp(value, "-") == 0) ? NULL : value;
+        } else {
+            printf("Error: Opsi %s tidak dikenal.\n", arg);
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (config.min_steps < 1 || config.max_steps < config.min_steps || config.max_steps > BENCH_MAX_STEPS ||
+        config.repetitions < 1) {
+        printf("Error: Butuh 1 <= MIN <= MAX <= %lld dan repetisi >= 1.\n", BENCH_MAX_STEPS);
+        return 1;
+    }
+    return run_scaling_harness(&config);
+}
@@ -0,0 +1,414 @@
+/**
+ * ========================================================================
+ * IMPLEMENTASI RANTAI PELURUHAN (BATEMAN)
+ * ========================================================================
+ *
+ * Lihat chain.h untuk persamaan, metode step, dan solusi analitik.
+ */
+
+#include "chain.h"
+
+#include <complex.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+// Satu tahun Julian dalam detik (waktu paruh Pb-210)
+#define SECONDS_PER_YEAR (365.25 * 24.0 * 3600.0)
+
+/**
+ * DEFINISI RANTAI
+ * ===============
+ */
+static void set_species(ChainSpecies* species, const char* name, double half_life_s,
+                        double branching, double N0) {
+    snprintf(species->name, sizeof(species->name), "%s", name);
+    species->half_life_s = half_life_s;
+    species->lambda = log(2.0) / half_life_s;
+    species->branching = branching;
+    species->N0 = N0;
+}
+
+void chain_radon222(DecayChain* chain, double N0, double radon_half_life_s) {
+    chain->num_species = 6;
+    set_species(&chain->species[0], "Rn-222", radon_half_life_s,     1.0,     N0);
+    set_species(&chain->species[1], "Po-218", 3.098 * 60.0,          0.9998,  0.0);
+    set_species(&chain->species[2], "Pb-214", 26.8 * 60.0,           1.0,     0.0);
+    set_species(&chain->species[3], "Bi-214", 19.9 * 60.0,           0.99979, 0.0);
+    set_species(&chain->species[4], "Po-214", 164.3e-6,              1.0,     0.0);
+    set_species(&chain->species[5], "Pb-210", 22.2 * SECONDS_PER_YEAR, 1.0,   0.0);
+}
+
+int chain_validate(const DecayChain* chain) {
+    if (chain->num_species < 1 || chain->num_species > CHAIN_MAX_SPECIES) {
+        printf("Error: Rantai harus berisi 1..%d spesies.\n", CHAIN_MAX_SPECIES);
+        return 0;
+    }
+    for (int i = 0; i < chain->num_species; i++) {
+        const ChainSpecies* species = &chain->species[i];
+        if (!isfinite(species->lambda) || species->lambda <= 0.0) {
+            printf("Error: Konstanta peluruhan %s harus positif dan berhingga.\n", species->name);
+            return 0;
+        }
+        if (!(species->branching >= 0.0 && species->branching <= 1.0) || !(species->N0 >= 0.0)) {
+            printf("Error: Rasio percabangan (0..1) atau N0 (>= 0) %s tidak valid.\n", species->name);
+            return 0;
+        }
+        for (int j = 0; j < i; j++) {
+            if (chain->species[j].lambda == species->lambda) {
+                printf("Error: %s dan %s memiliki lambda yang sama (solusi Bateman tidak terdefinisi).\n",
+                       chain->species[j].name, species->name);
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+double chain_max_lambda(const DecayChain* chain) {
+    double max_lambda = 0.0;
+    for (int i = 0; i < chain->num_species; i++) {
+        if (chain->species[i].lambda > max_lambda) max_lambda = chain->species[i].lambda;
+    }
+    return max_lambda;
+}
+
+/**
+ * KONTAINER HASIL RANTAI
+ * ======================
+ */
+int chain_results_allocate(ChainResults* results, int num_species, int capacity) {
+    memset(results, 0, sizeof(*results));
+    if (capacity < 1 || num_species < 1 || num_species > CHAIN_MAX_SPECIES) return 0;
+
+    // Kolom waktu + 4 kolom per spesies, masing-masing dibulatkan ke cache line
+    size_t column_bytes = ((size_t)capacity * sizeof(double) + RESULTS_CACHE_LINE - 1)
+                          / RESULTS_CACHE_LINE * RESULTS_CACHE_LINE;
+    size_t num_columns = 1 + 4 * (size_t)num_species;
+    char* base = (char*)simulation_block_alloc(num_columns * column_bytes, &results->bytes_allocated);
+    if (base == NULL) return 0;
+
+    results->block = base;
+    results->time_s = (double*)base;
+    for (int s = 0; s < num_species; s++) {
+        size_t column = 1 + 4 * (size_t)s;
+        results->N_numerical[s] = (double*)(base + (column + 0) * column_bytes);
+        results->N_analytical[s] = (double*)(base + (column + 1) * column_bytes);
+        results->error_absolute[s] = (double*)(base + (column + 2) * column_bytes);
+        results->error_relative_percent[s] = (double*)(base + (column + 3) * column_bytes);
+    }
+    results->num_species = num_species;
+    results->capacity = capacity;
+    return 1;
+}
+
+void chain_results_free(ChainResults* results) {
+    simulation_block_free(results->block);
+    memset(results, 0, sizeof(*results));
+}
+
+SimulationResults chain_species_view(const ChainResults* results, int species) {
+    SimulationResults view = results_empty(RESULT_LAYOUT_SOA);
+    view.num_rows = results->num_rows;
+    view.capacity = results->num_rows;
+    view.time_s = results->time_s;
+    view.N_numerical = results->N_numerical[species];
+    view.N_analytical = results->N_analytical[species];
+    view.error_absolute = results->error_absolute[species];
+    view.error_relative_percent = results->error_relative_percent[species];
+    return view;
+}
+
+/**
+ * SOLUSI ANALITIK BATEMAN
+ * =======================
+ *
+ * Koefisien c[n][k] (k <= n) sehingga N_n(τ) = Σ_k c[n][k] e^{-λ_k τ} dengan
+ * τ = t - t_initial. Kontribusi setiap induk i dengan N_i(0) > 0 dijumlahkan
+ * ke koefisien yang sama, sehingga per baris cukup S evaluasi exp.
+ */
+static void bateman_coefficients(const DecayChain* chain,
+                                 double coefficients[CHAIN_MAX_SPECIES][CHAIN_MAX_SPECIES]) {
+    int S = chain->num_species;
+    memset(coefficients, 0, sizeof(double) * CHAIN_MAX_SPECIES * CHAIN_MAX_SPECIES);
+
+    for (int i = 0; i < S; i++) {
+        if (chain->species[i].N0 == 0.0) continue;
+        double production = chain->species[i].N0;   // N_i(0) Π_{j=i}^{n-1} b_j λ_j
+        for (int n = i; n < S; n++) {
+            if (n > i) {
+                production *= chain->species[n - 1].branching * chain->species[n - 1].lambda;
+            }
+            for (int k = i; k <= n; k++) {
+                double denominator = 1.0;
+                for (int m = i; m <= n; m++) {
+                    if (m != k) denominator *= chain->species[m].lambda - chain->species[k].lambda;
+                }
+                coefficients[n][k] += production / denominator;
+            }
+        }
+    }
+}
+
+void chain_fill_analytic(const DecayChain* chain, double t_initial, ChainResults* results,
+                         int first_row, int end_row) {
+    int S = chain->num_species;
+    double coefficients[CHAIN_MAX_SPECIES][CHAIN_MAX_SPECIES];
+    bateman_coefficients(chain, coefficients);
+
+    for (int row = first_row; row < end_row; row++) {
+        double tau = results->time_s[row] - t_initial;
+        double decay[CHAIN_MAX_SPECIES];
+        for (int k = 0; k < S; k++) decay[k] = exp(-chain->species[k].lambda * tau);
+
+        for (int n = 0; n < S; n++) {
+            // Pada τ = 0 jumlah suku Bateman hanya nol hingga pembatalan; nilai
+            // awal dipakai langsung agar error relatif baris pertama tidak palsu
+            double analytical = 0.0;
+            for (int k = 0; k <= n; k++) analytical += coefficients[n][k] * decay[k];
+            if (tau == 0.0) analytical = chain->species[n].N0;
+
+            double numerical = results->N_numerical[n][row];
+            double abs_error = fabs(numerical - analytical);
+            results->N_analytical[n][row] = analytical;
+            results->error_absolute[n][row] = abs_error;
+            results->error_relative_percent[n][row] = (analytical > 0.0) ? abs_error / analytical * 100.0 : 0.0;
+        }
+    }
+}
+
+/**
+ * STEP RANTAI O(S)
+ * ================
+ *
+ * Faktor yang hanya bergantung pada h dan λ dihitung sekali per run.
+ * source_rate[i] = b_{i-1} λ_{i-1} (laju pembentukan X_i per atom induk).
+ */
+typedef struct {
+    IntegratorMethod method;
+    int num_species;
+    double h;
+    double lambda[CHAIN_MAX_SPECIES];
+    double source_rate[CHAIN_MAX_SPECIES];
+
+    double polynomial[8];             // Koefisien R(z) metode eksplisit
+    int degree;
+
+    double decay_factor[CHAIN_MAX_SPECIES];   // exp-euler: e^{-λh}
+    double source_factor[CHAIN_MAX_SPECIES];  // exp-euler: h φ1(-λh) = -expm1(-λh) / λ
+} ChainStepper;
+
+/**
+ * Koefisien Taylor R(z) metode eksplisit (sama dengan integrator_amplification).
+ *
+ * @return int - Derajat polinomial, atau -1 untuk metode implisit/eksponensial
+ */
+static int explicit_polynomial(IntegratorMethod method, double polynomial[8]) {
+    static const double taylor[7] = {
+        1.0, 1.0, 1.0 / 2.0, 1.0 / 6.0, 1.0 / 24.0, 1.0 / 120.0, 1.0 / 600.0
+    };
+    int degree;
+    switch (method) {
+        case INTEGRATOR_EULER: degree = 1; break;
+        case INTEGRATOR_HEUN:  degree = 2; break;
+        case INTEGRATOR_RK4:   degree = 4; break;
+        case INTEGRATOR_RK45:  degree = 6; break;
+        default:               return -1;
+    }
+    for (int k = 0; k <= degree; k++) polynomial[k] = taylor[k];
+    return degree;
+}
+
+static void chain_stepper_init(ChainStepper* stepper, const DecayChain* chain,
+                               IntegratorMethod method, double h) {
+    stepper->method = method;
+    stepper->num_species = chain->num_species;
+    stepper->h = h;
+    stepper->degree = explicit_polynomial(method, stepper->polynomial);
+    for (int i = 0; i < chain->num_species; i++) {
+        double lambda = chain->species[i].lambda;
+        stepper->lambda[i] = lambda;
+        stepper->source_rate[i] = (i > 0) ? chain->species[i - 1].branching * chain->species[i - 1].lambda
+                                          : 0.0;
+        stepper->decay_factor[i] = exp(-lambda * h);
+        stepper->source_factor[i] = -expm1(-lambda * h) / lambda;
+    }
+}
+
+// v <- hA v di tempat (dari spesies terakhir ke pertama agar v_{i-1} lama terpakai)
+static void apply_hA(const ChainStepper* stepper, double* v) {
+    double h = stepper->h;
+    for (int i = stepper->num_species - 1; i > 0; i--) {
+        v[i] = h * (stepper->source_rate[i] * v[i - 1] - stepper->lambda[i] * v[i]);
+    }
+    v[0] = h * (-stepper->lambda[0] * v[0]);
+}
+
+static void chain_step(const ChainStepper* stepper, double* N) {
+    int S = stepper->num_species;
+    double h = stepper->h;
+
+    switch (stepper->method) {
+        case INTEGRATOR_BACKWARD_EULER:
+            // (I - hA) N' = N, substitusi maju
+            for (int i = 0; i < S; i++) {
+                double source = (i > 0) ? h * stepper->source_rate[i] * N[i - 1] : 0.0;
+                N[i] = (N[i] + source) / (1.0 + h * stepper->lambda[i]);
+            }
+            return;
+
+        case INTEGRATOR_CRANK_NICOLSON: {
+            // (I - hA/2) N' = (I + hA/2) N; N[i-1] lama disimpan sebelum ditimpa
+            double previous_old = 0.0;
+            for (int i = 0; i < S; i++) {
+                double half = 0.5 * h * stepper->lambda[i];
+                double old = N[i];
+                double rhs = old * (1.0 - half);
+                if (i > 0) rhs += 0.5 * h * stepper->source_rate[i] * (previous_old + N[i - 1]);
+                N[i] = rhs / (1.0 + half);
+                previous_old = old;
+            }
+            return;
+        }
+
+        case INTEGRATOR_EXPONENTIAL_EULER: {
+            // Sumber dari induk dianggap konstan selama step (nilai awal step)
+            double previous_old = 0.0;
+            for (int i = 0; i < S; i++) {
+                double old = N[i];
+                N[i] = old * stepper->decay_factor[i];
+                if (i > 0) N[i] += stepper->source_factor[i] * stepper->source_rate[i] * previous_old;
+                previous_old = old;
+            }
+            return;
+        }
+
+        case INTEGRATOR_CRAM: {
+            // α0 N + 2 Re Σ_j x_j, dengan (hA - θ_j I) x_j = α_j N (substitusi maju)
+            double next[CHAIN_MAX_SPECIES];
+            for (int i = 0; i < S; i++) next[i] = integrator_cram_alpha0 * N[i];
+            for (int j = 0; j < CRAM_NUM_POLES; j++) {
+                double complex alpha = integrator_cram_alpha[j][0] + integrator_cram_alpha[j][1] * I;
+                double complex theta = integrator_cram_theta[j][0] + integrator_cram_theta[j][1] * I;
+                double complex x_previous = 0.0;
+                for (int i = 0; i < S; i++) {
+                    double complex x = (alpha * N[i] - h * stepper->source_rate[i] * x_previous) /
+                                       (-h * stepper->lambda[i] - theta);
+                    next[i] += 2.0 * creal(x);
+                    x_previous = x;
+                }
+            }
+            for (int i = 0; i < S; i++) N[i] = next[i];
+            return;
+        }
+
+        default: {
+            // R(hA) N dengan Horner: acc = c_d N; acc = c_k N + hA acc
+            double acc[CHAIN_MAX_SPECIES];
+            for (int i = 0; i < S; i++) acc[i] = stepper->polynomial[stepper->degree] * N[i];
+            for (int k = stepper->degree - 1; k >= 0; k--) {
+                apply_hA(stepper, acc);
+                for (int i = 0; i < S; i++) acc[i] += stepper->polynomial[k] * N[i];
+            }
+            for (int i = 0; i < S; i++) N[i] = acc[i];
+            return;
+        }
+    }
+}
+
+/**
+ * KERNEL RANTAI (TANPA I/O)
+ * =========================
+ *
+ * Sama dengan decay_kernel di simulation.c: setiap baris menyimpan state
+ * sebelum step, waktu dibentuk dengan penjumlahan t + Δt yang sama, dan
+ * state dibawa lewat pointer agar dapat dipanggil per chunk.
+ */
+static void chain_kernel(const ChainStepper* stepper, double* state, double* current_t_ptr,
+                         ChainResults* results, int num_rows) {
+    double current_t = *current_t_ptr;
+    int S = stepper->num_species;
+
+    for (int row = 0; row < num_rows; row++) {
+        results->time_s[row] = current_t;
+        for (int s = 0; s < S; s++) results->N_numerical[s][row] = state[s];
+        chain_step(stepper, state);
+        current_t = current_t + stepper->h;
+    }
+
+    results->num_rows = num_rows;
+    *current_t_ptr = current_t;
+}
+
+int chain_simulate(
+    const DecayChain* chain,
+    double t_initial, double t_final, double delta_t,
+    IntegratorMethod method, ChainResults* results
+) {
+    if (delta_t <= 0) {
+        printf("Error: delta_t harus positif.\n");
+        return 0;
+    }
+
+    int num_steps = euler_step_count(t_initial, t_final, delta_t);
+    if (!chain_results_allocate(results, chain->num_species, num_steps + 1)) {
+        printf("Error: Gagal mengalokasikan memori untuk hasil rantai.\n");
+        return 0;
+    }
+
+    ChainStepper stepper;
+    chain_stepper_init(&stepper, chain, method, delta_t);
+    double state[CHAIN_MAX_SPECIES];
+    for (int s = 0; s < chain->num_species; s++) state[s] = chain->species[s].N0;
+    double current_t = t_initial;
+
+    chain_kernel(&stepper, state, &current_t, results, num_steps + 1);
+    chain_fill_analytic(chain, t_initial, results, 0, results->num_rows);
+    return num_steps;
+}
+
+int chain_simulate_stream(
+    const DecayChain* chain,
+    double t_initial, double t_final, double delta_t,
+    IntegratorMethod method, const ChainSink* sinks, int num_sinks
+) {
+    if (delta_t <= 0) {
+        printf("Error: delta_t harus positif.\n");
+        return 0;
+    }
+
+    int num_steps = euler_step_count(t_initial, t_final, delta_t);
+    int total_rows = num_steps + 1;
+    int chunk_rows = (total_rows < STREAM_CHUNK_ROWS) ? total_rows : STREAM_CHUNK_ROWS;
+
+    ChainResults chunk;
+    if (!chain_results_allocate(&chunk, chain->num_species, chunk_rows)) {
+        printf("Error: Gagal mengalokasikan memori untuk chunk streaming.\n");
+        return 0;
+    }
+
+    ChainStepper stepper;
+    chain_stepper_init(&stepper, chain, method, delta_t);
+    double state[CHAIN_MAX_SPECIES];
+    for (int s = 0; s < chain->num_species; s++) state[s] = chain->species[s].N0;
+    double current_t = t_initial;
+
+    int ok = 1;
+    for (int first_row = 0; first_row < total_rows && ok; first_row += chunk_rows) {
+        int rows = total_rows - first_row;
+        if (rows > chunk_rows) rows = chunk_rows;
+
+        chain_kernel(&stepper, state, &current_t, &chunk, rows);
+        chain_fill_analytic(chain, t_initial, &chunk, 0, rows);
+        for (int s = 0; s < num_sinks && ok; s++) {
+            ok = sinks[s].consume(sinks[s].context, &chunk, first_row);
+        }
+    }
+
+    chain_results_free(&chunk);
+    if (!ok) {
+        printf("Error: Sink streaming gagal memproses chunk.\n");
+        return 0;
+    }
+    return num_steps;
+}
@@ -0,0 +1,174 @@
+/**
+ * ========================================================================
+ * MODUL RANTAI PELURUHAN (BATEMAN) DENGAN N SPESIES
+ * ========================================================================
+ *
+ * Rantai linear X_0 -> X_1 -> ... -> X_{S-1} dengan persamaan
+ *
+ *   dN_0/dt = -λ_0 N_0
+ *   dN_i/dt = b_{i-1} λ_{i-1} N_{i-1} - λ_i N_i        (i >= 1)
+ *
+ * di mana b_{i-1} adalah rasio percabangan (fraksi peluruhan X_{i-1} yang
+ * menghasilkan X_i). Matriks sistemnya bidiagonal bawah, sehingga satu step
+ * setiap metode di integrator.h berbiaya O(S):
+ *
+ *   - metode eksplisit: untuk sistem linear y' = Ay, step RK apa pun sama
+ *     dengan y_{n+1} = R(hA) y_n; polinomial R dievaluasi dengan skema Horner
+ *     memakai perkalian matriks-vektor bidiagonal
+ *   - backward-euler / crank-nicolson: sistem (I - θhA) y_{n+1} = ... adalah
+ *     bidiagonal bawah dan diselesaikan dengan substitusi maju
+ *   - exp-euler: y_{n+1,i} = e^(-λ_i h) y_i + h φ1(-λ_i h) b_{i-1} λ_{i-1} y_{i-1}
+ *   - cram: delapan sistem kompleks (hA - θ_j I) x = α_j y, masing-masing
+ *     dengan substitusi maju; hasilnya exp(hA) y untuk h berapa pun
+ *
+ * Referensi analitik adalah solusi Bateman (dengan percabangan):
+ *
+ *   N_n(t) = Σ_{i<=n} N_i(0) Π_{j=i}^{n-1} b_j λ_j Σ_{k=i}^{n} e^{-λ_k t} / Π_{m=i..n, m≠k} (λ_m - λ_k)
+ *
+ * yang dikumpulkan menjadi N_n(t) = Σ_k c_{n,k} e^{-λ_k t}; koefisien
+ * c_{n,k} dihitung sekali per run. Solusi ini mensyaratkan semua λ berbeda.
+ */
+
+#ifndef CHAIN_H
+#define CHAIN_H
+
+#include <stddef.h>
+
+#include "integrator.h"
+#include "simulation.h"
+
+// Batas jumlah spesies (state dan koefisien Bateman disimpan di stack)
+#define CHAIN_MAX_SPECIES 16
+#define CHAIN_NAME_BYTES 16
+
+/**
+ * SATU NUKLIDA DALAM RANTAI
+ */
+typedef struct {
+    char name[CHAIN_NAME_BYTES];      // Mis. "Po-218"
+    double half_life_s;               // Waktu paruh (s)
+    double lambda;                    // ln(2) / waktu paruh (s⁻¹)
+    double branching;                 // Fraksi peluruhan yang menghasilkan spesies berikutnya
+    double N0;                        // Jumlah atom awal
+} ChainSpecies;
+
+typedef struct {
+    int num_species;
+    ChainSpecies species[CHAIN_MAX_SPECIES];
+} DecayChain;
+
+/**
+ * Rantai Rn-222 -> Po-218 -> Pb-214 -> Bi-214 -> Po-214 -> Pb-210 dengan
+ * N0 atom Rn-222 murni pada t = 0. Waktu paruh anak (NNDC): 3.098 menit,
+ * 26.8 menit, 19.9 menit, 164.3 µs, dan 22.2 tahun; percabangan Po-218
+ * (99.98% alfa) dan Bi-214 (99.979% beta) ke cabang yang tidak dilacak
+ * diperhitungkan lewat b_i.
+ */
+void chain_radon222(DecayChain* chain, double N0, double radon_half_life_s);
+
+/**
+ * Memeriksa rantai: 1..CHAIN_MAX_SPECIES spesies, λ > 0 berhingga dan
+ * saling berbeda (syarat solusi Bateman), 0 <= b <= 1, N0 >= 0.
+ * Pesan error dicetak ke stdout.
+ *
+ * @return int - 1 jika valid, 0 jika tidak
+ */
+int chain_validate(const DecayChain* chain);
+
+/**
+ * λ terbesar dalam rantai (menentukan batas stabilitas metode eksplisit).
+ */
+double chain_max_lambda(const DecayChain* chain);
+
+/**
+ * KONTAINER HASIL RANTAI
+ * ======================
+ *
+ * Satu blok teralokasi-rata berisi kolom waktu bersama dan empat kolom per
+ * spesies (N numerik, N analitik Bateman, error absolut, error relatif),
+ * masing-masing kontigu dan dimulai pada batas cache line. Setiap spesies
+ * dapat dilihat sebagai SimulationResults SoA (chain_species_view) sehingga
+ * tabel, CSV, dan reduktor error yang sudah ada bekerja per spesies.
+ */
+typedef struct {
+    int num_species;
+    int num_rows;
+    int capacity;
+
+    void* block;
+    size_t bytes_allocated;
+
+    double* time_s;
+    double* N_numerical[CHAIN_MAX_SPECIES];
+    double* N_analytical[CHAIN_MAX_SPECIES];
+    double* error_absolute[CHAIN_MAX_SPECIES];
+    double* error_relative_percent[CHAIN_MAX_SPECIES];
+} ChainResults;
+
+/**
+ * Mengalokasikan kontainer untuk tepat `capacity` baris.
+ *
+ * @return int - 1 jika berhasil, 0 jika alokasi gagal
+ */
+int chain_results_allocate(ChainResults* results, int num_species, int capacity);
+void chain_results_free(ChainResults* results);
+
+/**
+ * Tampilan SimulationResults (SoA, stride 1, tanpa kepemilikan memori) atas
+ * kolom waktu dan kolom spesies ke-s.
+ */
+SimulationResults chain_species_view(const ChainResults* results, int species);
+
+/**
+ * Mengisi kolom analitik Bateman dan error untuk baris [first_row, end_row).
+ */
+void chain_fill_analytic(const DecayChain* chain, double t_initial, ChainResults* results,
+                         int first_row, int end_row);
+
+/**
+ * SIMULASI RANTAI DENGAN STEP TETAP
+ * =================================
+ *
+ * Jumlah step sama dengan simulasi tunggal (euler_step_count); kontainer
+ * dialokasikan sekali dengan ukuran tepat.
+ *
+ * @param chain               - Rantai (sudah lolos chain_validate)
+ * @param t_initial           - Waktu awal simulasi (s)
+ * @param t_final             - Waktu akhir simulasi (s)
+ * @param delta_t             - Ukuran step waktu (s)
+ * @param method              - Metode integrasi (lihat integrator.h)
+ * @param results             - Kontainer hasil (dialokasikan oleh fungsi ini)
+ *
+ * @return int - Jumlah step, atau 0 jika gagal
+ */
+int chain_simulate(
+    const DecayChain* chain,
+    double t_initial, double t_final, double delta_t,
+    IntegratorMethod method, ChainResults* results
+);
+
+/**
+ * SINK UNTUK MODE STREAMING RANTAI
+ *
+ * Sama dengan ResultSink, tetapi chunk berisi seluruh spesies.
+ */
+typedef int (*ChainSinkFn)(void* context, const ChainResults* chunk, int first_row);
+
+typedef struct {
+    ChainSinkFn consume;
+    void* context;
+} ChainSink;
+
+/**
+ * Mode streaming dari chain_simulate: hanya satu chunk STREAM_CHUNK_ROWS
+ * baris yang dialokasikan; nilai setiap baris identik dengan chain_simulate.
+ *
+ * @return int - Jumlah step, atau 0 jika gagal
+ */
+int chain_simulate_stream(
+    const DecayChain* chain,
+    double t_initial, double t_final, double delta_t,
+    IntegratorMethod method, const ChainSink* sinks, int num_sinks
+);
+
+#endif // CHAIN_H
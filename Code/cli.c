@@ -0,0 +1,679 @@
+/**
+ * ========================================================================
+ * IMPLEMENTASI OPSI BARIS PERINTAH DAN FILE KONFIGURASI
+ * ========================================================================
+ *
+ * Lihat cli.h untuk daftar opsi dan format file konfigurasi.
+ */
+
+#include "cli.h"
+#include "stats.h"
+#include "task_pool.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <errno.h>
+#include <limits.h>
+#include <math.h>
+
+// Sweep delta_t default (lihat sweep.h untuk sintaks)
+#define DEFAULT_SWEEP_SPEC "list:T/10,T/20,T/50,T/100,T/200"
+
+/**
+ * DAFTAR OPSI
+ * ===========
+ *
+ * takes_value = 0 untuk flag. --help, --print-config, dan alias pendek
+ * (-h, -q, -v) hanya berlaku di baris perintah.
+ */
+typedef struct {
+    const char* name;
+    int takes_value;
+} OptionSpec;
+
+static const OptionSpec option_specs[] = {
+    { "config", 1 },
+    { "isotope", 1 }, { "n0", 1 }, { "half-life", 1 }, { "horizon", 1 },
+    { "nuclide-data", 1 }, { "compile-nuclides", 1 },
+    { "method", 1 }, { "direct", 0 }, { "precision", 1 }, { "layout", 1 },
+    { "chain", 0 }, { "network", 0 }, { "adaptive", 0 }, { "atol", 1 }, { "rtol", 1 },
+    { "stochastic", 1 }, { "seed", 1 }, { "gillespie", 0 },
+    { "ensemble", 1 }, { "n0-spread", 1 }, { "half-life-spread", 1 }, { "quantiles", 1 },
+    { "sweep", 1 }, { "sweep-file", 1 }, { "summary-only", 0 }, { "richardson", 0 },
+    { "target-error", 1 }, { "max-steps", 1 },
+    { "format", 1 }, { "binary", 0 }, { "output-dir", 1 }, { "stream", 0 },
+    { "threads", 1 }, { "stats", 0 },
+    { "quiet", 0 }, { "verbose", 0 }, { "verbosity", 1 },
+};
+
+static const OptionSpec* find_option(const char* name) {
+    for (size_t i = 0; i < sizeof(option_specs) / sizeof(option_specs[0]); i++) {
+        if (strcmp(option_specs[i].name, name) == 0) return &option_specs[i];
+    }
+    return NULL;
+}
+
+/**
+ * PARSING NILAI
+ * =============
+ */
+
+// Bilangan bulat tak bertanda (jumlah trajektori, seed, thread)
+static int parse_count(const char* text, unsigned long long max_value, unsigned long long* value) {
+    char* end;
+    errno = 0;
+    unsigned long long parsed = strtoull(text, &end, 10);
+    if (end == text || *end != '\0' || text[0] == '-' || errno != 0 || parsed > max_value) return 0;
+    *value = parsed;
+    return 1;
+}
+
+// Angka berhingga >= 0 (seluruh teks harus terpakai)
+static int parse_nonnegative(const char* text, double* value) {
+    char* end;
+    double parsed = strtod(text, &end);
+    if (end == text || *end != '\0' || !isfinite(parsed) || parsed < 0.0) return 0;
+    *value = parsed;
+    return 1;
+}
+
+static int parse_positive(const char* text, double* value) {
+    double parsed;
+    if (!parse_nonnegative(text, &parsed) || parsed <= 0.0) return 0;
+    *value = parsed;
+    return 1;
+}
+
+// Daftar kuantil "p1,p2,..." dengan setiap p di [0, 1]
+static int parse_quantiles(const char* text, double* values, int* count) {
+    double parsed_values[ENSEMBLE_MAX_QUANTILES];
+    int n = 0;
+    const char* p = text;
+    for (;;) {
+        char* end;
+        double parsed = strtod(p, &end);
+        if (end == p || !(parsed >= 0.0 && parsed <= 1.0) || n == ENSEMBLE_MAX_QUANTILES) return 0;
+        parsed_values[n++] = parsed;
+        if (*end == '\0') break;
+        if (*end != ',') return 0;
+        p = end + 1;
+    }
+    memcpy(values, parsed_values, (size_t)n * sizeof(double));
+    *count = n;
+    return 1;
+}
+
+// Nilai flag dari file konfigurasi; NULL (baris perintah) berarti aktif
+static int parse_flag(const char* text, int* flag) {
+    if (text == NULL || strcmp(text, "true") == 0 || strcmp(text, "yes") == 0 ||
+        strcmp(text, "on") == 0 || strcmp(text, "1") == 0) {
+        *flag = 1;
+        return 1;
+    }
+    if (strcmp(text, "false") == 0 || strcmp(text, "no") == 0 ||
+        strcmp(text, "off") == 0 || strcmp(text, "0") == 0) {
+        *flag = 0;
+        return 1;
+    }
+    return 0;
+}
+
+// Salinan teks ke buffer tetap; 0 jika kosong atau terlalu panjang
+static int copy_text(char* out, size_t size, const char* text) {
+    size_t length = strlen(text);
+    if (length == 0 || length >= size) return 0;
+    memcpy(out, text, length + 1);
+    return 1;
+}
+
+static int add_sweep_source(RunOptions* options, int from_file, const char* text) {
+    SweepSource* sources = (SweepSource*)realloc(
+        options->sweep_sources, (size_t)(options->num_sweep_sources + 1) * sizeof(SweepSource));
+    if (sources == NULL) return 0;
+    options->sweep_sources = sources;
+
+    size_t length = strlen(text);
+    char* copy = (char*)malloc(length + 1);
+    if (copy == NULL) return 0;
+    memcpy(copy, text, length + 1);
+    sources[options->num_sweep_sources++] = (SweepSource){ from_file, copy };
+    return 1;
+}
+
+static int load_config_file(RunOptions* options, const char* filename, int depth);
+
+/**
+ * PENERAPAN SATU OPSI
+ * ===================
+ *
+ * value adalah NULL untuk flag di baris perintah. Mengembalikan 1 jika
+ * berhasil, 0 jika nilai tidak valid (pesan dicetak pemanggil), atau -1 jika
+ * gagal dengan pesan yang sudah dicetak (file --config, alokasi).
+ */
+static int apply_option(RunOptions* options, const char* name, const char* value, int depth) {
+    int flag = 0;
+    unsigned long long count;
+    const OptionSpec* spec = find_option(name);
+    if (spec != NULL && !spec->takes_value && !parse_flag(value, &flag)) return 0;
+
+    if (strcmp(name, "config") == 0) {
+        if (depth >= CLI_MAX_CONFIG_DEPTH) {
+            printf("Error: --config bersarang terlalu dalam (maks. %d).\n", CLI_MAX_CONFIG_DEPTH);
+            return -1;
+        }
+        return load_config_file(options, value, depth + 1) ? 1 : -1;
+    } else if (strcmp(name, "isotope") == 0) {
+        return copy_text(options->isotope, sizeof(options->isotope), value);
+    } else if (strcmp(name, "n0") == 0) {
+        return parse_positive(value, &options->N0);
+    } else if (strcmp(name, "half-life") == 0) {
+        options->half_life_given = 1;
+        return nuclide_parse_half_life(value, 0, &options->half_life_s);
+    } else if (strcmp(name, "horizon") == 0) {
+        return copy_text(options->horizon, sizeof(options->horizon), value);
+    } else if (strcmp(name, "nuclide-data") == 0) {
+        return copy_text(options->nuclide_data, sizeof(options->nuclide_data), value);
+    } else if (strcmp(name, "compile-nuclides") == 0) {
+        return copy_text(options->compile_nuclides, sizeof(options->compile_nuclides), value);
+    } else if (strcmp(name, "method") == 0) {
+        if (!integrator_from_name(value, &options->method)) return 0;
+        options->method_given = 1;
+    } else if (strcmp(name, "direct") == 0) {
+        if (flag) {
+            options->evaluation_mode = EULER_MODE_DIRECT;
+        } else if (options->evaluation_mode == EULER_MODE_DIRECT) {
+            options->evaluation_mode = EULER_MODE_SEQUENTIAL;
+        }
+    } else if (strcmp(name, "precision") == 0) {
+        EulerEvaluationMode mode;
+        if (!evaluation_mode_from_name(value, &mode) || mode == EULER_MODE_DIRECT) return 0;
+        options->evaluation_mode = mode;
+    } else if (strcmp(name, "layout") == 0) {
+        if (strcmp(value, "aos") == 0) {
+            options->result_layout = RESULT_LAYOUT_AOS;
+        } else if (strcmp(value, "soa") == 0) {
+            options->result_layout = RESULT_LAYOUT_SOA;
+        } else {
+            return 0;
+        }
+    } else if (strcmp(name, "chain") == 0) {
+        options->use_chain = flag;
+    } else if (strcmp(name, "network") == 0) {
+        options->use_network = flag;
+    } else if (strcmp(name, "adaptive") == 0) {
+        options->adaptive = flag;
+    } else if (strcmp(name, "atol") == 0) {
+        return parse_nonnegative(value, &options->adaptive_control.atol);
+    } else if (strcmp(name, "rtol") == 0) {
+        return parse_nonnegative(value, &options->adaptive_control.rtol);
+    } else if (strcmp(name, "stochastic") == 0) {
+        if (!parse_count(value, LLONG_MAX, &count) || count == 0) return 0;
+        options->stochastic_trajectories = count;
+    } else if (strcmp(name, "seed") == 0) {
+        return parse_count(value, ULLONG_MAX, &options->seed);
+    } else if (strcmp(name, "gillespie") == 0) {
+        options->stochastic_sampler = flag ? STOCHASTIC_GILLESPIE : STOCHASTIC_BINOMIAL;
+    } else if (strcmp(name, "ensemble") == 0) {
+        if (!parse_count(value, LLONG_MAX, &count) || count == 0) return 0;
+        options->ensemble_members = count;
+    } else if (strcmp(name, "n0-spread") == 0) {
+        return parse_nonnegative(value, &options->ensemble_N0_spread);
+    } else if (strcmp(name, "half-life-spread") == 0) {
+        return parse_nonnegative(value, &options->ensemble_half_life_spread);
+    } else if (strcmp(name, "quantiles") == 0) {
+        return parse_quantiles(value, options->ensemble_quantiles, &options->num_ensemble_quantiles);
+    } else if (strcmp(name, "sweep") == 0 || strcmp(name, "sweep-file") == 0) {
+        if (!add_sweep_source(options, strcmp(name, "sweep-file") == 0, value)) {
+            printf("Error: Gagal mengalokasikan memori untuk sweep.\n");
+            return -1;
+        }
+    } else if (strcmp(name, "summary-only") == 0) {
+        options->summary_only = flag;
+    } else if (strcmp(name, "richardson") == 0) {
+        options->richardson = flag;
+    } else if (strcmp(name, "target-error") == 0) {
+        return parse_positive(value, &options->target_error);
+    } else if (strcmp(name, "max-steps") == 0) {
+        if (!parse_count(value, INT_MAX - 2, &count) || count == 0) return 0;
+        options->target_max_steps = count;
+    } else if (strcmp(name, "format") == 0) {
+        if (strcmp(value, "csv") == 0) {
+            options->write_csv = 1;
+            options->write_binary = 0;
+        } else if (strcmp(value, "binary") == 0) {
+            options->write_csv = 0;
+            options->write_binary = 1;
+        } else if (strcmp(value, "csv+binary") == 0) {
+            options->write_csv = 1;
+            options->write_binary = 1;
+        } else if (strcmp(value, "none") == 0) {
+            options->write_csv = 0;
+            options->write_binary = 0;
+        } else {
+            return 0;
+        }
+    } else if (strcmp(name, "binary") == 0) {
+        options->write_binary = flag;
+    } else if (strcmp(name, "output-dir") == 0) {
+        return copy_text(options->output_dir, sizeof(options->output_dir), value);
+    } else if (strcmp(name, "stream") == 0) {
+        options->streaming = flag;
+    } else if (strcmp(name, "threads") == 0) {
+        if (!parse_count(value, 4096, &count) || count == 0) return 0;
+        options->num_threads = (int)count;
+        options->threads_given = 1;
+    } else if (strcmp(name, "stats") == 0) {
+        options->collect_stats = flag;
+    } else if (strcmp(name, "quiet") == 0) {
+        if (flag) options->verbosity = CLI_QUIET;
+    } else if (strcmp(name, "verbose") == 0) {
+        if (flag) options->verbosity = CLI_VERBOSE;
+    } else if (strcmp(name, "verbosity") == 0) {
+        if (!parse_count(value, CLI_VERBOSE, &count)) return 0;
+        options->verbosity = (int)count;
+    } else {
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ * INISIALISASI DAN DEALOKASI
+ * ==========================
+ */
+void run_options_init(RunOptions* options) {
+    memset(options, 0, sizeof(*options));
+
+    // Parameter fisik Radon-222: T_half = 3.8235 hari, N0 = 10^15 atom
+    strcpy(options->isotope, "Rn-222");
+    options->N0 = 1.0e15;
+    options->half_life_s = 3.8235 * 24.0 * 60.0 * 60.0;
+    options->t_start = 0.0;
+    strcpy(options->horizon, "T*4");
+
+    options->method = INTEGRATOR_EULER;
+    options->evaluation_mode = EULER_MODE_SEQUENTIAL;
+    options->result_layout = RESULT_LAYOUT_AOS;
+    options->adaptive_control = (AdaptiveControl){ 1.0, 1.0e-6, 0.0, 0.0 };
+    options->target_max_steps = TARGET_DEFAULT_MAX_STEPS;
+
+    options->seed = STOCHASTIC_DEFAULT_SEED;
+    options->stochastic_sampler = STOCHASTIC_BINOMIAL;
+    options->ensemble_N0_spread = 0.05;
+    options->ensemble_half_life_spread = 0.02;
+    options->ensemble_quantiles[0] = 0.025;
+    options->ensemble_quantiles[1] = 0.5;
+    options->ensemble_quantiles[2] = 0.975;
+    options->num_ensemble_quantiles = 3;
+
+    sweep_values_init(&options->delta_t_sweep);
+
+    options->write_csv = 1;
+    options->num_threads = task_pool_default_threads();
+    options->verbosity = CLI_NORMAL;
+}
+
+void run_options_free(RunOptions* options) {
+    for (int i = 0; i < options->num_sweep_sources; i++) free(options->sweep_sources[i].text);
+    free(options->sweep_sources);
+    options->sweep_sources = NULL;
+    options->num_sweep_sources = 0;
+    sweep_values_free(&options->delta_t_sweep);
+    if (options->nuclides_loaded) nuclide_library_free(&options->nuclides);
+    options->nuclides_loaded = 0;
+    options->nuclide = NULL;
+}
+
+/**
+ * FILE KONFIGURASI
+ * ================
+ */
+
+// Membuang spasi di awal dan akhir (in-place)
+static char* trim(char* text) {
+    while (isspace((unsigned char)*text)) text++;
+    char* end = text + strlen(text);
+    while (end > text && isspace((unsigned char)end[-1])) *--end = '\0';
+    return text;
+}
+
+static int load_config_file(RunOptions* options, const char* filename, int depth) {
+    FILE* fp = fopen(filename, "r");
+    if (fp == NULL) {
+        printf("Error: Gagal membuka file konfigurasi %s.\n", filename);
+        return 0;
+    }
+
+    char line[4096];
+    int line_number = 0;
+    int ok = 1;
+    while (ok && fgets(line, sizeof(line), fp) != NULL) {
+        line_number++;
+        size_t length = strlen(line);
+        if (length == sizeof(line) - 1 && line[length - 1] != '\n' && !feof(fp)) {
+            printf("Error: Baris %d di %s terlalu panjang (maks. %d karakter).\n",
+                   line_number, filename, (int)sizeof(line) - 2);
+            ok = 0;
+            break;
+        }
+
+        char* comment = strchr(line, '#');
+        if (comment != NULL) *comment = '\0';
+        char* key = trim(line);
+        if (*key == '\0') continue;
+
+        // "kunci = nilai" atau "kunci nilai"; awalan "--" pada kunci diterima
+        char* value = strchr(key, '=');
+        if (value == NULL) {
+            value = key;
+            while (*value != '\0' && !isspace((unsigned char)*value)) value++;
+        }
+        if (*value != '\0') *value++ = '\0';
+        key = trim(key);
+        value = trim(value);
+        if (strncmp(key, "--", 2) == 0) key += 2;
+
+        const OptionSpec* spec = find_option(key);
+        if (spec == NULL) {
+            printf("Error: Kunci tidak dikenal '%s' di %s baris %d.\n", key, filename, line_number);
+            ok = 0;
+        } else if (spec->takes_value && *value == '\0') {
+            printf("Error: Kunci '%s' memerlukan nilai di %s baris %d.\n", key, filename, line_number);
+            ok = 0;
+        } else {
+            int applied = apply_option(options, key, (*value != '\0') ? value : NULL, depth);
+            if (applied == 0) {
+                printf("Error: Nilai tidak valid untuk '%s': '%s' di %s baris %d.\n",
+                       key, value, filename, line_number);
+            } else if (applied < 0) {
+                printf("  (di %s baris %d)\n", filename, line_number);
+            }
+            ok = applied > 0;
+        }
+    }
+
+    fclose(fp);
+    return ok;
+}
+
+int run_options_load_file(RunOptions* options, const char* filename) {
+    return load_config_file(options, filename, 0);
+}
+
+/**
+ * BARIS PERINTAH
+ * ==============
+ */
+void run_options_print_usage(const char* program) {
+    printf("Penggunaan: %s [OPSI...]\n"
+           "Nuklida dan horizon:\n"
+           "  --isotope NAMA|ZAI --n0 X --half-life X[s|m|h|d|y] --horizon T*x|T/x|DETIK\n"
+           "  [--nuclide-data FILE] [--compile-nuclides FILE]\n"
+           "Metode:\n"
+           "  --method METODE [--direct] [--precision PRESISI] [--layout aos|soa]\n"
+           "  [--chain] [--network] [--adaptive] [--atol X] [--rtol X]\n"
+           "  [--stochastic M] [--seed S] [--gillespie]\n"
+           "  [--ensemble M] [--n0-spread S] [--half-life-spread S] [--quantiles P,...]\n"
+           "  [--target-error X] [--max-steps N] [--richardson]\n"
+           "Sweep delta_t:\n"
+           "  [--sweep SPEK] [--sweep-file FILE] [--summary-only]\n"
+           "Keluaran:\n"
+           "  [--format csv|binary|csv+binary|none] [--binary] [--output-dir DIR] [--stream]\n"
+           "  [--threads N] [--stats] [-q|--quiet] [-v|--verbose] [--verbosity 0|1|2]\n"
+           "Lainnya:\n"
+           "  [--config FILE] [--print-config] [-h|--help]\n", program);
+    printf("METODE:");
+    for (int m = 0; m < INTEGRATOR_COUNT; m++) {
+        printf(" %s", integrator_info((IntegratorMethod)m)->name);
+    }
+    printf("\nPRESISI:");
+    for (int m = 0; m < EULER_MODE_COUNT; m++) {
+        if ((EulerEvaluationMode)m != EULER_MODE_DIRECT) printf(" %s", evaluation_mode_name((EulerEvaluationMode)m));
+    }
+    printf("\n");
+}
+
+CliStatus run_options_parse_args(RunOptions* options, int argc, char** argv) {
+    int print_config = 0;
+
+    for (int a = 1; a < argc; a++) {
+        const char* arg = argv[a];
+        if (strcmp(arg, "-h") == 0 || strcmp(arg, "--help") == 0) {
+            run_options_print_usage(argv[0]);
+            return CLI_EXIT_SUCCESS;
+        }
+        if (strcmp(arg, "--print-config") == 0) {
+            print_config = 1;
+            continue;
+        }
+        if (strcmp(arg, "-q") == 0) arg = "--quiet";
+        if (strcmp(arg, "-v") == 0) arg = "--verbose";
+
+        // --nama NILAI atau --nama=NILAI
+        char name[64];
+        const char* value = NULL;
+        const OptionSpec* spec = NULL;
+        if (strncmp(arg, "--", 2) == 0) {
+            const char* equals = strchr(arg + 2, '=');
+            size_t length = equals ? (size_t)(equals - (arg + 2)) : strlen(arg + 2);
+            if (length < sizeof(name)) {
+                memcpy(name, arg + 2, length);
+                name[length] = '\0';
+                spec = find_option(name);
+                if (equals != NULL) value = equals + 1;
+            }
+        }
+        if (spec == NULL) {
+            printf("Opsi tidak dikenal: %s\n", argv[a]);
+            run_options_print_usage(argv[0]);
+            return CLI_EXIT_FAILURE;
+        }
+        if (spec->takes_value && value == NULL) {
+            if (a + 1 >= argc) {
+                printf("Error: --%s memerlukan nilai.\n", name);
+                return CLI_EXIT_FAILURE;
+            }
+            value = argv[++a];
+        }
+
+        int applied = apply_option(options, name, value, 0);
+        if (applied == 0) {
+            printf("Error: Nilai tidak valid untuk --%s: '%s'\n", name, value ? value : "");
+            run_options_print_usage(argv[0]);
+        }
+        if (applied <= 0) return CLI_EXIT_FAILURE;
+    }
+
+    if (!run_options_resolve(options)) return CLI_EXIT_FAILURE;
+    if (print_config) {
+        run_options_write(options, stdout);
+        return CLI_EXIT_SUCCESS;
+    }
+    return CLI_RUN;
+}
+
+/**
+ * NILAI TURUNAN
+ * =============
+ */
+static int compare_doubles(const void* a, const void* b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+// ZAI Rn-222, satu-satunya nuklida dengan waktu paruh bawaan
+#define DEFAULT_ISOTOPE_ZAI 862220u
+
+// Memuat --nuclide-data dan mengambil waktu paruh --isotope dari pustaka
+static int resolve_nuclide(RunOptions* options) {
+    if (options->nuclide_data[0] == '\0') {
+        if (options->compile_nuclides[0] != '\0') {
+            printf("Error: --compile-nuclides memerlukan --nuclide-data FILE.\n");
+            return 0;
+        }
+        if (options->use_network) {
+            printf("Error: --network memerlukan --nuclide-data FILE.\n");
+            return 0;
+        }
+        // Tanpa pustaka, waktu paruh default hanya benar untuk Rn-222
+        uint32_t zai;
+        int is_default = nuclide_zai_from_name(options->isotope, &zai) && zai == DEFAULT_ISOTOPE_ZAI;
+        if (!is_default && !options->half_life_given) {
+            printf("Error: --isotope %s memerlukan --nuclide-data FILE atau --half-life X "
+                   "(waktu paruh bawaan hanya untuk Rn-222).\n", options->isotope);
+            return 0;
+        }
+        return 1;
+    }
+    if (!options->nuclides_loaded) {
+        double start = stats_now();
+        if (!nuclide_library_load(&options->nuclides, options->nuclide_data)) return 0;
+        options->nuclides_load_seconds = stats_now() - start;
+        options->nuclides_loaded = 1;
+    }
+    if (options->compile_nuclides[0] != '\0') return 1;
+
+    const NuclideRecord* record = nuclide_find(&options->nuclides, options->isotope);
+    if (record == NULL) {
+        printf("Error: Nuklida '%s' tidak ada di pustaka %s.\n", options->isotope, options->nuclide_data);
+        return 0;
+    }
+    if (record->lambda <= 0.0) {
+        printf("Error: %s stabil; tidak ada peluruhan untuk disimulasikan.\n", record->name);
+        return 0;
+    }
+    options->nuclide = record;
+    snprintf(options->isotope, sizeof(options->isotope), "%s", record->name);
+    if (!options->half_life_given) options->half_life_s = record->half_life_s;
+    return 1;
+}
+
+int run_options_resolve(RunOptions* options) {
+    if (!resolve_nuclide(options)) return 0;
+    options->lambda = log(2.0) / options->half_life_s;
+    if (!sweep_parse_time(options->horizon, options->half_life_s, &options->t_end)) {
+        printf("  (horizon)\n");
+        return 0;
+    }
+    options->t_end += options->t_start;
+
+    // Nilai delta_t dari --sweep / --sweep-file sesuai urutan opsi
+    //   Default: T_half/10 ≈ 9.18 jam, T_half/20 ≈ 4.59 jam, T_half/50 ≈ 1.84 jam,
+    //   T_half/100 ≈ 0.92 jam, T_half/200 ≈ 0.46 jam (untuk Rn-222)
+    SweepValues* sweep = &options->delta_t_sweep;
+    sweep_values_free(sweep);
+    int ok = 1;
+    for (int i = 0; i < options->num_sweep_sources && ok; i++) {
+        const SweepSource* source = &options->sweep_sources[i];
+        ok = source->from_file ? sweep_load_file(source->text, options->half_life_s, sweep)
+                               : sweep_parse_spec(source->text, options->half_life_s, sweep);
+    }
+    if (ok && sweep->count == 0) ok = sweep_parse_spec(DEFAULT_SWEEP_SPEC, options->half_life_s, sweep);
+
+    // Nilai kembar akan menulis file hasil yang sama (bersamaan jika paralel)
+    if (ok && sweep->count > 1) {
+        double* sorted = (double*)malloc((size_t)sweep->count * sizeof(double));
+        ok = sorted != NULL;
+        if (ok) {
+            memcpy(sorted, sweep->values, (size_t)sweep->count * sizeof(double));
+            qsort(sorted, (size_t)sweep->count, sizeof(double), compare_doubles);
+            for (int i = 1; i < sweep->count && ok; i++) {
+                if (sorted[i] == sorted[i - 1]) {
+                    printf("Error: delta_t = %.17g muncul lebih dari sekali di sweep.\n", sorted[i]);
+                    ok = 0;
+                }
+            }
+        }
+        free(sorted);
+    }
+
+    // Jumlah baris (step + 1) harus muat di int
+    for (int i = 0; i < sweep->count && ok; i++) {
+        if ((options->t_end - options->t_start) / sweep->values[i] > (double)(INT_MAX - 2)) {
+            printf("Error: delta_t = %.6e s menghasilkan terlalu banyak step (maks. %d).\n",
+                   sweep->values[i], INT_MAX - 2);
+            ok = 0;
+        }
+    }
+    return ok;
+}
+
+/**
+ * PENULISAN KONFIGURASI
+ * =====================
+ */
+void run_options_write(const RunOptions* options, FILE* stream) {
+    static const char* format_names[2][2] = { { "none", "binary" }, { "csv", "csv+binary" } };
+    const char* yes_no[2] = { "false", "true" };
+
+    fprintf(stream, "# Nuklida dan horizon\n");
+    if (options->nuclide_data[0] != '\0') fprintf(stream, "nuclide-data = %s\n", options->nuclide_data);
+    fprintf(stream, "isotope = %s\n", options->isotope);
+    fprintf(stream, "n0 = %.17g\n", options->N0);
+    if (options->nuclide != NULL && !options->half_life_given) {
+        fprintf(stream, "# half-life = %.17gs (dari pustaka nuklida)\n", options->half_life_s);
+    } else {
+        fprintf(stream, "half-life = %.17gs\n", options->half_life_s);
+    }
+    fprintf(stream, "horizon = %s\n", options->horizon);
+
+    fprintf(stream, "# Metode\n");
+    if (options->method_given) {
+        fprintf(stream, "method = %s\n", integrator_info(options->method)->name);
+    } else {
+        fprintf(stream, "# method = %s (default)\n", integrator_info(options->method)->name);
+    }
+    fprintf(stream, "direct = %s\n", yes_no[options->evaluation_mode == EULER_MODE_DIRECT]);
+    if (options->evaluation_mode != EULER_MODE_DIRECT) {
+        fprintf(stream, "precision = %s\n", evaluation_mode_name(options->evaluation_mode));
+    }
+    fprintf(stream, "layout = %s\n", results_layout_name(options->result_layout));
+    fprintf(stream, "chain = %s\n", yes_no[options->use_chain != 0]);
+    fprintf(stream, "network = %s\n", yes_no[options->use_network != 0]);
+    fprintf(stream, "adaptive = %s\n", yes_no[options->adaptive != 0]);
+    fprintf(stream, "atol = %.17g\n", options->adaptive_control.atol);
+    fprintf(stream, "rtol = %.17g\n", options->adaptive_control.rtol);
+    if (options->target_error > 0.0) fprintf(stream, "target-error = %.17g\n", options->target_error);
+    fprintf(stream, "max-steps = %llu\n", options->target_max_steps);
+    fprintf(stream, "richardson = %s\n", yes_no[options->richardson != 0]);
+
+    fprintf(stream, "# Monte Carlo dan ensemble parameter\n");
+    if (options->stochastic_trajectories > 0) {
+        fprintf(stream, "stochastic = %llu\n", options->stochastic_trajectories);
+    }
+    fprintf(stream, "seed = %llu\n", options->seed);
+    fprintf(stream, "gillespie = %s\n", yes_no[options->stochastic_sampler == STOCHASTIC_GILLESPIE]);
+    if (options->ensemble_members > 0) fprintf(stream, "ensemble = %llu\n", options->ensemble_members);
+    fprintf(stream, "n0-spread = %.17g\n", options->ensemble_N0_spread);
+    fprintf(stream, "half-life-spread = %.17g\n", options->ensemble_half_life_spread);
+    fprintf(stream, "quantiles = ");
+    for (int q = 0; q < options->num_ensemble_quantiles; q++) {
+        fprintf(stream, "%s%.17g", (q > 0) ? "," : "", options->ensemble_quantiles[q]);
+    }
+    fprintf(stream, "\n");
+
+    fprintf(stream, "# Sweep delta_t\n");
+    for (int i = 0; i < options->num_sweep_sources; i++) {
+        fprintf(stream, "%s = %s\n", options->sweep_sources[i].from_file ? "sweep-file" : "sweep",
+                options->sweep_sources[i].text);
+    }
+    if (options->num_sweep_sources == 0) fprintf(stream, "# sweep = %s (default)\n", DEFAULT_SWEEP_SPEC);
+    fprintf(stream, "summary-only = %s\n", yes_no[options->summary_only != 0]);
+
+    fprintf(stream, "# Keluaran\n");
+    fprintf(stream, "format = %s\n", format_names[options->write_csv != 0][options->write_binary != 0]);
+    if (options->output_dir[0] != '\0') {
+        fprintf(stream, "output-dir = %s\n", options->output_dir);
+    } else {
+        fprintf(stream, "# output-dir = (direktori kerja)\n");
+    }
+    fprintf(stream, "stream = %s\n", yes_no[options->streaming != 0]);
+    if (options->threads_given) {
+        fprintf(stream, "threads = %d\n", options->num_threads);
+    } else {
+        fprintf(stream, "# threads = %d (default: jumlah prosesor)\n", options->num_threads);
+    }
+    fprintf(stream, "stats = %s\n", yes_no[options->collect_stats != 0]);
+    fprintf(stream, "verbosity = %d\n", options->verbosity);
+}
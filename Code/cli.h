@@ -0,0 +1,198 @@
+/**
+ * ========================================================================
+ * MODUL OPSI BARIS PERINTAH DAN FILE KONFIGURASI
+ * ========================================================================
+ *
+ * Semua parameter run (nuklida, horizon, sweep delta_t, metode, format dan
+ * direktori keluaran, verbositas) dibaca saat runtime sehingga satu binari
+ * teroptimasi dapat menjalankan skenario apa pun tanpa kompilasi ulang.
+ *
+ * Opsi diberikan sebagai argumen (--nama NILAI, atau --nama untuk flag) atau
+ * lewat file konfigurasi (--config FILE) dengan satu opsi per baris:
+ *
+ *   # Skenario Rn-222 dengan horizon 10 waktu paruh
+ *   isotope   = Rn-222
+ *   half-life = 3.8235d
+ *   horizon   = T*10
+ *   sweep     = geom:T/10:T/1000:20
+ *   method    = rk4
+ *   format    = csv+binary
+ *   output-dir = hasil/rn222
+ *   summary-only = true
+ *
+ * Nama kunci sama dengan nama opsi tanpa "--"; flag menerima true/false,
+ * yes/no, on/off, atau 1/0. Baris kosong dan teks setelah '#' diabaikan.
+ * Opsi diproses berurutan (termasuk isi file konfigurasi di posisi --config),
+ * sehingga opsi setelahnya menimpa nilai sebelumnya; --sweep dan --sweep-file
+ * ditambahkan sesuai urutan. Nilai berbentuk T/x dan T*x (sweep, horizon)
+ * diselesaikan setelah seluruh opsi terbaca, dengan waktu paruh akhir.
+ *
+ * Satuan waktu paruh: detik tanpa akhiran, atau akhiran ns, us, ms, s, m, h,
+ * d, y (tahun Julian, 365.25 hari), misalnya "3.8235d" atau "1600y".
+ *
+ * Dengan --nuclide-data FILE (teks atau image biner, lihat nuclide.h),
+ * --isotope NAMA|ZAI dicari di pustaka: nama dikanonikkan dan waktu paruh
+ * diambil dari pustaka kecuali --half-life diberikan eksplisit. Tanpa
+ * pustaka, --isotope hanya label dan waktu paruh default adalah Rn-222,
+ * sehingga nuklida lain memerlukan --half-life eksplisit.
+ * --compile-nuclides FILE menulis pustaka yang dimuat sebagai image biner
+ * lalu keluar.
+ */
+
+#ifndef CLI_H
+#define CLI_H
+
+#include <stdio.h>
+
+#include "ensemble.h"
+#include "integrator.h"
+#include "nuclide.h"
+#include "output.h"
+#include "simulation.h"
+#include "stochastic.h"
+#include "sweep.h"
+
+// Panjang maksimum nama nuklida dan teks horizon
+#define CLI_NAME_BYTES 32
+
+// Kedalaman maksimum --config di dalam file konfigurasi
+#define CLI_MAX_CONFIG_DEPTH 8
+
+// Batas jumlah step per run untuk --target-error (default --max-steps)
+#define TARGET_DEFAULT_MAX_STEPS 100000000
+
+/**
+ * STATUS PARSING
+ */
+typedef enum {
+    CLI_RUN = 0,          // Opsi valid, jalankan program
+    CLI_EXIT_SUCCESS,     // --help atau --print-config: keluar dengan status 0
+    CLI_EXIT_FAILURE      // Opsi atau nilai tidak valid (pesan sudah dicetak)
+} CliStatus;
+
+/**
+ * Tingkat keluaran konsol (--quiet, --verbose, --verbosity N)
+ */
+typedef enum {
+    CLI_QUIET = 0,        // Tanpa header dan tabel per kasus sweep (kecuali kasus gagal)
+    CLI_NORMAL = 1,       // Default
+    CLI_VERBOSE = 2       // Tambahan: konfigurasi lengkap sebelum run
+} CliVerbosity;
+
+/**
+ * Sumber nilai delta_t: spesifikasi (--sweep) atau file (--sweep-file)
+ */
+typedef struct {
+    int from_file;
+    char* text;
+} SweepSource;
+
+/**
+ * SELURUH OPSI RUN
+ * ================
+ *
+ * Nilai default setara program asli: Rn-222, N0 = 10^15 atom, horizon
+ * 4 waktu paruh, sweep list:T/10,T/20,T/50,T/100,T/200, metode Euler, CSV
+ * di direktori kerja.
+ */
+typedef struct {
+    // Nuklida dan horizon
+    char isotope[CLI_NAME_BYTES];
+    double N0;
+    double half_life_s;
+    int half_life_given;              // 0 = waktu paruh dari pustaka nuklida (jika ada)
+    double lambda;                    // ln 2 / half_life_s (run_options_resolve)
+    double t_start;
+    char horizon[CLI_NAME_BYTES];     // t_end: detik, T, T/x, atau T*x
+    double t_end;                     // Diisi run_options_resolve
+
+    // Pustaka data nuklida (dimuat run_options_resolve)
+    char nuclide_data[OUTPUT_PATH_MAX - 128];
+    char compile_nuclides[OUTPUT_PATH_MAX - 128];
+    NuclideLibrary nuclides;
+    int nuclides_loaded;
+    double nuclides_load_seconds;
+    const NuclideRecord* nuclide;     // Record --isotope, NULL tanpa pustaka
+
+    // Integrasi
+    IntegratorMethod method;
+    int method_given;
+    EulerEvaluationMode evaluation_mode;
+    ResultLayout result_layout;
+    int use_chain;
+    int use_network;                  // Jaringan seluruh cabang pustaka (--network)
+    int adaptive;
+    AdaptiveControl adaptive_control;
+    double target_error;              // 0 = tanpa pencarian target akurasi
+    unsigned long long target_max_steps;
+
+    // Monte Carlo dan ensemble parameter
+    unsigned long long stochastic_trajectories;   // 0 = mode deterministik
+    unsigned long long seed;
+    StochasticSampler stochastic_sampler;
+    unsigned long long ensemble_members;          // 0 = tanpa ensemble parameter
+    double ensemble_N0_spread;
+    double ensemble_half_life_spread;
+    double ensemble_quantiles[ENSEMBLE_MAX_QUANTILES];
+    int num_ensemble_quantiles;
+
+    // Sweep delta_t
+    SweepSource* sweep_sources;
+    int num_sweep_sources;
+    SweepValues delta_t_sweep;        // Diisi run_options_resolve
+
+    // Keluaran dan eksekusi
+    int write_csv;
+    int write_binary;
+    char output_dir[OUTPUT_PATH_MAX - 128];
+    int streaming;
+    int summary_only;
+    int richardson;
+    int collect_stats;
+    int num_threads;
+    int threads_given;                // 0 = default jumlah prosesor
+    int verbosity;                    // CliVerbosity
+} RunOptions;
+
+/**
+ * Mengisi opsi dengan nilai default.
+ */
+void run_options_init(RunOptions* options);
+
+void run_options_free(RunOptions* options);
+
+/**
+ * Mem-parse argumen baris perintah (argv[1..argc-1]) ke options, termasuk
+ * file konfigurasi dari --config, lalu menyelesaikan nilai turunan
+ * (run_options_resolve). Pesan error dan bantuan dicetak ke stdout.
+ */
+CliStatus run_options_parse_args(RunOptions* options, int argc, char** argv);
+
+/**
+ * Membaca file konfigurasi (format di atas) ke options.
+ *
+ * @return int - 1 jika berhasil, 0 jika file tidak dapat dibaca atau tidak valid
+ */
+int run_options_load_file(RunOptions* options, const char* filename);
+
+/**
+ * Memuat pustaka nuklida dan mencari --isotope (jika --nuclide-data
+ * diberikan), menghitung lambda dan t_end, membangun delta_t_sweep dari sumber sweep
+ * (atau sweep default), dan memeriksa batas jumlah step.
+ *
+ * @return int - 1 jika berhasil, 0 jika ada nilai yang tidak valid
+ */
+int run_options_resolve(RunOptions* options);
+
+/**
+ * Menulis opsi dalam format file konfigurasi (dapat dibaca kembali dengan
+ * --config).
+ */
+void run_options_write(const RunOptions* options, FILE* stream);
+
+/**
+ * Mencetak ringkasan penggunaan program.
+ */
+void run_options_print_usage(const char* program);
+
+#endif // CLI_H
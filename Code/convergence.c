@@ -0,0 +1,168 @@
+/**
+ * ========================================================================
+ * IMPLEMENTASI ANALISIS KONVERGENSI
+ * ========================================================================
+ *
+ * Lihat convergence.h. Regresi memakai rata-rata terpusat (bukan Σx², Σxy
+ * mentah) agar tidak kehilangan digit saat ln Δt hampir sama.
+ */
+
+#include "convergence.h"
+
+#include <math.h>
+
+int convergence_fit_order(const double* delta_t, const double* error, int num_cases,
+                          ConvergenceFit* fit) {
+    *fit = (ConvergenceFit){ 0, NAN, NAN, NAN, NAN };
+
+    // Rata-rata ln Δt dan ln e atas titik yang valid
+    int n = 0;
+    double mean_x = 0.0, mean_y = 0.0;
+    for (int i = 0; i < num_cases; i++) {
+        if (!(delta_t[i] > 0.0) || !(error[i] >= CONVERGENCE_MIN_ERROR) ||
+            !(error[i] <= CONVERGENCE_MAX_ERROR)) {
+            continue;
+        }
+        n++;
+        mean_x += (log(delta_t[i]) - mean_x) / n;
+        mean_y += (log(error[i]) - mean_y) / n;
+    }
+    if (n < 2) return 0;
+
+    double sxx = 0.0, sxy = 0.0, syy = 0.0;
+    for (int i = 0; i < num_cases; i++) {
+        if (!(delta_t[i] > 0.0) || !(error[i] >= CONVERGENCE_MIN_ERROR) ||
+            !(error[i] <= CONVERGENCE_MAX_ERROR)) {
+            continue;
+        }
+        double dx = log(delta_t[i]) - mean_x;
+        double dy = log(error[i]) - mean_y;
+        sxx += dx * dx;
+        sxy += dx * dy;
+        syy += dy * dy;
+    }
+    if (!(sxx > 0.0)) return 0;
+
+    double order = sxy / sxx;
+    double residual = syy - order * sxy;
+    if (residual < 0.0) residual = 0.0;
+
+    fit->num_points = n;
+    fit->order = order;
+    fit->order_stderr = (n > 2) ? sqrt(residual / (double)(n - 2) / sxx) : 0.0;
+    fit->log_constant = mean_y - order * mean_x;
+    fit->r_squared = (syy > 0.0) ? 1.0 - residual / syy : 1.0;
+    return 1;
+}
+
+double convergence_local_order(double delta_t_1, double error_1, double delta_t_2, double error_2) {
+    if (!(error_1 > 0.0) || !(error_2 > 0.0) || delta_t_1 == delta_t_2) return NAN;
+    return log(error_1 / error_2) / log(delta_t_1 / delta_t_2);
+}
+
+double convergence_richardson(double N_coarse, double N_fine, double ratio, double order) {
+    return N_fine + (N_fine - N_coarse) / (pow(ratio, order) - 1.0);
+}
+
+double convergence_step_for_error(const ConvergenceFit* fit, double target_error) {
+    if (!(target_error > 0.0) || !(fit->order > 0.0)) return NAN;
+    return exp((log(target_error) - fit->log_constant) / fit->order);
+}
+
+// Jumlah titik gagal terakhir yang dipakai untuk fit model selama pencarian
+// (titik awal sering berada di luar daerah asimtotik)
+#define SEARCH_FIT_POINTS 3
+
+int convergence_search_steps(ConvergenceErrorFn error_at, void* context, double time_span,
+                             double target_error, int max_steps, ConvergenceSearch* search) {
+    *search = (ConvergenceSearch){ 0, 0, NAN, NAN, 0, 0 };
+    if (!(target_error > 0.0) || !(time_span > 0.0) || max_steps < 1) return 0;
+
+    double history_delta_t[CONVERGENCE_SEARCH_MAX_HISTORY];
+    double history_error[CONVERGENCE_SEARCH_MAX_HISTORY];
+    int history = 0;
+
+    // TAHAP 1: PERBESAR JUMLAH STEP HINGGA TARGET TERLEWATI
+    // =====================================================
+    int fail = 0, pass = 0;
+    double fail_error = NAN, pass_error = NAN;
+    int steps = 1;
+    for (;;) {
+        double error = error_at(context, steps);
+        search->evaluations++;
+        search->total_steps += steps;
+        if (error <= target_error) {
+            pass = steps;
+            pass_error = error;
+            break;
+        }
+
+        // Error berhenti turun di daerah asimtotik: batas pembulatan (hanya
+        // diperiksa untuk lompatan minimal 2x agar derau pembulatan tidak ikut)
+        if (fail > 0 && steps >= 2 * fail && fail_error <= CONVERGENCE_MAX_ERROR && error <= CONVERGENCE_MAX_ERROR &&
+            !(convergence_local_order(time_span / fail, fail_error, time_span / steps, error) > 0.1)) {
+            search->predicted_steps = NAN;
+            return 0;
+        }
+        fail = steps;
+        fail_error = error;
+        if (steps >= max_steps) return 0;
+
+        if (history == CONVERGENCE_SEARCH_MAX_HISTORY) {
+            for (int i = 1; i < history; i++) {
+                history_delta_t[i - 1] = history_delta_t[i];
+                history_error[i - 1] = history_error[i];
+            }
+            history--;
+        }
+        history_delta_t[history] = time_span / steps;
+        history_error[history] = error;
+        history++;
+
+        // Tebakan berikutnya dari model, atau dua kali lipat jika belum ada model
+        double next = 2.0 * steps;
+        int first = (history > SEARCH_FIT_POINTS) ? history - SEARCH_FIT_POINTS : 0;
+        ConvergenceFit fit;
+        if (convergence_fit_order(history_delta_t + first, history_error + first, history - first, &fit) &&
+            fit.order > 0.0) {
+            double predicted = ceil(time_span / convergence_step_for_error(&fit, target_error));
+            search->predicted_steps = predicted;
+            if (predicted > steps) next = fmin(predicted, (double)steps * CONVERGENCE_SEARCH_MAX_GROWTH);
+        }
+        steps = (next >= (double)max_steps) ? max_steps : (int)next;
+    }
+
+    // TAHAP 2: PERSEMPIT SELANG [GAGAL, LOLOS]
+    // ========================================
+    // Tebakan interpolasi log-log dan bisection bergantian: tebakan biasanya
+    // langsung mengenai batas, bisection menjamin selang menyusut
+    int guided = 1;
+    while (pass - fail > 1 && (double)(pass - fail) > CONVERGENCE_SEARCH_STEP_TOLERANCE * pass) {
+        int probe = fail + (pass - fail) / 2;
+        if (guided && fail > 0) {
+            double local = convergence_local_order(time_span / fail, fail_error, time_span / pass, pass_error);
+            if (fail_error <= CONVERGENCE_MAX_ERROR && local > 0.0) {
+                double guess = ceil((double)fail * pow(fail_error / target_error, 1.0 / local));
+                probe = (int)fmax((double)fail + 1.0, fmin(guess, (double)pass - 1.0));
+            }
+        }
+        guided = !guided;
+
+        double error = error_at(context, probe);
+        search->evaluations++;
+        search->total_steps += probe;
+        if (error <= target_error) {
+            pass = probe;
+            pass_error = error;
+        } else {
+            fail = probe;
+            fail_error = error;
+        }
+    }
+
+    search->reached = 1;
+    search->steps = pass;
+    search->error = pass_error;
+    search->predicted_steps = (double)pass;
+    return 1;
+}
@@ -0,0 +1,131 @@
+/**
+ * ========================================================================
+ * MODUL ANALISIS KONVERGENSI DAN EKSTRAPOLASI RICHARDSON
+ * ========================================================================
+ *
+ * Untuk metode berorde p, error global pada waktu akhir berperilaku
+ *
+ *   e(Δt) ≈ C Δt^p   (Δt cukup kecil)
+ *
+ * sehingga orde teramati diperoleh dari regresi kuadrat terkecil
+ * ln e = ln C + p ln Δt atas kasus-kasus sweep delta_t. Kecocokan yang
+ * sama memberi Δt yang dibutuhkan untuk mencapai error target.
+ *
+ * Ekstrapolasi Richardson menggabungkan dua run dengan Δt_kasar = r Δt_halus
+ * untuk menghapus suku error terdepan:
+ *
+ *   N_R = N_halus + (N_halus - N_kasar) / (r^p - 1)
+ *
+ * Hasilnya berorde p + 1 (untuk metode dengan ekspansi error penuh), jauh
+ * lebih murah daripada satu run dengan Δt yang sangat kecil.
+ *
+ * Pencarian target akurasi (convergence_search_steps) mencari jumlah step
+ * terkecil yang memenuhi error target: step diperbesar menurut model
+ * e = C Δt^p dari run sebelumnya hingga target terlewati, lalu selang
+ * [gagal, lolos] dipersempit dengan bisection yang diselingi tebakan
+ * interpolasi log-log.
+ */
+
+#ifndef CONVERGENCE_H
+#define CONVERGENCE_H
+
+// Rentang error relatif (pecahan) yang dipakai untuk regresi: di bawahnya
+// error didominasi pembulatan, di atasnya Δt di luar daerah asimtotik
+// (atau metode eksplisit tidak stabil)
+#define CONVERGENCE_MIN_ERROR 1.0e-12
+#define CONVERGENCE_MAX_ERROR 0.5
+
+/**
+ * HASIL REGRESI ORDE
+ * ==================
+ */
+typedef struct {
+    int num_points;                   // Jumlah titik yang dipakai
+    double order;                     // Orde teramati p
+    double order_stderr;              // Galat baku p (0 jika hanya dua titik)
+    double log_constant;              // ln C
+    double r_squared;                 // Koefisien determinasi di skala log
+} ConvergenceFit;
+
+/**
+ * Regresi kuadrat terkecil ln e terhadap ln Δt. Titik dengan error di luar
+ * [CONVERGENCE_MIN_ERROR, CONVERGENCE_MAX_ERROR] atau tidak hingga dilewati.
+ *
+ * @param delta_t     - Ukuran step tiap kasus (s)
+ * @param error       - Error relatif akhir tiap kasus (pecahan, bukan persen)
+ * @param num_cases   - Jumlah kasus
+ * @param fit         - Hasil regresi
+ * @return int - 1 jika ada minimal dua titik dengan Δt berbeda, 0 jika tidak
+ */
+int convergence_fit_order(const double* delta_t, const double* error, int num_cases,
+                          ConvergenceFit* fit);
+
+/**
+ * Orde lokal antara dua kasus: ln(e_1 / e_2) / ln(Δt_1 / Δt_2).
+ *
+ * @return double - Orde lokal, atau NaN jika salah satu error tidak positif
+ */
+double convergence_local_order(double delta_t_1, double error_1, double delta_t_2, double error_2);
+
+/**
+ * Satu tingkat ekstrapolasi Richardson.
+ *
+ * @param N_coarse    - Hasil dengan Δt kasar
+ * @param N_fine      - Hasil dengan Δt halus
+ * @param ratio       - Δt_kasar / Δt_halus (> 1)
+ * @param order       - Orde error terdepan p
+ * @return double - N_R
+ */
+double convergence_richardson(double N_coarse, double N_fine, double ratio, double order);
+
+/**
+ * Δt yang menurut model e = C Δt^p menghasilkan error relatif target.
+ *
+ * @return double - Δt (s), atau NaN jika target atau orde tidak positif
+ */
+double convergence_step_for_error(const ConvergenceFit* fit, double target_error);
+
+/**
+ * PENCARIAN JUMLAH STEP UNTUK ERROR TARGET
+ * ========================================
+ *
+ * Fungsi evaluasi menjalankan simulasi dengan `steps` step seragam (Δt =
+ * time_span / steps, sehingga waktu akhir selalu tepat t_end) dan
+ * mengembalikan error relatif akhir (pecahan). Error diasumsikan turun
+ * monoton terhadap jumlah step begitu Δt berada di daerah stabil.
+ */
+typedef double (*ConvergenceErrorFn)(void* context, int steps);
+
+// Batas lompatan jumlah step per tebakan model (melindungi dari fit awal yang buruk)
+#define CONVERGENCE_SEARCH_MAX_GROWTH 64
+
+// Lebar selang relatif tempat pencarian berhenti: pada jutaan step, error
+// pembulatan (~n ε) membuat error tidak lagi monoton pada digit terakhirnya
+#define CONVERGENCE_SEARCH_STEP_TOLERANCE 1.0e-3
+
+// Jumlah titik riwayat maksimum untuk fit model selama pencarian
+#define CONVERGENCE_SEARCH_MAX_HISTORY 64
+
+typedef struct {
+    int reached;                      // 1 jika target tercapai dalam max_steps
+    int steps;                        // Jumlah step minimum yang lolos, dalam toleransi
+                                      // CONVERGENCE_SEARCH_STEP_TOLERANCE (0 jika tidak tercapai)
+    double error;                     // Error relatif pada `steps`
+    double predicted_steps;           // Perkiraan model jika tidak tercapai (NaN jika tidak ada)
+    int evaluations;                  // Jumlah run selama pencarian
+    long long total_steps;            // Jumlah step seluruh run pencarian
+} ConvergenceSearch;
+
+/**
+ * @param error_at        - Fungsi evaluasi error
+ * @param context         - Argumen untuk error_at
+ * @param time_span       - t_end - t_start (s), untuk model e = C Δt^p
+ * @param target_error    - Error relatif target (pecahan, > 0)
+ * @param max_steps       - Jumlah step maksimum yang boleh dicoba
+ * @param search          - Hasil pencarian
+ * @return int - 1 jika target tercapai, 0 jika tidak
+ */
+int convergence_search_steps(ConvergenceErrorFn error_at, void* context, double time_span,
+                             double target_error, int max_steps, ConvergenceSearch* search);
+
+#endif // CONVERGENCE_H
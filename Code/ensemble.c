@@ -0,0 +1,498 @@
+/**
+ * ========================================================================
+ * IMPLEMENTASI ENSEMBLE DETERMINISTIK
+ * ========================================================================
+ *
+ * Lihat ensemble.h untuk model, tata letak, dan skema reproduktibilitas.
+ */
+
+#include "ensemble.h"
+#include "simulation.h"
+#include "stochastic.h"
+#include "task_pool.h"
+#include "vexp.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Anggota per tugas: kelipatan lebar SIMD, state chunk (N dan faktor, 32 KiB)
+// tetap di cache selama satu kelompok baris
+#define ENSEMBLE_CHUNK 2048
+
+// Lane per blok loop: blok berukuran tetap divektorisasi penuh oleh kompiler
+// (juga pada -O2, tanpa loop sisa), dan akumulator per lane membuat urutan
+// penjumlahan tetap
+#define ENSEMBLE_LANES 8
+
+// Ukuran sampel untuk pengurungan kuantil; baris dengan anggota kurang dari
+// 4x sampel langsung memakai quickselect
+#define ENSEMBLE_SELECT_SAMPLE 32768
+
+static int ensemble_num_chunks(long long num_members) {
+    return (int)((num_members + ENSEMBLE_CHUNK - 1) / ENSEMBLE_CHUNK);
+}
+
+// Menjalankan num_tasks tugas di pool, atau serial jika hanya satu thread
+static void ensemble_run_tasks(int num_tasks, int num_threads, TaskFn fn, void* context) {
+    TaskPool pool;
+    int parallel = 0;
+    if (num_threads > 1 && num_tasks > 1) {
+        parallel = task_pool_start(&pool, num_tasks, num_threads, fn, context);
+        // Tidak ada pekerja yang berjalan: tugas dijalankan di thread utama
+        if (!parallel) task_pool_finish(&pool);
+    }
+    if (parallel) {
+        task_pool_finish(&pool);
+    } else {
+        for (int task = 0; task < num_tasks; task++) fn(context, task);
+    }
+}
+
+/**
+ * PARAMETER ANGGOTA
+ * =================
+ */
+int ensemble_members_allocate(EnsembleMembers* members, long long num_members) {
+    memset(members, 0, sizeof(*members));
+    size_t column_bytes = ((size_t)num_members * sizeof(double) + RESULTS_CACHE_LINE - 1)
+                          / RESULTS_CACHE_LINE * RESULTS_CACHE_LINE;
+    char* base = (char*)simulation_block_alloc(2 * column_bytes, &members->bytes_allocated);
+    if (base == NULL) return 0;
+
+    members->block = base;
+    members->N0 = (double*)base;
+    members->lambda = (double*)(base + column_bytes);
+    members->num_members = num_members;
+    return 1;
+}
+
+void ensemble_members_free(EnsembleMembers* members) {
+    simulation_block_free(members->block);
+    memset(members, 0, sizeof(*members));
+}
+
+typedef struct {
+    EnsembleMembers* members;
+    double N0;
+    double lambda;
+    double N0_spread;
+    double half_life_spread;
+    uint64_t seed;
+} PerturbContext;
+
+static void perturb_chunk(void* context, int chunk) {
+    PerturbContext* perturb = (PerturbContext*)context;
+    long long first = (long long)chunk * ENSEMBLE_CHUNK;
+    long long last = first + ENSEMBLE_CHUNK;
+    if (last > perturb->members->num_members) last = perturb->members->num_members;
+
+    for (long long j = first; j < last; j++) {
+        RngStream stream;
+        rng_stream_init(&stream, perturb->seed, (uint64_t)j);
+        double z = rng_normal(&stream);
+        double w = rng_normal(&stream);
+        perturb->members->N0[j] = perturb->N0 * exp(perturb->N0_spread * z);
+        perturb->members->lambda[j] = perturb->lambda * exp(-perturb->half_life_spread * w);
+    }
+}
+
+void ensemble_members_perturb(EnsembleMembers* members, double N0, double lambda,
+                              double N0_spread, double half_life_spread,
+                              uint64_t seed, int num_threads) {
+    PerturbContext perturb = { members, N0, lambda, N0_spread, half_life_spread, seed };
+    ensemble_run_tasks(ensemble_num_chunks(members->num_members), num_threads, perturb_chunk, &perturb);
+}
+
+/**
+ * SELEKSI KUANTIL
+ * ===============
+ * Quickselect (Hoare, pivot median-of-3) pada a[lo..hi]: setelahnya a[k]
+ * adalah statistik terurut ke-k, a[lo..k-1] <= a[k] <= a[k+1..hi].
+ */
+static void select_rank(double* a, long long lo, long long hi, long long k) {
+    #define ENSEMBLE_SWAP(x, y) do { double swap_ = a[x]; a[x] = a[y]; a[y] = swap_; } while (0)
+    while (hi > lo) {
+        long long mid = lo + (hi - lo) / 2;
+        if (a[mid] < a[lo]) ENSEMBLE_SWAP(mid, lo);
+        if (a[hi] < a[lo]) ENSEMBLE_SWAP(hi, lo);
+        if (a[hi] < a[mid]) ENSEMBLE_SWAP(hi, mid);
+        double pivot = a[mid];
+
+        long long i = lo, j = hi;
+        while (i <= j) {
+            while (a[i] < pivot) i++;
+            while (a[j] > pivot) j--;
+            if (i <= j) {
+                ENSEMBLE_SWAP(i, j);
+                i++;
+                j--;
+            }
+        }
+        if (k <= j) {
+            hi = j;
+        } else if (k >= i) {
+            lo = i;
+        } else {
+            return;
+        }
+    }
+    #undef ENSEMBLE_SWAP
+}
+
+static int compare_double(const void* a, const void* b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+// Statistik terurut ke-k dan berikutnya dari a[lo..hi] (a diacak ulang)
+static void order_pair(double* a, long long lo, long long hi, long long k,
+                       double* value_k, double* value_next) {
+    select_rank(a, lo, hi, k);
+    double next = a[k];
+    if (k < hi) {
+        next = a[k + 1];
+        for (long long j = k + 2; j <= hi; j++) {
+            if (a[j] < next) next = a[j];
+        }
+    }
+    *value_k = a[k];
+    *value_next = next;
+}
+
+/**
+ * KUANTIL SATU BARIS
+ * ==================
+ * Untuk M besar, quickselect penuh per kuantil didominasi salah prediksi
+ * cabang. Seperti Floyd-Rivest, sampel terurut (ENSEMBLE_SELECT_SAMPLE
+ * elemen dengan jarak tetap) memberi batas [low, high] yang hampir pasti
+ * mengurung peringkat k (margin 5σ). Satu lintasan baca-saja tanpa cabang
+ * menghitung elemen < low dan menyalin elemen di dalam kurungan ke buffer
+ * kecil (~2 * 5√s / s bagian dari M), lalu quickselect hanya berjalan pada
+ * buffer. Jika kurungan meleset, buffer penuh, atau ada NaN, kuantil
+ * tersebut memakai quickselect penuh pada values. Hasilnya identik dengan
+ * quickselect penuh.
+ */
+static void row_quantiles(double* values, long long M, const double* p, int num_quantiles, double* out) {
+    const int s = ENSEMBLE_SELECT_SAMPLE;
+    long long margin = (long long)(2.5 * sqrt((double)s)) + 1;   // 5σ, σ <= √s / 2
+    double* sample = NULL;
+    double* bracket = NULL;
+    long long capacity = 0;
+    if (M >= 4 * (long long)s) {
+        // Kapasitas ~2x ukuran kurungan yang diharapkan
+        capacity = 4 * margin * (M / s + 1);
+        if (capacity > M) capacity = M;
+        sample = (double*)malloc((size_t)s * sizeof(double));
+        bracket = (double*)malloc((size_t)capacity * sizeof(double));
+        if (sample != NULL && bracket != NULL) {
+            double stride = (double)M / s;
+            for (int i = 0; i < s; i++) sample[i] = values[(long long)(i * stride)];
+            qsort(sample, (size_t)s, sizeof(double), compare_double);
+        }
+    }
+
+    for (int q = 0; q < num_quantiles; q++) {
+        double h = (double)(M - 1) * p[q];
+        long long k = (long long)floor(h);
+        if (k > M - 1) k = M - 1;
+        double value, next;
+        int done = 0;
+
+        if (sample != NULL && bracket != NULL) {
+            long long center = (long long)((double)k / (double)(M - 1) * (s - 1) + 0.5);
+            double low = (center - margin > 0) ? sample[center - margin] : -INFINITY;
+            double high = (center + margin < s - 1) ? sample[center + margin] : INFINITY;
+
+            long long below = 0, count = 0;
+            for (long long j = 0; j < M && count < capacity; j++) {
+                double x = values[j];
+                below += (x < low);
+                bracket[count] = x;
+                count += (x >= low) & (x <= high);
+            }
+            // Peringkat k dan k + 1 (jika ada) harus berada di kurungan
+            long long last = (k + 1 < M) ? k + 1 : k;
+            if (count < capacity && below <= k && last < below + count) {
+                order_pair(bracket, 0, count - 1, k - below, &value, &next);
+                done = 1;
+            }
+        }
+        if (!done) order_pair(values, 0, M - 1, k, &value, &next);
+
+        double fraction = h - (double)k;
+        out[q] = (fraction > 0.0) ? value + fraction * (next - value) : value;
+    }
+
+    free(sample);
+    free(bracket);
+}
+
+/**
+ * PROSES SATU KELOMPOK BARIS
+ * ==========================
+ */
+
+// Statistik parsial satu chunk untuk satu baris
+typedef struct {
+    double mean;
+    double m2;                        // Σ (N - mean)²
+    double analytical_sum;            // Σ N0 e^{-λτ}
+} ChunkMoments;
+
+typedef struct {
+    const EnsembleConfig* config;
+    EnsembleResults* results;
+    long long num_members;
+    int num_chunks;
+
+    double* N;                        // State saat ini per anggota
+    double* factor;                   // R(-λ_j Δt) per anggota
+    double* tile;                     // [baris kelompok][anggota]
+    ChunkMoments* partial;            // [chunk][baris kelompok]
+
+    int first_row;
+    int tile_rows;
+} EnsembleTile;
+
+/**
+ * KERNEL LANE
+ * ===========
+ * Blok ENSEMBLE_LANES anggota tanpa ketergantungan antar lane; sisa chunk
+ * (jika jumlah anggota bukan kelipatan lane) masuk ke lane yang sama agar
+ * hasil tidak bergantung pada posisi chunk.
+ */
+static void lockstep_advance(double* restrict N, const double* restrict factor,
+                             double* restrict out, int n) {
+    int k = 0;
+    for (; k + ENSEMBLE_LANES <= n; k += ENSEMBLE_LANES) {
+        for (int l = 0; l < ENSEMBLE_LANES; l++) {
+            N[k + l] *= factor[k + l];
+            out[k + l] = N[k + l];
+        }
+    }
+    for (; k < n; k++) {
+        N[k] *= factor[k];
+        out[k] = N[k];
+    }
+}
+
+static double lane_reduce(const double lanes[ENSEMBLE_LANES]) {
+    double total = 0.0;
+    for (int l = 0; l < ENSEMBLE_LANES; l++) total += lanes[l];
+    return total;
+}
+
+static double lane_sum(const double* restrict x, int n) {
+    double lanes[ENSEMBLE_LANES] = { 0.0 };
+    int k = 0;
+    for (; k + ENSEMBLE_LANES <= n; k += ENSEMBLE_LANES) {
+        for (int l = 0; l < ENSEMBLE_LANES; l++) lanes[l] += x[k + l];
+    }
+    for (; k < n; k++) lanes[k % ENSEMBLE_LANES] += x[k];
+    return lane_reduce(lanes);
+}
+
+static double lane_squared_deviation(const double* restrict x, double mean, int n) {
+    double lanes[ENSEMBLE_LANES] = { 0.0 };
+    int k = 0;
+    for (; k + ENSEMBLE_LANES <= n; k += ENSEMBLE_LANES) {
+        for (int l = 0; l < ENSEMBLE_LANES; l++) lanes[l] += (x[k + l] - mean) * (x[k + l] - mean);
+    }
+    for (; k < n; k++) lanes[k % ENSEMBLE_LANES] += (x[k] - mean) * (x[k] - mean);
+    return lane_reduce(lanes);
+}
+
+static double lane_dot(const double* restrict x, const double* restrict y, int n) {
+    double lanes[ENSEMBLE_LANES] = { 0.0 };
+    int k = 0;
+    for (; k + ENSEMBLE_LANES <= n; k += ENSEMBLE_LANES) {
+        for (int l = 0; l < ENSEMBLE_LANES; l++) lanes[l] += x[k + l] * y[k + l];
+    }
+    for (; k < n; k++) lanes[k % ENSEMBLE_LANES] += x[k] * y[k];
+    return lane_reduce(lanes);
+}
+
+static void tile_advance_chunk(void* context, int chunk) {
+    EnsembleTile* tile = (EnsembleTile*)context;
+    const EnsembleMembers* members = tile->config->members;
+    long long first = (long long)chunk * ENSEMBLE_CHUNK;
+    int n = (int)((tile->num_members - first < ENSEMBLE_CHUNK) ? tile->num_members - first : ENSEMBLE_CHUNK);
+    double exact[ENSEMBLE_CHUNK];
+
+    for (int r = 0; r < tile->tile_rows; r++) {
+        int row = tile->first_row + r;
+        double* values = tile->tile + (size_t)r * (size_t)tile->num_members + (size_t)first;
+        if (row == 0) {
+            memcpy(values, tile->N + first, (size_t)n * sizeof(double));
+        } else {
+            lockstep_advance(tile->N + first, tile->factor + first, values, n);
+        }
+
+        // Dua lintasan pada chunk yang masih di cache
+        double mean = lane_sum(values, n) / (double)n;
+        double m2 = lane_squared_deviation(values, mean, n);
+
+        double neg_tau = -(tile->results->time_s[row] - tile->config->t_initial);
+        const double* lambda = members->lambda + first;
+        for (int k = 0; k < n; k++) exact[k] = lambda[k] * neg_tau;
+        vexp_array(exact, exact, (size_t)n);
+        double analytical_sum = lane_dot(members->N0 + first, exact, n);
+
+        ChunkMoments* moments = tile->partial + (size_t)chunk * (size_t)tile->tile_rows + (size_t)r;
+        moments->mean = mean;
+        moments->m2 = m2;
+        moments->analytical_sum = analytical_sum;
+    }
+}
+
+static void tile_select_row(void* context, int r) {
+    EnsembleTile* tile = (EnsembleTile*)context;
+    EnsembleResults* results = tile->results;
+    int row = tile->first_row + r;
+    double* values = tile->tile + (size_t)r * (size_t)tile->num_members;
+    double quantiles[ENSEMBLE_MAX_QUANTILES];
+    row_quantiles(values, tile->num_members, results->quantile_p, results->num_quantiles, quantiles);
+    for (int q = 0; q < results->num_quantiles; q++) results->quantile[q][row] = quantiles[q];
+}
+
+/**
+ * HASIL
+ * =====
+ */
+void ensemble_results_free(EnsembleResults* results) {
+    simulation_block_free(results->block);
+    memset(results, 0, sizeof(*results));
+}
+
+static int ensemble_results_allocate(EnsembleResults* results, int num_rows, int num_quantiles) {
+    memset(results, 0, sizeof(*results));
+    int num_columns = 5 + num_quantiles;
+    size_t column_bytes = ((size_t)num_rows * sizeof(double) + RESULTS_CACHE_LINE - 1)
+                          / RESULTS_CACHE_LINE * RESULTS_CACHE_LINE;
+    char* base = (char*)simulation_block_alloc((size_t)num_columns * column_bytes, &results->bytes_allocated);
+    if (base == NULL) return 0;
+
+    results->block = base;
+    results->time_s = (double*)(base + 0 * column_bytes);
+    results->N_mean = (double*)(base + 1 * column_bytes);
+    results->N_stddev = (double*)(base + 2 * column_bytes);
+    results->N_analytical_mean = (double*)(base + 3 * column_bytes);
+    results->error_relative_percent = (double*)(base + 4 * column_bytes);
+    for (int q = 0; q < num_quantiles; q++) {
+        results->quantile[q] = (double*)(base + (size_t)(5 + q) * column_bytes);
+    }
+    results->num_rows = num_rows;
+    results->num_quantiles = num_quantiles;
+    return 1;
+}
+
+int ensemble_simulate(const EnsembleConfig* config, EnsembleResults* results) {
+    const EnsembleMembers* members = config->members;
+    if (members == NULL || members->num_members < 1 || config->delta_t <= 0.0) {
+        printf("Error: Konfigurasi ensemble tidak valid (jumlah anggota dan delta_t harus positif).\n");
+        return 0;
+    }
+    if (config->num_quantiles < 0 || config->num_quantiles > ENSEMBLE_MAX_QUANTILES) {
+        printf("Error: Jumlah kuantil ensemble harus 0..%d.\n", ENSEMBLE_MAX_QUANTILES);
+        return 0;
+    }
+    for (int q = 0; q < config->num_quantiles; q++) {
+        if (!(config->quantiles[q] >= 0.0 && config->quantiles[q] <= 1.0)) {
+            printf("Error: Kuantil ensemble harus di [0, 1].\n");
+            return 0;
+        }
+    }
+
+    long long M = members->num_members;
+    int num_steps = euler_step_count(config->t_initial, config->t_final, config->delta_t);
+    int rows = num_steps + 1;
+    if (!ensemble_results_allocate(results, rows, config->num_quantiles)) {
+        printf("Error: Gagal mengalokasikan memori untuk hasil ensemble.\n");
+        return 0;
+    }
+    results->num_members = M;
+    memcpy(results->quantile_p, config->quantiles, (size_t)config->num_quantiles * sizeof(double));
+
+    double current_t = config->t_initial;
+    for (int row = 0; row < rows; row++) {
+        results->time_s[row] = current_t;
+        current_t = current_t + config->delta_t;
+    }
+
+    // Kelompok baris sebesar mungkin di bawah ENSEMBLE_MAX_TILE_BYTES
+    long long tile_rows = (long long)(ENSEMBLE_MAX_TILE_BYTES / ((size_t)M * sizeof(double)));
+    if (tile_rows < 1) tile_rows = 1;
+    if (tile_rows > rows) tile_rows = rows;
+
+    EnsembleTile tile;
+    memset(&tile, 0, sizeof(tile));
+    tile.config = config;
+    tile.results = results;
+    tile.num_members = M;
+    tile.num_chunks = ensemble_num_chunks(M);
+
+    size_t state_bytes = ((size_t)M * sizeof(double) + RESULTS_CACHE_LINE - 1)
+                         / RESULTS_CACHE_LINE * RESULTS_CACHE_LINE;
+    size_t state_allocated, tile_allocated;
+    char* state = (char*)simulation_block_alloc(2 * state_bytes, &state_allocated);
+    tile.tile = (double*)simulation_block_alloc((size_t)tile_rows * (size_t)M * sizeof(double),
+                                                &tile_allocated);
+    tile.partial = (ChunkMoments*)malloc((size_t)tile.num_chunks * (size_t)tile_rows * sizeof(ChunkMoments));
+    if (state == NULL || tile.tile == NULL || tile.partial == NULL) {
+        printf("Error: Gagal mengalokasikan memori untuk state ensemble.\n");
+        simulation_block_free(state);
+        simulation_block_free(tile.tile);
+        free(tile.partial);
+        ensemble_results_free(results);
+        return 0;
+    }
+    tile.N = (double*)state;
+    tile.factor = (double*)(state + state_bytes);
+
+    // Faktor amplifikasi per anggota dihitung sekali
+    for (long long j = 0; j < M; j++) {
+        tile.N[j] = members->N0[j];
+        tile.factor[j] = integrator_amplification(config->method, -members->lambda[j] * config->delta_t);
+    }
+
+    for (int first_row = 0; first_row < rows; first_row += (int)tile_rows) {
+        tile.first_row = first_row;
+        tile.tile_rows = (rows - first_row < tile_rows) ? rows - first_row : (int)tile_rows;
+
+        ensemble_run_tasks(tile.num_chunks, config->num_threads, tile_advance_chunk, &tile);
+        if (config->num_quantiles > 0) {
+            ensemble_run_tasks(tile.tile_rows, config->num_threads, tile_select_row, &tile);
+        }
+
+        // Gabungan chunk dalam urutan indeks (Chan dkk.)
+        for (int r = 0; r < tile.tile_rows; r++) {
+            double count = 0.0, mean = 0.0, m2 = 0.0, analytical_sum = 0.0;
+            for (int chunk = 0; chunk < tile.num_chunks; chunk++) {
+                const ChunkMoments* moments = tile.partial + (size_t)chunk * (size_t)tile.tile_rows + (size_t)r;
+                double chunk_count = (double)((M - (long long)chunk * ENSEMBLE_CHUNK < ENSEMBLE_CHUNK)
+                                              ? M - (long long)chunk * ENSEMBLE_CHUNK : ENSEMBLE_CHUNK);
+                double total = count + chunk_count;
+                double delta = moments->mean - mean;
+                mean += delta * (chunk_count / total);
+                m2 += moments->m2 + delta * delta * (count * chunk_count / total);
+                analytical_sum += moments->analytical_sum;
+                count = total;
+            }
+            int row = first_row + r;
+            double analytical_mean = analytical_sum / (double)M;
+            results->N_mean[row] = mean;
+            results->N_stddev[row] = (M > 1) ? sqrt(m2 / (double)(M - 1)) : 0.0;
+            results->N_analytical_mean[row] = analytical_mean;
+            results->error_relative_percent[row] = (analytical_mean != 0.0)
+                ? fabs(mean - analytical_mean) / analytical_mean * 100.0
+                : 0.0;
+        }
+    }
+
+    simulation_block_free(state);
+    simulation_block_free(tile.tile);
+    free(tile.partial);
+    return num_steps;
+}
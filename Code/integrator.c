@@ -0,0 +1,375 @@
+/**
+ * ========================================================================
+ * IMPLEMENTASI INTEGRATOR
+ * ========================================================================
+ *
+ * Lihat integrator.h untuk daftar metode. Step eksplisit ditulis dalam
+ * bentuk tahap Runge-Kutta biasa (k_i = f(N + h * Σ a_ij k_j)) agar
+ * strukturnya sama dengan metode untuk persamaan umum; step implisit
+ * menuliskan persamaan implisitnya lalu menyelesaikannya secara eksak
+ * (untuk f linear, solve adalah satu pembagian).
+ */
+
+#include "integrator.h"
+
+#include <complex.h>
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+// Ruas kanan persamaan peluruhan: f(N) = dN/dt = -λN
+static inline double decay_rhs(double lambda, double N) {
+    return -lambda * N;
+}
+
+/**
+ * METODE EULER
+ * ============
+ * N_{n+1} = N_n + h * f(N_n)
+ */
+static double euler_step(double lambda, double N, double h) {
+    return N + h * decay_rhs(lambda, N);
+}
+
+/**
+ * METODE HEUN (TRAPESIUM EKSPLISIT)
+ * =================================
+ * k1 = f(N), k2 = f(N + h k1), N_{n+1} = N_n + h/2 * (k1 + k2)
+ */
+static double heun_step(double lambda, double N, double h) {
+    double k1 = decay_rhs(lambda, N);
+    double k2 = decay_rhs(lambda, N + h * k1);
+    return N + 0.5 * h * (k1 + k2);
+}
+
+/**
+ * METODE RUNGE-KUTTA KLASIK (RK4)
+ * ===============================
+ */
+static double rk4_step(double lambda, double N, double h) {
+    double k1 = decay_rhs(lambda, N);
+    double k2 = decay_rhs(lambda, N + 0.5 * h * k1);
+    double k3 = decay_rhs(lambda, N + 0.5 * h * k2);
+    double k4 = decay_rhs(lambda, N + h * k3);
+    return N + (h / 6.0) * (k1 + 2.0 * k2 + 2.0 * k3 + k4);
+}
+
+/**
+ * METODE DORMAND-PRINCE 5(4) DENGAN STEP TETAP
+ * ============================================
+ * Tabel Butcher Dormand & Prince (1980); solusi orde 5 (baris b sama dengan
+ * baris tahap ke-7, sifat FSAL). Tahap ke-7 hanya dibutuhkan untuk estimasi
+ * error orde 4, sehingga step tetap cukup 6 evaluasi f.
+ */
+// Tahap 2..6 dan solusi orde 5; k[0] = f(N) sudah diisi pemanggil
+static double dp45_stages_from_first(double lambda, double N, double h, double k[6]) {
+    k[1] = decay_rhs(lambda, N + h * (1.0 / 5.0) * k[0]);
+    k[2] = decay_rhs(lambda, N + h * ((3.0 / 40.0) * k[0] + (9.0 / 40.0) * k[1]));
+    k[3] = decay_rhs(lambda, N + h * ((44.0 / 45.0) * k[0] - (56.0 / 15.0) * k[1] + (32.0 / 9.0) * k[2]));
+    k[4] = decay_rhs(lambda, N + h * ((19372.0 / 6561.0) * k[0] - (25360.0 / 2187.0) * k[1]
+                                      + (64448.0 / 6561.0) * k[2] - (212.0 / 729.0) * k[3]));
+    k[5] = decay_rhs(lambda, N + h * ((9017.0 / 3168.0) * k[0] - (355.0 / 33.0) * k[1]
+                                      + (46732.0 / 5247.0) * k[2] + (49.0 / 176.0) * k[3]
+                                      - (5103.0 / 18656.0) * k[4]));
+    return N + h * ((35.0 / 384.0) * k[0] + (500.0 / 1113.0) * k[2] + (125.0 / 192.0) * k[3]
+                    - (2187.0 / 6784.0) * k[4] + (11.0 / 84.0) * k[5]);
+}
+
+static double dp45_stages(double lambda, double N, double h, double k[6]) {
+    k[0] = decay_rhs(lambda, N);
+    return dp45_stages_from_first(lambda, N, h, k);
+}
+
+static double rk45_step(double lambda, double N, double h) {
+    double k[6];
+    return dp45_stages(lambda, N, h, k);
+}
+
+/**
+ * ESTIMASI ERROR TERTANAM
+ * =======================
+ * y4 memakai bobot b* = (5179/57600, 0, 7571/16695, 393/640, -92097/339200,
+ * 187/2100, 1/40); y5 - y4 = h * Σ (b_i - b*_i) k_i dengan k7 = f(y5).
+ */
+double integrator_dp45_fsal_step(double lambda, double N, double k1, double h,
+                                 double* error_estimate, double* k7) {
+    double k[6];
+    k[0] = k1;
+    double N_next = dp45_stages_from_first(lambda, N, h, k);
+    *k7 = decay_rhs(lambda, N_next);
+    *error_estimate = h * ((71.0 / 57600.0) * k[0] - (71.0 / 16695.0) * k[2] + (71.0 / 1920.0) * k[3]
+                           - (17253.0 / 339200.0) * k[4] + (22.0 / 525.0) * k[5] - (1.0 / 40.0) * *k7);
+    return N_next;
+}
+
+double integrator_dp45_embedded_step(double lambda, double N, double h, double* error_estimate) {
+    double k7;
+    return integrator_dp45_fsal_step(lambda, N, decay_rhs(lambda, N), h, error_estimate, &k7);
+}
+
+/**
+ * METODE EULER IMPLISIT (BACKWARD EULER)
+ * ======================================
+ * N_{n+1} = N_n + h * f(N_{n+1}) = N_n - hλ N_{n+1}
+ *   => N_{n+1} = N_n / (1 + λh)
+ */
+static double backward_euler_step(double lambda, double N, double h) {
+    return N / (1.0 + h * lambda);
+}
+
+/**
+ * METODE CRANK-NICOLSON (TRAPESIUM IMPLISIT)
+ * ==========================================
+ * N_{n+1} = N_n + h/2 * (f(N_n) + f(N_{n+1}))
+ *   => N_{n+1} = N_n * (1 - λh/2) / (1 + λh/2)
+ */
+static double crank_nicolson_step(double lambda, double N, double h) {
+    double half = 0.5 * h * lambda;
+    return N * (1.0 - half) / (1.0 + half);
+}
+
+/**
+ * METODE EULER EKSPONENSIAL
+ * =========================
+ * Untuk dN/dt = -λN + g(N): N_{n+1} = e^(-λh) N_n + h φ1(-λh) g(N_n) dengan
+ * φ1(z) = (e^z - 1) / z. Peluruhan murni tidak memiliki suku g, sehingga
+ * step menjadi N_n * e^(-λh) (eksak). Suku sumber muncul pada rantai
+ * peluruhan, di mana g adalah laju pembentukan dari induk.
+ */
+static double exponential_euler_step(double lambda, double N, double h) {
+    return N * exp(-lambda * h);
+}
+
+/**
+ * CHEBYSHEV RATIONAL APPROXIMATION METHOD (CRAM) ORDE 16
+ * ======================================================
+ * Kutub θ_j dari Pusa (2011), "Rational Approximations to the Matrix
+ * Exponential in Burnup Calculations". Residu α_j dan α0 dihitung ulang
+ * dengan fitting kuadrat terkecil presisi extended terhadap e^x pada
+ * (-∞, 0] dengan kutub tersebut: error maksimum 3.7e-16 (presisi extended),
+ * 2.2e-14 bila dievaluasi dalam double (pembatalan antar suku |α_j| ~ 200).
+ */
+const double integrator_cram_alpha0 = 1.03361863459771787e-16;
+
+const double integrator_cram_theta[CRAM_NUM_POLES][2] = {
+    { +3.509103608414918e+00, +8.436198985884374e+00 },
+    { +5.948152268951177e+00, +3.587457362018322e+00 },
+    { -5.264971343442647e+00, +1.622022147316793e+01 },
+    { +1.419375897185666e+00, +1.092536348449672e+01 },
+    { +6.416177699099435e+00, +1.194122393370139e+00 },
+    { +4.993174737717997e+00, +5.996881713603942e+00 },
+    { -1.413928462488886e+00, +1.349772569889275e+01 },
+    { -1.084391707869699e+01, +1.927744616718165e+01 }
+};
+
+const double integrator_cram_alpha[CRAM_NUM_POLES][2] = {
+    { +1.50595852667211201e+01, -5.75140527852550835e+00 },
+    { +1.13397751792516156e+02, +1.01947217047166743e+02 },
+    { +2.11517407404916329e-04, +4.38929688985293402e-03 },
+    { -1.47930071148474641e+00, +1.76865883379267802e+00 },
+    { -6.45008780327726459e+01, -2.24594407618240707e+02 },
+    { -6.25183924606172469e+01, -1.11903910999936343e+01 },
+    { +4.10231372526346727e-02, -1.57434661764174029e-01 },
+    { -5.09021357390027348e-07, -2.42200166262469509e-05 }
+};
+
+// R(z) CRAM untuk z real
+static double cram_rational(double z) {
+    double complex sum = 0.0;
+    for (int j = 0; j < CRAM_NUM_POLES; j++) {
+        double complex alpha = integrator_cram_alpha[j][0] + integrator_cram_alpha[j][1] * I;
+        double complex theta = integrator_cram_theta[j][0] + integrator_cram_theta[j][1] * I;
+        sum += alpha / (z - theta);
+    }
+    return integrator_cram_alpha0 + 2.0 * creal(sum);
+}
+
+static double cram_step(double lambda, double N, double h) {
+    return N * cram_rational(-lambda * h);
+}
+
+/**
+ * TABEL METODE
+ * ============
+ */
+static const IntegratorInfo integrators[INTEGRATOR_COUNT] = {
+    { INTEGRATOR_EULER, "euler", "Euler",                1, 1, 2.0,    euler_step },
+    { INTEGRATOR_HEUN,  "heun",  "Heun",                 2, 2, 2.0,    heun_step },
+    { INTEGRATOR_RK4,   "rk4",   "Runge-Kutta Orde 4",   4, 4, 2.7853, rk4_step },
+    { INTEGRATOR_RK45,  "rk45",  "Dormand-Prince RK45",  5, 6, 3.3066, rk45_step },
+    { INTEGRATOR_BACKWARD_EULER, "backward-euler", "Euler Implisit (Backward Euler)",
+      1, 1, 0.0, backward_euler_step },
+    { INTEGRATOR_CRANK_NICOLSON, "crank-nicolson", "Crank-Nicolson (Trapesium Implisit)",
+      2, 1, 0.0, crank_nicolson_step },
+    { INTEGRATOR_EXPONENTIAL_EULER, "exp-euler", "Euler Eksponensial",
+      1, 1, 0.0, exponential_euler_step },
+    { INTEGRATOR_CRAM, "cram", "CRAM Orde 16 (Chebyshev Rational Approximation)",
+      16, CRAM_NUM_POLES, 0.0, cram_step }
+};
+
+const IntegratorInfo* integrator_info(IntegratorMethod method) {
+    if ((int)method < 0 || method >= INTEGRATOR_COUNT) method = INTEGRATOR_EULER;
+    return &integrators[method];
+}
+
+int integrator_from_name(const char* name, IntegratorMethod* method) {
+    for (int m = 0; m < INTEGRATOR_COUNT; m++) {
+        if (strcmp(name, integrators[m].name) == 0) {
+            *method = (IntegratorMethod)m;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * FAKTOR AMPLIFIKASI R(z)
+ * =======================
+ * Untuk metode RK eksplisit s tahap orde p <= 4, R(z) adalah deret Taylor e^z
+ * terpotong di z^p. Dormand-Prince orde 5 dengan 6 tahap efektif memiliki
+ * suku tambahan z^6/600. Metode implisit memiliki R(z) rasional.
+ */
+double integrator_amplification(IntegratorMethod method, double z) {
+    switch (method) {
+        case INTEGRATOR_BACKWARD_EULER:
+            return 1.0 / (1.0 - z);
+        case INTEGRATOR_CRANK_NICOLSON:
+            return (1.0 + z / 2.0) / (1.0 - z / 2.0);
+        case INTEGRATOR_EXPONENTIAL_EULER:
+            return exp(z);
+        case INTEGRATOR_CRAM:
+            return cram_rational(z);
+        case INTEGRATOR_HEUN:
+            return 1.0 + z * (1.0 + z / 2.0);
+        case INTEGRATOR_RK4:
+            return 1.0 + z * (1.0 + z * (1.0 / 2.0 + z * (1.0 / 6.0 + z / 24.0)));
+        case INTEGRATOR_RK45:
+            return 1.0 + z * (1.0 + z * (1.0 / 2.0 + z * (1.0 / 6.0 + z * (1.0 / 24.0
+                       + z * (1.0 / 120.0 + z / 600.0)))));
+        default:
+            return 1.0 + z;
+    }
+}
+
+/**
+ * PENGONTROL STEP ADAPTIF
+ * =======================
+ */
+
+// Konstanta pengontrol standar untuk estimator orde 4 (eksponen 1/5)
+#define ADAPTIVE_SAFETY 0.9
+#define ADAPTIVE_MIN_FACTOR 0.2
+#define ADAPTIVE_MAX_FACTOR 5.0
+
+// Faktor perubahan step dari error ternormalisasi (err <= 1 berarti diterima)
+static double step_factor(double err) {
+    if (err == 0.0) return ADAPTIVE_MAX_FACTOR;
+    double factor = ADAPTIVE_SAFETY * pow(err, -1.0 / 5.0);
+    if (factor < ADAPTIVE_MIN_FACTOR) factor = ADAPTIVE_MIN_FACTOR;
+    if (factor > ADAPTIVE_MAX_FACTOR) factor = ADAPTIVE_MAX_FACTOR;
+    return factor;
+}
+
+// Step awal otomatis: h0 dari skala N / dN/dt, dikoreksi dengan turunan kedua
+// yang diestimasi dari satu step Euler percobaan (2 evaluasi f)
+static double initial_step(AdaptiveStepper* stepper, double N0) {
+    double scale = stepper->control.atol + stepper->control.rtol * fabs(N0);
+    double f0 = decay_rhs(stepper->lambda, N0);
+    double d0 = fabs(N0) / scale;
+    double d1 = fabs(f0) / scale;
+    double h0 = (d0 < 1e-5 || d1 < 1e-5) ? 1e-6 : 0.01 * d0 / d1;
+
+    double f1 = decay_rhs(stepper->lambda, N0 + h0 * f0);
+    double d2 = fabs(f1 - f0) / scale / h0;
+    stepper->stats.function_evaluations += 2;
+
+    double d_max = (d1 > d2) ? d1 : d2;
+    double h1 = (d_max <= 1e-15) ? fmax(1e-6, h0 * 1e-3) : pow(0.01 / d_max, 1.0 / 5.0);
+    return fmin(100.0 * h0, h1);
+}
+
+void adaptive_stepper_init(AdaptiveStepper* stepper, double lambda, double N0,
+                           double t_initial, double t_final, const AdaptiveControl* control) {
+    stepper->lambda = lambda;
+    stepper->t_final = t_final;
+    stepper->control = *control;
+    stepper->failed = 0;
+    stepper->fsal_valid = 0;
+    stepper->stats.accepted_steps = 0;
+    stepper->stats.rejected_steps = 0;
+    stepper->stats.function_evaluations = 0;
+    stepper->stats.h_smallest = 0.0;
+    stepper->stats.h_largest = 0.0;
+
+    double h = (control->h_initial > 0.0) ? control->h_initial : initial_step(stepper, N0);
+    if (control->h_max > 0.0 && h > control->h_max) h = control->h_max;
+    if (h > t_final - t_initial) h = t_final - t_initial;
+    stepper->h = h;
+}
+
+int adaptive_stepper_advance(AdaptiveStepper* stepper, double* N, double* t) {
+    double remaining = stepper->t_final - *t;
+    if (stepper->failed || remaining <= 0.0) return 0;
+    if (stepper->stats.accepted_steps >= ADAPTIVE_MAX_STEPS) {
+        stepper->failed = 1;
+        return 0;
+    }
+
+    // Step di bawah resolusi t tidak lagi memajukan waktu
+    double h_floor = 16.0 * DBL_EPSILON * fmax(fabs(*t), fabs(stepper->t_final));
+    int just_rejected = 0;
+
+    for (;;) {
+        int last_step = stepper->h >= remaining;
+        double h = last_step ? remaining : stepper->h;
+        if (h < h_floor) {
+            stepper->failed = 1;
+            return 0;
+        }
+
+        // Tahap pertama f(N) dipakai ulang: dari tahap ke-7 step yang
+        // diterima (FSAL) atau dari percobaan yang ditolak pada N yang sama,
+        // sehingga setiap percobaan setelah yang pertama membayar 6 evaluasi
+        if (!stepper->fsal_valid || stepper->fsal_N != *N) {
+            stepper->fsal_k = decay_rhs(stepper->lambda, *N);
+            stepper->fsal_N = *N;
+            stepper->fsal_valid = 1;
+            stepper->stats.function_evaluations++;
+        }
+        double error_estimate, k7;
+        double N_next = integrator_dp45_fsal_step(stepper->lambda, *N, stepper->fsal_k, h,
+                                                  &error_estimate, &k7);
+        stepper->stats.function_evaluations += 6;
+
+        double scale = stepper->control.atol + stepper->control.rtol * fmax(fabs(*N), fabs(N_next));
+        double err = fabs(error_estimate) / scale;
+        double factor = step_factor(err);
+
+        if (err <= 1.0) {
+            // STEP DITERIMA
+            *N = N_next;
+            stepper->fsal_N = N_next;
+            stepper->fsal_k = k7;
+            *t = last_step ? stepper->t_final : *t + h;
+
+            AdaptiveStats* stats = &stepper->stats;
+            if (stats->accepted_steps == 0 || h < stats->h_smallest) stats->h_smallest = h;
+            if (h > stats->h_largest) stats->h_largest = h;
+            stats->accepted_steps++;
+
+            if (just_rejected && factor > 1.0) factor = 1.0;
+            double h_next = h * factor;
+            if (stepper->control.h_max > 0.0 && h_next > stepper->control.h_max) {
+                h_next = stepper->control.h_max;
+            }
+            // Step terakhir yang dipotong tidak mengecilkan step percobaan
+            stepper->h = (last_step && h_next < stepper->h) ? stepper->h : h_next;
+            return 1;
+        }
+
+        // STEP DITOLAK: ulangi dari state yang sama dengan h lebih kecil
+        stepper->stats.rejected_steps++;
+        stepper->h = h * factor;
+        just_rejected = 1;
+    }
+}
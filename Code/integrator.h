@@ -0,0 +1,203 @@
+/**
+ * ========================================================================
+ * MODUL INTEGRATOR UNTUK dN/dt = -λN
+ * ========================================================================
+ *
+ * Setiap metode didefinisikan oleh fungsi step dan faktor amplifikasi R(z),
+ * z = -λΔt. Untuk persamaan linear ini satu step dari N menghasilkan
+ * N * R(z) secara eksak (hingga pembulatan), sehingga R(z) dipakai juga oleh
+ * mode evaluasi langsung dan oleh verifikasi.
+ *
+ * Metode eksplisit (bentuk tahap Runge-Kutta standar dengan f(N) = -λN):
+ *
+ *   euler          : Euler maju,                         orde 1, 1 tahap
+ *   heun           : Heun (trapesium eksplisit),         orde 2, 2 tahap
+ *   rk4            : Runge-Kutta klasik,                 orde 4, 4 tahap
+ *   rk45           : Dormand-Prince 5(4), solusi orde 5 dengan step tetap, 6 tahap
+ *
+ * Metode eksplisit stabil hanya jika |R(z)| <= 1; untuk z real negatif batas
+ * tersebut kira-kira λΔt <= 2 (euler, heun), 2.79 (rk4), dan 3.31 (rk45).
+ * Nuklida anak berumur pendek (Po-218, Pb-214) melewati batas ini pada Δt
+ * beberapa menit, sehingga untuk rantai peluruhan tersedia metode stabil
+ * untuk semua Δt (persamaan implisit linear diselesaikan eksak):
+ *
+ *   backward-euler : Euler implisit, R(z) = 1 / (1 - z),           orde 1
+ *   crank-nicolson : trapesium implisit, R(z) = (1 + z/2) / (1 - z/2), orde 2
+ *   exp-euler      : Euler eksponensial, R(z) = e^z,                orde 1
+ *   cram           : Chebyshev Rational Approximation Method orde 16,
+ *                    R(z) rasional (16, 16) dengan |R(x) - e^x| <= 2.2e-14
+ *                    untuk semua x <= 0 bila dievaluasi dalam double
+ *                    (3.7e-16 dalam presisi extended)
+ *
+ * Backward Euler dan Euler eksponensial juga meredam komponen kaku
+ * (R(z) -> 0 untuk z -> -∞); Crank-Nicolson stabil tetapi R(z) -> -1,
+ * sehingga komponen yang sangat kaku berosilasi tanpa teredam. Euler
+ * eksponensial mengintegrasikan suku linear secara eksak, sehingga untuk
+ * dN/dt = -λN hasilnya sama dengan solusi analitik hingga pembulatan.
+ * CRAM mendekati e^z itu sendiri, sehingga untuk sistem linear (rantai dan
+ * jaringan peluruhan, lihat network.h) satu step dengan Δt berapa pun
+ * menghasilkan exp(AΔt) N hingga akurasi pendekatan tersebut.
+ *
+ * Modul ini juga berisi pengontrol step adaptif berbasis pasangan tertanam
+ * Dormand-Prince 5(4): step diterima jika estimasi error lokal berada di
+ * bawah atol + rtol * |N|, dan ukuran step berikutnya dipilih dari estimasi
+ * tersebut.
+ */
+
+#ifndef INTEGRATOR_H
+#define INTEGRATOR_H
+
+/**
+ * METODE INTEGRASI YANG TERSEDIA
+ */
+typedef enum {
+    INTEGRATOR_EULER = 0,
+    INTEGRATOR_HEUN = 1,
+    INTEGRATOR_RK4 = 2,
+    INTEGRATOR_RK45 = 3,
+    INTEGRATOR_BACKWARD_EULER = 4,
+    INTEGRATOR_CRANK_NICOLSON = 5,
+    INTEGRATOR_EXPONENTIAL_EULER = 6,
+    INTEGRATOR_CRAM = 7,
+    INTEGRATOR_COUNT
+} IntegratorMethod;
+
+/**
+ * Satu step metode untuk dN/dt = -λN: mengembalikan N(t + h) dari N(t).
+ */
+typedef double (*IntegratorStepFn)(double lambda, double N, double h);
+
+/**
+ * DESKRIPSI SATU METODE
+ */
+typedef struct {
+    IntegratorMethod method;
+    const char* name;                 // Nama pendek untuk CLI dan file ("rk4")
+    const char* display_name;         // Nama untuk judul keluaran konsol
+    int order;                        // Orde akurasi global
+    int stages;                       // Evaluasi f (atau solve / exp) per step
+    double stability_limit;           // Batas λΔt untuk |R(-λΔt)| <= 1; 0 = stabil untuk semua Δt
+    IntegratorStepFn step;
+} IntegratorInfo;
+
+/**
+ * Deskripsi metode (metode tidak dikenal menghasilkan Euler).
+ */
+const IntegratorInfo* integrator_info(IntegratorMethod method);
+
+/**
+ * Mencari metode berdasarkan nama pendek.
+ *
+ * @return int - 1 jika ditemukan, 0 jika nama tidak dikenal
+ */
+int integrator_from_name(const char* name, IntegratorMethod* method);
+
+/**
+ * Faktor amplifikasi R(z) metode untuk z = -λΔt (polinomial stabilitas).
+ */
+double integrator_amplification(IntegratorMethod method, double z);
+
+/**
+ * KOEFISIEN CRAM ORDE 16
+ * ======================
+ *
+ * Bentuk pecahan parsial R(z) = α0 + 2 Re Σ_{j<8} α_j / (z - θ_j); delapan
+ * kutub lainnya adalah konjugat θ_j. Untuk matriks A (Pusa & Leppänen, 2010):
+ *
+ *   exp(AΔt) N ≈ α0 N + 2 Re Σ_j (AΔt - θ_j I)^{-1} α_j N
+ *
+ * Bilangan kompleks disimpan sebagai { real, imajiner }.
+ */
+#define CRAM_NUM_POLES 8
+
+extern const double integrator_cram_alpha0;
+extern const double integrator_cram_theta[CRAM_NUM_POLES][2];
+extern const double integrator_cram_alpha[CRAM_NUM_POLES][2];
+
+/**
+ * PASANGAN TERTANAM DORMAND-PRINCE 5(4)
+ * =====================================
+ *
+ * Satu step rk45 (hasil identik bit-per-bit dengan fungsi step rk45) beserta
+ * estimasi error lokal y5 - y4 dari bobot orde 4 b*. Tahap ke-7 dievaluasi
+ * pada y5 dan dapat dipakai ulang sebagai tahap pertama step berikutnya (FSAL).
+ *
+ * @param error_estimate      - Keluaran: y5 - y4 (atom, bertanda)
+ *
+ * @return double - N(t + h) orde 5
+ */
+double integrator_dp45_embedded_step(double lambda, double N, double h, double* error_estimate);
+
+/**
+ * Sama seperti integrator_dp45_embedded_step dengan tahap pertama k1 = f(N)
+ * dari pemanggil (FSAL): hanya 6 evaluasi f. Tahap ke-7 f(y5) dikembalikan
+ * lewat k7 untuk menjadi k1 step berikutnya.
+ */
+double integrator_dp45_fsal_step(double lambda, double N, double k1, double h,
+                                 double* error_estimate, double* k7);
+
+/**
+ * KONTROL STEP ADAPTIF
+ * ====================
+ *
+ * Step diterima jika |y5 - y4| <= atol + rtol * max(|N_n|, |N_{n+1}|).
+ * Step berikutnya h * clamp(0.9 * err^(-1/5), 0.2, 5), dengan faktor
+ * maksimum 1 tepat setelah penolakan.
+ */
+typedef struct {
+    double atol;                      // Toleransi absolut (atom)
+    double rtol;                      // Toleransi relatif
+    double h_initial;                 // Step percobaan pertama (s); <= 0 = otomatis
+    double h_max;                     // Batas atas step (s); <= 0 = tanpa batas
+} AdaptiveControl;
+
+// Batas jumlah step yang diterima (jumlah baris hasil harus muat di int)
+#define ADAPTIVE_MAX_STEPS 100000000
+
+/**
+ * STATISTIK SATU RUN ADAPTIF
+ */
+typedef struct {
+    int accepted_steps;
+    int rejected_steps;
+    long long function_evaluations;   // Evaluasi f = -λN (termasuk pemilihan step awal)
+    double h_smallest;                // Step diterima terkecil (s)
+    double h_largest;                 // Step diterima terbesar (s)
+} AdaptiveStats;
+
+/**
+ * STATE PENGONTROL STEP
+ */
+typedef struct {
+    double lambda;
+    double t_final;
+    AdaptiveControl control;
+    double h;                         // Step percobaan berikutnya (s)
+    int failed;                       // 1 jika step menyusut di bawah resolusi t atau melebihi batas
+    int fsal_valid;                   // 1 jika fsal_k = f(fsal_N) tersedia
+    double fsal_N;
+    double fsal_k;                    // Tahap pertama step berikutnya (FSAL)
+    AdaptiveStats stats;
+} AdaptiveStepper;
+
+/**
+ * Menyiapkan pengontrol untuk integrasi dari (t_initial, N0) ke t_final.
+ * Jika control->h_initial <= 0, step awal dipilih otomatis dari skala N0
+ * dan dN/dt (Hairer, Nørsett & Wanner, Solving ODEs I, II.4).
+ */
+void adaptive_stepper_init(AdaptiveStepper* stepper, double lambda, double N0,
+                           double t_initial, double t_final, const AdaptiveControl* control);
+
+/**
+ * Melakukan satu step yang diterima (mengulang step yang ditolak dengan h
+ * lebih kecil). Step terakhir dipotong agar berakhir tepat di t_final.
+ *
+ * @param N                   - N saat ini; diperbarui ke N setelah step
+ * @param t                   - t saat ini; diperbarui ke t setelah step
+ *
+ * @return int - 1 jika satu step diterima, 0 jika t_final sudah tercapai
+ *               atau pengontrol gagal (stepper->failed)
+ */
+int adaptive_stepper_advance(AdaptiveStepper* stepper, double* N, double* t);
+
+#endif // INTEGRATOR_H
@@ -19,273 +19,1824 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 
+#include "chain.h"
+#include "cli.h"
+#include "convergence.h"
+#include "ensemble.h"
+#include "integrator.h"
+#include "network.h"
+#include "nuclide.h"
+#include "output.h"
+#include "simulation.h"
+#include "stats.h"
+#include "stochastic.h"
+#include "sweep.h"
+#include "task_pool.h"
+
+// File tabel ringkasan sweep (di direktori keluaran)
+#define SWEEP_SUMMARY_FILENAME "sweep_summary.csv"
+
+// Tabel ringkasan di konsol hanya untuk sweep kecil; sweep besar cukup di CSV
+#define SUMMARY_CONSOLE_MAX_ROWS 50
+
+/**
+ * HEADER DAN PENUTUP TABEL KONSOL
+ * ===============================
+ */
+static void print_table_columns(TextBuffer* out) {
+    text_printf(out, "--------------------------------------------------------------------------------------\n");
+    text_printf(out, "| Waktu (s) | N Numerik      | N Analitik     | Error Absolut  | Error Relatif (%%) |\n");
+    text_printf(out, "|-----------|----------------|----------------|----------------|-------------------|\n");
+}
+
+static void print_table_header(TextBuffer* out, const char* isotope, double delta_t) {
+    text_printf(out, "\nSimulasi Peluruhan %s dengan delta_t = %.4f s (%.2f jam):\n", 
+           isotope, delta_t, delta_t/3600.0);
+    print_table_columns(out);
+}
+
+static void print_table_row(TextBuffer* out, const SimulationStep* row) {
+    text_printf(out, "| %9.2f | %14.3e | %14.3e | %14.3e | %17.4f |\n",
+           row->time_s, row->N_numerical, row->N_analytical,
+           row->error_absolute, row->error_relative_percent);
+}
+
+static void print_table_footer(TextBuffer* out) {
+    text_printf(out, "--------------------------------------------------------------------------------------\n");
+}
+
+// Menampilkan 10% step untuk menghindari output terlalu panjang
+static int table_print_interval(int num_rows) {
+    int print_interval = num_rows / 10;
+    return (print_interval < 1) ? 1 : print_interval;
+}
+
 /**
- * STRUKTUR DATA UNTUK MENYIMPAN HASIL SIMULASI
- * ============================================
+ * TAHAP PELAPORAN: TAMPILKAN SAMPEL HASIL KE KONSOL
+ * =================================================
  * 
- * Struktur ini menyimpan data hasil simulasi untuk setiap step waktu,
- * termasuk perbandingan antara hasil numerik dan analitik serta analisis error.
+ * Menampilkan sekitar 10% baris hasil simulasi (ditambah baris terakhir)
+ * dalam bentuk tabel. Dipanggil setelah kernel selesai sehingga loop
+ * integrasi tidak pernah menyentuh I/O terminal.
+ * 
+ * Parameter:
+ * @param out                 - Buffer keluaran konsol kasus ini
+ * @param results             - Kontainer hasil simulasi (AoS atau SoA)
+ * @param isotope             - Nama nuklida, untuk judul tabel
+ * @param delta_t             - Ukuran step waktu (s), untuk judul tabel
  */
-typedef struct {
-    double time_s;                    // Waktu dalam detik
-    double N_numerical;               // Jumlah atom hasil metode Euler
-    double N_analytical;              // Jumlah atom hasil solusi analitik
-    double error_absolute;            // Error absolut = |N_numerik - N_analitik|
-    double error_relative_percent;    // Error relatif dalam persen
-} SimulationStep;
+static void print_simulation_table(TextBuffer* out, const SimulationResults* results, const char* isotope,
+                                   double delta_t) {
+    int num_rows = results->num_rows;
+    int print_interval = table_print_interval(num_rows);
+
+    print_table_header(out, isotope, delta_t);
+    for (int i = 0; i < num_rows; i++) {
+        if (i % print_interval == 0 || i == num_rows - 1) {
+            SimulationStep row = results_row(results, i);
+            print_table_row(out, &row);
+        }
+    }
+    print_table_footer(out);
+}
 
 /**
- * FUNGSI UTAMA UNTUK SIMULASI PELURUHAN RADIOAKTIF MENGGUNAKAN METODE EULER
- * ========================================================================
+ * SINK PENAMPIL SAMPEL TABEL (MODE STREAMING)
+ * ===========================================
  * 
- * Metode Euler adalah metode numerik untuk menyelesaikan persamaan diferensial
- * orde pertama dengan pendekatan:
+ * Versi streaming dari print_simulation_table: baris sampel dicetak per chunk
+ * setelah kernel selesai mengisi chunk tersebut, dengan pola sampling yang
+ * sama sehingga tabel konsol identik dengan mode biasa.
+ */
+typedef struct {
+    TextBuffer* out;
+    int print_interval;
+    int last_row;
+} TableSampler;
+
+static int table_sampler_consume(void* context, const SimulationResults* chunk, int first_row) {
+    TableSampler* sampler = (TableSampler*)context;
+    TextBuffer* out = sampler->out;
+    for (int i = 0; i < chunk->num_rows; i++) {
+        int global_row = first_row + i;
+        if (global_row % sampler->print_interval == 0 || global_row == sampler->last_row) {
+            SimulationStep row = results_row(chunk, i);
+            print_table_row(out, &row);
+        }
+    }
+    return 1;
+}
+
+/**
+ * SINK BERWAKTU (INSTRUMENTASI)
+ * =============================
  * 
- * N(t+Δt) = N(t) + Δt * dN/dt
- * N(t+Δt) = N(t) + Δt * (-λN(t))
- * N(t+Δt) = N(t) * (1 - λΔt)
+ * Membungkus sink lain dan mencatat waktunya sebagai satu fase RunStats
+ * (lihat stats.h); tanpa RunStats terpasang hanya menambah satu pemeriksaan
+ * pointer per chunk.
+ */
+typedef struct {
+    ResultSink inner;
+    StatsPhase phase;
+} TimedSink;
+
+static int timed_sink_consume(void* context, const SimulationResults* chunk, int first_row) {
+    TimedSink* timed = (TimedSink*)context;
+    double start = stats_phase_begin();
+    int ok = timed->inner.consume(timed->inner.context, chunk, first_row);
+    stats_phase_end(timed->phase, start);
+    return ok;
+}
+
+/**
+ * SINK UKURAN CHUNK
+ * =================
+ *
+ * Mencatat ukuran kontainer chunk streaming yang sebenarnya (termasuk
+ * padding baris cache dan kolom SoA), untuk laporan memori puncak.
+ */
+static int chunk_bytes_consume(void* context, const SimulationResults* chunk, int first_row) {
+    (void)first_row;
+    size_t* bytes = (size_t*)context;
+    if (chunk->bytes_allocated > *bytes) *bytes = chunk->bytes_allocated;
+    return 1;
+}
+
+/**
+ * KONFIGURASI BERSAMA SEMUA KASUS SWEEP
+ * =====================================
+ */
+typedef struct {
+    double N0;
+    double lambda;
+    double t_start;
+    double t_end;
+    IntegratorMethod method;
+    EulerEvaluationMode evaluation_mode;
+    ResultLayout result_layout;
+    int write_binary;                 // Tulis juga output_*.bin
+    const DecayChain* chain;          // Rantai peluruhan; NULL = Rn-222 saja
+    int write_csv;                    // Tulis output_*.csv (--format)
+    const char* output_dir;           // Direktori file keluaran; NULL = direktori kerja
+    const char* isotope;              // Nama nuklida untuk judul tabel konsol
+    const double* delta_t_values;     // Seluruh nilai sweep (untuk label nama file)
+    int num_cases;
+} CaseConfig;
+
+// Label delta_t untuk nama file kasus (lihat output_delta_t_label)
+static void case_label(char* out, size_t size, const CaseConfig* config, double delta_t) {
+    for (int i = 0; i < config->num_cases; i++) {
+        if (config->delta_t_values[i] == delta_t) {
+            output_delta_t_label(out, size, config->delta_t_values, config->num_cases, i);
+            return;
+        }
+    }
+    output_delta_t_label(out, size, &delta_t, 1, 0);
+}
+
+/**
+ * Path file keluaran satu kasus di config->output_dir: output_<label>.<ext>
+ * untuk Euler (nama lama dipertahankan), output_<metode>_<label>.<ext>
+ * untuk metode lain. label "*" menghasilkan pola nama seluruh kasus.
+ */
+static void case_path(char* out, size_t size, const CaseConfig* config,
+                      const char* label, const char* extension) {
+    char name[128];
+    if (config->method == INTEGRATOR_EULER) {
+        snprintf(name, sizeof(name), "output_%s.%s", label, extension);
+    } else {
+        snprintf(name, sizeof(name), "output_%s_%s.%s", integrator_info(config->method)->name,
+                 label, extension);
+    }
+    output_path(out, size, config->output_dir, name);
+}
+
+// Path file kasus dengan delta_t tertentu
+static void case_filename(char* out, size_t size, const CaseConfig* config,
+                          double delta_t, const char* extension) {
+    char label[64];
+    case_label(label, sizeof(label), config, delta_t);
+    case_path(out, size, config, label, extension);
+}
+
+/**
+ * Peringatan jika λΔt melewati batas stabilitas metode eksplisit: solusi
+ * numerik berosilasi dengan amplitudo tumbuh alih-alih meluruh.
+ */
+static void print_stability_warning(TextBuffer* out, const CaseConfig* config, double delta_t) {
+    const IntegratorInfo* info = integrator_info(config->method);
+    double z = (config->chain ? chain_max_lambda(config->chain) : config->lambda) * delta_t;
+    if (info->stability_limit > 0.0 && z > info->stability_limit) {
+        text_printf(out, "\nPeringatan: lambda * delta_t = %.4f melebihi batas stabilitas %s (%.4f);\n"
+                         "solusi numerik tidak stabil. Gunakan backward-euler, crank-nicolson, exp-euler, atau cram.\n",
+                    z, info->name, info->stability_limit);
+    }
+}
+
+/**
+ * SIMULASI SATU DELTA_T: MODE ARRAY PENUH
+ * =======================================
  * 
- * Parameter:
- * @param N0                  - Jumlah atom awal
- * @param lambda              - Konstanta peluruhan (s⁻¹)
- * @param t_initial           - Waktu awal simulasi (s)
- * @param t_final             - Waktu akhir simulasi (s)
- * @param delta_t             - Ukuran step waktu (s)
- * @param results_array_ptr   - Pointer ke array hasil simulasi
+ * Menjalankan simulasi, menampilkan tabel dan statistik, lalu mengekspor
+ * seluruh baris ke file CSV (dan file biner kolumnar jika config->write_binary).
+ */
+static void run_case_materialized(
+    TextBuffer* out, SweepCaseSummary* summary, const CaseConfig* config, double delta_t
+) {
+    SimulationResults simulation_results = results_empty(config->result_layout);
+    print_stability_warning(out, config, delta_t);
+
+    // PANGGIL FUNGSI SIMULASI
+    // =======================
+    int actual_steps = decay_simulate(
+        config->N0, config->lambda,
+        config->t_start, config->t_end, delta_t,
+        config->method, config->evaluation_mode, &simulation_results
+    );
+
+    // VALIDASI HASIL SIMULASI
+    // =======================
+    if (simulation_results.num_rows == 0 || actual_steps == 0) {
+        // ERROR HANDLING
+        results_free(&simulation_results);
+        text_printf(out, "Simulasi gagal atau tidak ada step untuk delta_t = %.2f s.\n", delta_t);
+        text_printf(out, "======================================================================\n");
+        return;
+    }
+
+    // TAHAP PELAPORAN KE KONSOL
+    // =========================
+    double phase_start = stats_phase_begin();
+    print_simulation_table(out, &simulation_results, config->isotope, delta_t);
+
+    // TAMPILKAN STATISTIK SIMULASI
+    // ============================
+    text_printf(out, "Total step untuk delta_t = %.2f s (%.2f jam) adalah %d.\n",
+           delta_t, delta_t / 3600.0, actual_steps);
+    text_printf(out, "Memori hasil: %.3f MiB (%s) dalam %d alokasi.\n",
+           simulation_results.bytes_allocated / (1024.0 * 1024.0),
+           results_layout_name(simulation_results.layout),
+           simulation_results.allocation_count);
+
+    // Baris terakhir (indeks actual_steps) berada tepat di t_end
+    SimulationStep final_row = results_row(&simulation_results, simulation_results.num_rows - 1);
+    text_printf(out, "Error absolut akhir (pada t=%.1f s): %.3e atom\n",
+           final_row.time_s, final_row.error_absolute);
+    text_printf(out, "Error relatif akhir: %.4f %%\n", final_row.error_relative_percent);
+    stats_phase_end(STATS_PHASE_REPORT, phase_start);
+
+    ErrorReducer reducer;
+    error_reducer_init(&reducer);
+    error_reducer_consume(&reducer, &simulation_results, 0);
+    *summary = (SweepCaseSummary){
+        delta_t, actual_steps, final_row.error_absolute, final_row.error_relative_percent,
+        reducer.max_error_relative_percent, final_row.time_s, final_row.N_numerical,
+        final_row.N_analytical
+    };
+
+    // EKSPOR DATA KE FILE CSV
+    // =======================
+    // Buat nama file unik berdasarkan metode dan delta_t
+    char filename[OUTPUT_PATH_MAX];
+    case_filename(filename, sizeof(filename), config, delta_t, "csv");
+    CsvWriter writer;
+
+    phase_start = stats_phase_begin();
+    if (config->write_csv && csv_writer_open(&writer, filename)) {
+        int written = csv_writer_write_header(&writer) &&
+                      csv_writer_write_rows(&writer, &simulation_results);
+        written = csv_writer_close(&writer) && written;
+        stats_phase_end(STATS_PHASE_CSV, phase_start);
+        if (written) {
+            text_printf(out, "Data hasil simulasi disimpan ke: %s\n", filename);
+        } else {
+            text_printf(out, "Error: Gagal menulis data ke file %s.\n", filename);
+        }
+    } else if (config->write_csv) {
+        text_printf(out, "Error: Gagal membuka file %s untuk ditulis.\n", filename);
+    }
+
+    if (config->write_binary) {
+        char method_label[BINARY_NAME_BYTES];
+        simulation_method_label(config->method, config->evaluation_mode, method_label, sizeof(method_label));
+        OutputMetadata metadata = { config->N0, config->lambda, config->t_start, delta_t, method_label };
+        BinaryWriter binary_writer;
+        case_filename(filename, sizeof(filename), config, delta_t, "bin");
+        phase_start = stats_phase_begin();
+        if (binary_writer_open(&binary_writer, filename, &metadata, simulation_results.num_rows)) {
+            int written = binary_writer_write_rows(&binary_writer, &simulation_results, 0);
+            written = binary_writer_close(&binary_writer) && written;
+            stats_phase_end(STATS_PHASE_BINARY, phase_start);
+            if (written) {
+                text_printf(out, "Data biner kolumnar disimpan ke: %s\n", filename);
+            } else {
+                text_printf(out, "Error: Gagal menulis data ke file %s.\n", filename);
+            }
+        } else {
+            text_printf(out, "Error: Gagal membuka file %s untuk ditulis.\n", filename);
+        }
+    }
+
+    text_printf(out, "======================================================================\n");
+
+    // Dealokasi memori untuk mencegah memory leak
+    results_free(&simulation_results);
+}
+
+/**
+ * SIMULASI SATU DELTA_T: MODE STREAMING
+ * =====================================
  * 
- * Return:
- * @return int - Jumlah step simulasi yang berhasil dilakukan
+ * Hasil tidak pernah disimpan penuh: setiap chunk dikirim ke sink penampil
+ * tabel, sink CSV, sink biner (jika config->write_binary), dan reduktor error
+ * online.
+ * Memori puncak hanya satu chunk.
  */
-int euler_radioactive_decay(
-    double N0, double lambda,
-    double t_initial, double t_final, double delta_t,
-    SimulationStep** results_array_ptr
+static void run_case_streaming(
+    TextBuffer* out, SweepCaseSummary* summary, const CaseConfig* config, double delta_t
 ) {
-    // VALIDASI INPUT
-    // ==============
-    // Memastikan delta_t positif untuk menghindari error numerik
-    if (delta_t <= 0) {
-        printf("Error: delta_t harus positif.\n");
-        *results_array_ptr = NULL;
-        return 0;
-    }
-
-    // ALOKASI MEMORI DINAMIS
-    // ======================
-    // Estimasi jumlah step yang dibutuhkan dan alokasi memori
-    int estimated_steps = (int)((t_final - t_initial) / delta_t) + 2;
-    *results_array_ptr = (SimulationStep*)malloc(estimated_steps * sizeof(SimulationStep));
-    
-    // Validasi alokasi memori
-    if (*results_array_ptr == NULL) {
-        printf("Error: Gagal mengalokasikan memori untuk hasil simulasi.\n");
-        return 0;
-    }
-
-    // INISIALISASI VARIABEL SIMULASI
+    int total_rows = euler_step_count(config->t_start, config->t_end, delta_t) + 1;
+    print_stability_warning(out, config, delta_t);
+
+    char filename[OUTPUT_PATH_MAX];
+    case_filename(filename, sizeof(filename), config, delta_t, "csv");
+    CsvWriter writer;
+    double phase_start = stats_phase_begin();
+    int csv_opened = config->write_csv && csv_writer_open(&writer, filename);
+    int csv_ok = csv_opened && csv_writer_write_header(&writer);
+    stats_phase_end(STATS_PHASE_CSV, phase_start);
+
+    // File biner dialokasikan penuh di awal; setiap chunk ditulis ke posisinya
+    char binary_filename[OUTPUT_PATH_MAX];
+    case_filename(binary_filename, sizeof(binary_filename), config, delta_t, "bin");
+    char method_label[BINARY_NAME_BYTES];
+    simulation_method_label(config->method, config->evaluation_mode, method_label, sizeof(method_label));
+    OutputMetadata metadata = { config->N0, config->lambda, config->t_start, delta_t, method_label };
+    BinaryWriter binary_writer;
+    phase_start = stats_phase_begin();
+    int binary_opened = config->write_binary &&
+                        binary_writer_open(&binary_writer, binary_filename, &metadata, total_rows);
+    int binary_ok = binary_opened;
+    stats_phase_end(STATS_PHASE_BINARY, phase_start);
+
+    // SUSUNAN SINK
+    // ============
+    // Sink tabel, CSV, dan biner dibungkus TimedSink untuk instrumentasi fase
+    TableSampler sampler = { out, table_print_interval(total_rows), total_rows - 1 };
+    ErrorReducer reducer;
+    error_reducer_init(&reducer);
+    TimedSink timed_sampler = { { table_sampler_consume, &sampler }, STATS_PHASE_REPORT };
+    TimedSink timed_csv = { { csv_sink_consume, &writer }, STATS_PHASE_CSV };
+    TimedSink timed_binary = { { binary_sink_consume, &binary_writer }, STATS_PHASE_BINARY };
+
+    size_t chunk_bytes = 0;
+
+    ResultSink sinks[5];
+    int num_sinks = 0;
+    sinks[num_sinks++] = (ResultSink){ timed_sink_consume, &timed_sampler };
+    if (csv_ok) sinks[num_sinks++] = (ResultSink){ timed_sink_consume, &timed_csv };
+    if (binary_ok) sinks[num_sinks++] = (ResultSink){ timed_sink_consume, &timed_binary };
+    sinks[num_sinks++] = (ResultSink){ error_reducer_consume, &reducer };
+    sinks[num_sinks++] = (ResultSink){ chunk_bytes_consume, &chunk_bytes };
+
+    print_table_header(out, config->isotope, delta_t);
+    int actual_steps = decay_simulate_stream(
+        config->N0, config->lambda, config->t_start, config->t_end, delta_t,
+        config->method, config->evaluation_mode, config->result_layout, sinks, num_sinks
+    );
+    print_table_footer(out);
+
+    phase_start = stats_phase_begin();
+    if (csv_opened) csv_ok = csv_writer_close(&writer) && csv_ok;
+    stats_phase_end(STATS_PHASE_CSV, phase_start);
+    phase_start = stats_phase_begin();
+    if (binary_opened) binary_ok = binary_writer_close(&binary_writer) && binary_ok;
+    stats_phase_end(STATS_PHASE_BINARY, phase_start);
+
+    if (actual_steps == 0 || reducer.num_rows == 0) {
+        text_printf(out, "Simulasi gagal atau tidak ada step untuk delta_t = %.2f s.\n", delta_t);
+        text_printf(out, "======================================================================\n");
+        return;
+    }
+
+    // STATISTIK DARI REDUKTOR ONLINE
     // ==============================
-    double current_N = N0;        // Jumlah atom saat ini (dimulai dari N₀)
-    double current_t = t_initial; // Waktu saat ini
-    int step_count = 0;           // Counter step simulasi
-
-    // HEADER TABEL OUTPUT
-    // ===================
-    printf("\nSimulasi Peluruhan Radon-222 dengan delta_t = %.4f s (%.2f jam):\n", 
-           delta_t, delta_t/3600.0);
-    printf("--------------------------------------------------------------------------------------\n");
-    printf("| Waktu (s) | N Numerik      | N Analitik     | Error Absolut  | Error Relatif (%%) |\n");
-    printf("|-----------|----------------|----------------|----------------|-------------------|\n");
-
-    // LOOP UTAMA SIMULASI METODE EULER
-    // =================================
-    while (current_t <= t_final + delta_t / 2.0) {
-        
-        // REALLOKASI MEMORI (IF NEEDED)
-        // =================================
-        // Jika step melebihi estimasi, gandakan ukuran array
-        if (step_count >= estimated_steps) {
-            estimated_steps *= 2;
-            SimulationStep* temp = (SimulationStep*)realloc(*results_array_ptr, 
-                                                           estimated_steps * sizeof(SimulationStep));
-            if (temp == NULL) {
-                printf("Error: Gagal realloc memori.\n");
-                return step_count;
+    *summary = (SweepCaseSummary){
+        delta_t, actual_steps, reducer.last_row.error_absolute,
+        reducer.last_row.error_relative_percent, reducer.max_error_relative_percent,
+        reducer.last_row.time_s, reducer.last_row.N_numerical, reducer.last_row.N_analytical
+    };
+    phase_start = stats_phase_begin();
+    int chunk_rows = (total_rows < STREAM_CHUNK_ROWS) ? total_rows : STREAM_CHUNK_ROWS;
+    text_printf(out, "Total step untuk delta_t = %.2f s (%.2f jam) adalah %d.\n",
+           delta_t, delta_t / 3600.0, actual_steps);
+    text_printf(out, "Memori puncak (streaming, %s): %.3f MiB untuk %d baris per chunk.\n",
+           results_layout_name(config->result_layout), chunk_bytes / (1024.0 * 1024.0), chunk_rows);
+    text_printf(out, "Error absolut akhir (pada t=%.1f s): %.3e atom\n",
+           reducer.last_row.time_s, reducer.last_row.error_absolute);
+    text_printf(out, "Error relatif akhir: %.4f %%\n", reducer.last_row.error_relative_percent);
+    text_printf(out, "Error relatif maksimum: %.4f %%, rata-rata: %.4f %%\n",
+           reducer.max_error_relative_percent,
+           reducer.sum_error_relative_percent / reducer.num_rows);
+    stats_phase_end(STATS_PHASE_REPORT, phase_start);
+
+    if (csv_ok) {
+        text_printf(out, "Data hasil simulasi disimpan ke: %s\n", filename);
+    } else if (config->write_csv && !csv_opened) {
+        text_printf(out, "Error: Gagal membuka file %s untuk ditulis.\n", filename);
+    } else if (config->write_csv) {
+        text_printf(out, "Error: Gagal menulis data ke file %s.\n", filename);
+    }
+    if (binary_ok) {
+        text_printf(out, "Data biner kolumnar disimpan ke: %s\n", binary_filename);
+    } else if (config->write_binary && !binary_opened) {
+        text_printf(out, "Error: Gagal membuka file %s untuk ditulis.\n", binary_filename);
+    } else if (config->write_binary) {
+        text_printf(out, "Error: Gagal menulis data ke file %s.\n", binary_filename);
+    }
+    text_printf(out, "======================================================================\n");
+}
+
+/**
+ * SIMULASI SATU DELTA_T: HANYA RINGKASAN
+ * ======================================
+ * 
+ * Untuk sweep besar (ribuan kasus): kernel streaming dengan reduktor error
+ * sebagai satu-satunya sink, tanpa tabel konsol maupun file per kasus.
+ */
+static void run_case_summary(SweepCaseSummary* summary, const CaseConfig* config, double delta_t) {
+    ErrorReducer reducer;
+    error_reducer_init(&reducer);
+    ResultSink sink = { error_reducer_consume, &reducer };
+
+    int actual_steps = decay_simulate_stream(
+        config->N0, config->lambda, config->t_start, config->t_end, delta_t,
+        config->method, config->evaluation_mode, config->result_layout, &sink, 1
+    );
+    *summary = (SweepCaseSummary){
+        delta_t, (reducer.num_rows > 0) ? actual_steps : 0, reducer.last_row.error_absolute,
+        reducer.last_row.error_relative_percent, reducer.max_error_relative_percent,
+        reducer.last_row.time_s, reducer.last_row.N_numerical, reducer.last_row.N_analytical
+    };
+}
+
+/**
+ * SIMULASI SATU DELTA_T: RANTAI PELURUHAN
+ * =======================================
+ * 
+ * Rantai disimulasikan dalam mode streaming: setiap chunk dikirim ke sink
+ * tabel (N numerik semua spesies), sink CSV rantai, dan satu reduktor error
+ * per spesies (melalui chain_species_view). Ringkasan sweep untuk kasus ini
+ * diambil dari spesies dengan error relatif akhir terbesar.
+ */
+typedef struct {
+    TextBuffer* out;
+    int print_interval;
+    int last_row;
+} ChainTableSampler;
+
+static int chain_table_sampler_consume(void* context, const ChainResults* chunk, int first_row) {
+    ChainTableSampler* sampler = (ChainTableSampler*)context;
+    for (int i = 0; i < chunk->num_rows; i++) {
+        int global_row = first_row + i;
+        if (global_row % sampler->print_interval == 0 || global_row == sampler->last_row) {
+            text_printf(sampler->out, "| %10.1f |", chunk->time_s[i]);
+            for (int s = 0; s < chunk->num_species; s++) {
+                text_printf(sampler->out, " %10.3e |", chunk->N_numerical[s][i]);
+            }
+            text_printf(sampler->out, "\n");
+        }
+    }
+    return 1;
+}
+
+typedef struct {
+    ErrorReducer reducers[CHAIN_MAX_SPECIES];
+} ChainErrorReducer;
+
+static int chain_error_reducer_consume(void* context, const ChainResults* chunk, int first_row) {
+    ChainErrorReducer* reducer = (ChainErrorReducer*)context;
+    for (int s = 0; s < chunk->num_species; s++) {
+        SimulationResults view = chain_species_view(chunk, s);
+        error_reducer_consume(&reducer->reducers[s], &view, first_row);
+    }
+    return 1;
+}
+
+static void print_chain_rule(TextBuffer* out, int num_species) {
+    text_printf(out, "--------------");
+    for (int s = 0; s < num_species; s++) text_printf(out, "-------------");
+    text_printf(out, "\n");
+}
+
+static void run_case_chain(
+    TextBuffer* out, SweepCaseSummary* summary, const CaseConfig* config, double delta_t,
+    int summary_only
+) {
+    const DecayChain* chain = config->chain;
+    int S = chain->num_species;
+    int total_rows = euler_step_count(config->t_start, config->t_end, delta_t) + 1;
+    if (!summary_only) print_stability_warning(out, config, delta_t);
+
+    char name[128], label[64], filename[OUTPUT_PATH_MAX];
+    case_label(label, sizeof(label), config, delta_t);
+    snprintf(name, sizeof(name), "output_chain_%s_%s.csv", integrator_info(config->method)->name, label);
+    output_path(filename, sizeof(filename), config->output_dir, name);
+    CsvWriter writer;
+    int csv_opened = !summary_only && config->write_csv && csv_writer_open(&writer, filename);
+    int csv_ok = csv_opened && csv_writer_write_chain_header(&writer, chain);
+
+    ChainTableSampler sampler = { out, table_print_interval(total_rows), total_rows - 1 };
+    ChainErrorReducer reducer;
+    for (int s = 0; s < S; s++) error_reducer_init(&reducer.reducers[s]);
+
+    ChainSink sinks[3];
+    int num_sinks = 0;
+    if (!summary_only) sinks[num_sinks++] = (ChainSink){ chain_table_sampler_consume, &sampler };
+    if (csv_ok) sinks[num_sinks++] = (ChainSink){ chain_csv_sink_consume, &writer };
+    sinks[num_sinks++] = (ChainSink){ chain_error_reducer_consume, &reducer };
+
+    if (!summary_only) {
+        text_printf(out, "\nSimulasi Rantai Peluruhan %s dengan delta_t = %.4f s (%.2f jam), N numerik:\n",
+                    chain->species[0].name, delta_t, delta_t / 3600.0);
+        print_chain_rule(out, S);
+        text_printf(out, "| Waktu (s)  |");
+        for (int s = 0; s < S; s++) text_printf(out, " %-10s |", chain->species[s].name);
+        text_printf(out, "\n");
+        print_chain_rule(out, S);
+    }
+    int actual_steps = chain_simulate_stream(chain, config->t_start, config->t_end, delta_t,
+                                             config->method, sinks, num_sinks);
+    if (csv_opened) csv_ok = csv_writer_close(&writer) && csv_ok;
+
+    if (actual_steps == 0 || reducer.reducers[0].num_rows == 0) {
+        if (!summary_only) {
+            text_printf(out, "Simulasi gagal atau tidak ada step untuk delta_t = %.2f s.\n", delta_t);
+            text_printf(out, "======================================================================\n");
+        }
+        return;
+    }
+
+    // Ringkasan sweep: spesies dengan error relatif akhir terbesar (NaN dari
+    // metode eksplisit yang tidak stabil diutamakan agar tidak tersembunyi)
+    int worst = 0;
+    for (int s = 1; s < S; s++) {
+        double candidate = reducer.reducers[s].last_row.error_relative_percent;
+        double current = reducer.reducers[worst].last_row.error_relative_percent;
+        if (!isnan(current) && (isnan(candidate) || candidate > current)) worst = s;
+    }
+    *summary = (SweepCaseSummary){
+        delta_t, actual_steps, reducer.reducers[worst].last_row.error_absolute,
+        reducer.reducers[worst].last_row.error_relative_percent,
+        reducer.reducers[worst].max_error_relative_percent, reducer.reducers[worst].last_row.time_s,
+        reducer.reducers[worst].last_row.N_numerical, reducer.reducers[worst].last_row.N_analytical
+    };
+    if (summary_only) return;
+
+    // TABEL ERROR PER SPESIES
+    // =======================
+    print_chain_rule(out, S);
+    text_printf(out, "Total step untuk delta_t = %.2f s (%.2f jam) adalah %d.\n",
+                delta_t, delta_t / 3600.0, actual_steps);
+    text_printf(out, "| Spesies  | N Numerik Akhir | N Analitik Akhir | Error Relatif Akhir (%%) | Maks (%%)   |\n");
+    text_printf(out, "|----------|-----------------|------------------|-------------------------|------------|\n");
+    for (int s = 0; s < S; s++) {
+        const ErrorReducer* r = &reducer.reducers[s];
+        text_printf(out, "| %-8s | %15.6e | %16.6e | %23.4e | %10.4e |\n",
+                    chain->species[s].name, r->last_row.N_numerical, r->last_row.N_analytical,
+                    r->last_row.error_relative_percent, r->max_error_relative_percent);
+    }
+
+    if (csv_ok) {
+        text_printf(out, "Data hasil simulasi rantai disimpan ke: %s\n", filename);
+    } else if (config->write_csv && !csv_opened) {
+        text_printf(out, "Error: Gagal membuka file %s untuk ditulis.\n", filename);
+    } else if (config->write_csv) {
+        text_printf(out, "Error: Gagal menulis data ke file %s.\n", filename);
+    }
+    text_printf(out, "======================================================================\n");
+}
+
+/**
+ * TABEL RINGKASAN SWEEP DI KONSOL
+ * ===============================
+ */
+static void print_sweep_summary(const SweepCaseSummary* summaries, int num_cases) {
+    if (num_cases > SUMMARY_CONSOLE_MAX_ROWS) return;
+
+    printf("\nRingkasan sweep delta_t:\n");
+    printf("------------------------------------------------------------------------------------------\n");
+    printf("| delta_t (s)    | Step       | Error Absolut Akhir | Error Relatif Akhir (%%) | Maks (%%) |\n");
+    printf("|----------------|------------|---------------------|-------------------------|----------|\n");
+    for (int i = 0; i < num_cases; i++) {
+        const SweepCaseSummary* summary = &summaries[i];
+        if (summary->steps == 0) {
+            printf("| %14.4f | %10s | %19s | %23s | %8s |\n", summary->delta_t, "gagal", "-", "-", "-");
+            continue;
+        }
+        printf("| %14.4f | %10d | %19.3e | %23.4f | %8.4f |\n",
+               summary->delta_t, summary->steps, summary->final_error_absolute,
+               summary->final_error_relative_percent, summary->max_error_relative_percent);
+    }
+    printf("------------------------------------------------------------------------------------------\n");
+}
+
+/**
+ * RINCIAN INSTRUMENTASI PER KASUS (--stats)
+ * =========================================
+ * 
+ * Tabel waktu per fase dan tabel counter, masing-masing dengan baris total
+ * (jumlah atas kasus; pada sweep paralel total waktu melebihi waktu dinding
+ * program). Jika write_json, statistik setiap kasus juga ditulis ke
+ * output_<delta_t>.stats.json (nama mengikuti file CSV kasus).
+ */
+static void print_run_stats(const CaseConfig* config, const SweepCaseSummary* summaries,
+                            const RunStats* stats, int num_cases, int write_json) {
+    RunStats total;
+    run_stats_init(&total);
+    for (int i = 0; i < num_cases; i++) run_stats_merge(&total, &stats[i]);
+    int show_cases = num_cases <= SUMMARY_CONSOLE_MAX_ROWS;
+
+    printf("\nInstrumentasi per kasus: waktu fase (ms)\n");
+    printf("--------------------------------------------------------------------------------------------------------------\n");
+    printf("| delta_t (s)    | Total      | Alokasi  | Integrasi  | Analitik   | Konsol   | CSV        | Biner    | Lain     |\n");
+    printf("|----------------|------------|----------|------------|------------|----------|------------|----------|----------|\n");
+    for (int i = 0; i <= num_cases; i++) {
+        if (i < num_cases && !show_cases) continue;
+        const RunStats* s = (i < num_cases) ? &stats[i] : &total;
+        if (i < num_cases) {
+            printf("| %14.4f ", summaries[i].delta_t);
+        } else {
+            printf("| %-14s ", "TOTAL");
+        }
+        printf("| %10.3f | %8.3f | %10.3f | %10.3f | %8.3f | %10.3f | %8.3f | %8.3f |\n",
+               s->wall_seconds * 1e3,
+               s->phase_seconds[STATS_PHASE_ALLOCATION] * 1e3,
+               s->phase_seconds[STATS_PHASE_INTEGRATION] * 1e3,
+               s->phase_seconds[STATS_PHASE_ANALYTIC] * 1e3,
+               s->phase_seconds[STATS_PHASE_REPORT] * 1e3,
+               s->phase_seconds[STATS_PHASE_CSV] * 1e3,
+               s->phase_seconds[STATS_PHASE_BINARY] * 1e3,
+               run_stats_other_seconds(s) * 1e3);
+    }
+    printf("--------------------------------------------------------------------------------------------------------------\n");
+
+    printf("\nInstrumentasi per kasus: counter\n");
+    printf("--------------------------------------------------------------------------------------------------------------\n");
+    printf("| delta_t (s)    | Step         | Alokasi  | Realloc  | MiB Alokasi  | MiB Ditulis  | Panggilan exp  | ns/step  |\n");
+    printf("|----------------|--------------|----------|----------|--------------|--------------|----------------|----------|\n");
+    for (int i = 0; i <= num_cases; i++) {
+        if (i < num_cases && !show_cases) continue;
+        const RunStats* s = (i < num_cases) ? &stats[i] : &total;
+        if (i < num_cases) {
+            printf("| %14.4f ", summaries[i].delta_t);
+        } else {
+            printf("| %-14s ", "TOTAL");
+        }
+        long long steps = s->counters[STATS_COUNTER_STEPS];
+        printf("| %12lld | %8lld | %8lld | %12.3f | %12.3f | %14lld | %8.3f |\n",
+               steps, s->counters[STATS_COUNTER_ALLOCATIONS], s->counters[STATS_COUNTER_REALLOCATIONS],
+               s->counters[STATS_COUNTER_BYTES_ALLOCATED] / (1024.0 * 1024.0),
+               s->counters[STATS_COUNTER_BYTES_WRITTEN] / (1024.0 * 1024.0),
+               s->counters[STATS_COUNTER_EXP_CALLS],
+               (steps > 0) ? s->phase_seconds[STATS_PHASE_INTEGRATION] * 1e9 / steps : 0.0);
+    }
+    printf("--------------------------------------------------------------------------------------------------------------\n");
+
+    if (!write_json) return;
+    char method_label[BINARY_NAME_BYTES];
+    simulation_method_label(config->method, config->evaluation_mode, method_label, sizeof(method_label));
+    int failed = 0;
+    for (int i = 0; i < num_cases; i++) {
+        char filename[OUTPUT_PATH_MAX];
+        case_filename(filename, sizeof(filename), config, summaries[i].delta_t, "stats.json");
+        if (!run_stats_write_json(filename, method_label, summaries[i].delta_t, &stats[i])) {
+            printf("Error: Gagal menulis statistik ke file %s.\n", filename);
+            failed = 1;
+        }
+    }
+    if (!failed) {
+        char pattern[OUTPUT_PATH_MAX];
+        case_path(pattern, sizeof(pattern), config, "*", "stats.json");
+        printf("Statistik per kasus disimpan ke: %s\n", pattern);
+    }
+}
+
+// Urutan delta_t menurun (kasar ke halus) untuk analisis konvergensi
+static int compare_summary_delta_t_descending(const void* a, const void* b) {
+    double x = (*(const SweepCaseSummary* const*)a)->delta_t;
+    double y = (*(const SweepCaseSummary* const*)b)->delta_t;
+    return (x < y) - (x > y);
+}
+
+/**
+ * ANALISIS KONVERGENSI SWEEP
+ * ==========================
+ *
+ * Orde teramati dari regresi ln(error relatif akhir) terhadap ln Δt atas
+ * seluruh kasus sweep (lihat convergence.h), ditambah orde lokal antar
+ * kasus berurutan. Dengan --richardson, setiap pasangan kasus berurutan
+ * yang berakhir pada waktu yang sama diekstrapolasi dengan orde nominal
+ * metode, dan biayanya dibandingkan dengan satu run yang menurut model
+ * error mencapai akurasi yang sama.
+ *
+ * @param summaries    - Ringkasan kasus sweep
+ * @param num_cases    - Jumlah kasus
+ * @param method       - Metode integrasi (untuk orde nominal)
+ * @param richardson   - 1 untuk mencetak tabel ekstrapolasi Richardson
+ * @param chain        - 1 jika ringkasan berasal dari rantai (spesies terburuk)
+ * @param time_span    - t_end - t_start (s)
+ */
+static void print_convergence_analysis(const SweepCaseSummary* summaries, int num_cases,
+                                       IntegratorMethod method, int richardson, int chain,
+                                       double time_span) {
+    const IntegratorInfo* info = integrator_info(method);
+    const SweepCaseSummary** sorted =
+        (const SweepCaseSummary**)malloc((size_t)num_cases * sizeof(SweepCaseSummary*));
+    double* delta_t = (double*)malloc((size_t)num_cases * sizeof(double));
+    double* error = (double*)malloc((size_t)num_cases * sizeof(double));
+    if (sorted == NULL || delta_t == NULL || error == NULL) {
+        printf("Error: Gagal mengalokasikan memori untuk analisis konvergensi.\n");
+        free(sorted);
+        free(delta_t);
+        free(error);
+        return;
+    }
+    int num_valid = 0;
+    for (int i = 0; i < num_cases; i++) {
+        if (summaries[i].steps > 0) sorted[num_valid++] = &summaries[i];
+    }
+    qsort(sorted, (size_t)num_valid, sizeof(SweepCaseSummary*), compare_summary_delta_t_descending);
+    for (int i = 0; i < num_valid; i++) {
+        delta_t[i] = sorted[i]->delta_t;
+        error[i] = sorted[i]->final_error_relative_percent / 100.0;
+    }
+
+    if (num_valid <= SUMMARY_CONSOLE_MAX_ROWS) {
+        printf("\nAnalisis konvergensi%s (urut delta_t menurun):\n",
+               chain ? " (error relatif akhir spesies terburuk)" : "");
+        printf("--------------------------------------------------------------\n");
+        printf("| delta_t (s)    | Error Relatif Akhir (%%) | Orde Lokal      |\n");
+        printf("|----------------|-------------------------|-----------------|\n");
+        for (int i = 0; i < num_valid; i++) {
+            double local = (i > 0) ? convergence_local_order(delta_t[i - 1], error[i - 1],
+                                                             delta_t[i], error[i])
+                                   : NAN;
+            if (isnan(local)) {
+                printf("| %14.4f | %23.4e | %15s |\n", delta_t[i], error[i] * 100.0, "-");
+            } else {
+                printf("| %14.4f | %23.4e | %15.4f |\n", delta_t[i], error[i] * 100.0, local);
+            }
+        }
+        printf("--------------------------------------------------------------\n");
+    } else {
+        printf("\nAnalisis konvergensi (%d kasus):\n", num_valid);
+    }
+
+    ConvergenceFit fit;
+    int fit_ok = convergence_fit_order(delta_t, error, num_valid, &fit);
+    if (fit_ok) {
+        printf("Orde teramati (kuadrat terkecil, %d titik): p = %.4f +/- %.4f (R^2 = %.6f), "
+               "orde nominal %s: %d\n", fit.num_points, fit.order, fit.order_stderr, fit.r_squared,
+               info->name, info->order);
+        printf("Model error relatif: e(delta_t) = %.4e * delta_t^%.4f\n", exp(fit.log_constant), fit.order);
+    } else {
+        printf("Orde teramati: tidak dapat diestimasi (kurang dari dua kasus dengan error relatif "
+               "antara %.0e dan %.1f; error setingkat pembulatan atau kasus tidak stabil).\n",
+               CONVERGENCE_MIN_ERROR, CONVERGENCE_MAX_ERROR);
+    }
+
+    if (richardson && chain) {
+        printf("Catatan: --richardson tidak didukung untuk --chain (spesies terburuk dapat berbeda antar kasus).\n");
+    } else if (richardson) {
+        printf("\nEkstrapolasi Richardson (orde nominal p = %d, pasangan delta_t berurutan):\n", info->order);
+        printf("----------------------------------------------------------------------------------------------------------------------\n");
+        printf("| delta_t Kasar  | delta_t Halus  | N Richardson    | Error Relatif (%%) | Error Halus (%%) | Step Pasangan | Step Setara |\n");
+        printf("|----------------|----------------|-----------------|-------------------|-----------------|---------------|-------------|\n");
+        int printed = 0, skipped = 0, hidden = 0;
+        for (int i = 1; i < num_valid; i++) {
+            const SweepCaseSummary* coarse = sorted[i - 1];
+            const SweepCaseSummary* fine = sorted[i];
+            double ratio = coarse->delta_t / fine->delta_t;
+            // Richardson hanya sah jika kedua run berakhir pada waktu yang sama
+            double time_tolerance = 1e-9 * fmax(fabs(fine->final_time_s), time_span);
+            if (!(ratio > 1.0) || fabs(coarse->final_time_s - fine->final_time_s) > time_tolerance) {
+                skipped++;
+                continue;
+            }
+            if (printed == SUMMARY_CONSOLE_MAX_ROWS) {
+                hidden++;
+                continue;
+            }
+            double N_extrapolated = convergence_richardson(coarse->final_N_numerical, fine->final_N_numerical,
+                                                           ratio, (double)info->order);
+            double error_extrapolated = fabs(N_extrapolated - fine->final_N_analytical) /
+                                        fabs(fine->final_N_analytical);
+            // Step satu run yang menurut model error mencapai error yang sama
+            double equivalent_delta_t = fit_ok ? convergence_step_for_error(&fit, error_extrapolated) : NAN;
+            char equivalent[32];
+            if (isfinite(equivalent_delta_t) && equivalent_delta_t > 0.0) {
+                snprintf(equivalent, sizeof(equivalent), "%11.3e", ceil(time_span / equivalent_delta_t));
+            } else {
+                snprintf(equivalent, sizeof(equivalent), "%11s", "-");
             }
-            *results_array_ptr = temp;
-        }
-
-        // PERHITUNGAN SOLUSI ANALITIK
-        // ===========================
-        // Solusi eksak: N(t) = N₀ * e^(-λt)
-        double N_exact = N0 * exp(-lambda * current_t);
-        
-        // ANALISIS ERROR
-        // ==============
-        // Error absolut: |N_numerik - N_analitik|
-        double abs_error = fabs(current_N - N_exact);
-        
-        // Error relatif dalam persen: (|error| / N_analitik) * 100%
-        // Validasi pembagian dengan nol untuk stabilitas numerik
-        double rel_error_pct = (N_exact != 0 && N_exact != 0.0) ? 
-                              (abs_error / N_exact) * 100.0 : 0.0;
-
-        // PENYIMPANAN HASIL step SAAT INI
-        // ==================================
-        (*results_array_ptr)[step_count].time_s = current_t;
-        (*results_array_ptr)[step_count].N_numerical = current_N;
-        (*results_array_ptr)[step_count].N_analytical = N_exact;
-        (*results_array_ptr)[step_count].error_absolute = abs_error;
-        (*results_array_ptr)[step_count].error_relative_percent = rel_error_pct;
-
-        // OUTPUT HASIL KE KONSOL (SAMPLING)
-        // =================================
-        // Menampilkan 10% step untuk menghindari output terlalu panjang
-        int print_interval = estimated_steps / 10;
-        if (print_interval < 1) print_interval = 1;
-
-        if (step_count % print_interval == 0 || current_t >= t_final - delta_t / 2.0) {
-            printf("| %9.2f | %14.3e | %14.3e | %14.3e | %17.4f |\n",
-                   current_t, current_N, N_exact, abs_error, rel_error_pct);
-        }
-
-        // KONDISI TERMINASI
-        // =================
-        // Stop iterasi jika sudah mencapai waktu akhir
-        if (current_t >= t_final - delta_t / 2.0 && step_count > 0) break;
-
-        // IMPLEMENTASI METODE EULER
-        // =========================
-        // Hitung turunan: dN/dt = -λN
-        double dN_dt = -lambda * current_N;
-        
-        // Update nilai N menggunakan formula Euler: N_baru = N_lama + Δt * (dN/dt)
-        current_N = current_N + delta_t * dN_dt;
-        
-        // Advance waktu: t_baru = t_lama + Δt
-        current_t = current_t + delta_t;
-        
-        // Increment counter step
-        step_count++;
-    }
-    
-    printf("--------------------------------------------------------------------------------------\n");
-    return step_count;
+            printf("| %14.4f | %14.4f | %15.9e | %17.4e | %15.4e | %13lld | %s |\n",
+                   coarse->delta_t, fine->delta_t, N_extrapolated, error_extrapolated * 100.0,
+                   fine->final_error_relative_percent, (long long)coarse->steps + fine->steps, equivalent);
+            printed++;
+        }
+        printf("----------------------------------------------------------------------------------------------------------------------\n");
+        if (skipped > 0) printf("%d pasangan dilewati (waktu akhir berbeda; pilih delta_t yang membagi t_end - t_start).\n", skipped);
+        if (hidden > 0) printf("%d pasangan lainnya tidak ditampilkan.\n", hidden);
+    }
+
+    free(sorted);
+    free(delta_t);
+    free(error);
+}
+
+/**
+ * SWEEP DELTA_T PARALEL
+ * =====================
+ * 
+ * Setiap nilai delta_t adalah satu tugas di pool thread (work-stealing,
+ * lihat task_pool.h). Keluaran konsol setiap kasus ditampung di buffernya
+ * sendiri dan dicetak oleh thread utama dalam urutan kasus segera setelah
+ * kasus tersebut selesai, sehingga keluaran identik untuk berapa pun
+ * jumlah thread.
+ */
+typedef struct {
+    CaseConfig config;
+    const double* delta_t_values;
+    int streaming;
+    int summary_only;                 // Hanya ringkasan, tanpa tabel dan file per kasus
+    int quiet;                        // Keluaran konsol hanya untuk kasus yang gagal
+    TextBuffer* outputs;              // Satu buffer per kasus
+    SweepCaseSummary* summaries;      // Satu ringkasan per kasus
+    RunStats* stats;                  // Instrumentasi per kasus (NULL tanpa --stats)
+} SweepContext;
+
+static void run_sweep_case(void* context, int case_index) {
+    SweepContext* sweep = (SweepContext*)context;
+    TextBuffer* out = &sweep->outputs[case_index];
+    SweepCaseSummary* summary = &sweep->summaries[case_index];
+    double delta_t = sweep->delta_t_values[case_index];
+    summary->delta_t = delta_t;       // steps = 0 jika kasus gagal
+
+    // RunStats dipasang di thread yang menjalankan kasus ini
+    RunStats* stats = (sweep->stats != NULL) ? &sweep->stats[case_index] : NULL;
+    RunStats* previous = NULL;
+    double start = 0.0;
+    if (stats != NULL) {
+        run_stats_init(stats);
+        previous = stats_attach(stats);
+        start = stats_now();
+    }
+
+    if (sweep->config.chain != NULL) {
+        run_case_chain(out, summary, &sweep->config, delta_t, sweep->summary_only);
+    } else if (sweep->summary_only) {
+        run_case_summary(summary, &sweep->config, delta_t);
+    } else if (sweep->streaming) {
+        run_case_streaming(out, summary, &sweep->config, delta_t);
+    } else {
+        run_case_materialized(out, summary, &sweep->config, delta_t);
+    }
+
+    if (stats != NULL) {
+        stats->wall_seconds = stats_now() - start;
+        stats_attach(previous);
+    }
+}
+
+/**
+ * Menjalankan seluruh kasus sweep dengan num_threads thread dan mencetak
+ * keluarannya ke stdout dalam urutan kasus (dengan sweep->quiet, hanya
+ * keluaran kasus yang gagal).
+ */
+static void run_sweep(SweepContext* sweep, int num_cases, int num_threads) {
+    sweep->outputs = (TextBuffer*)malloc((size_t)num_cases * sizeof(TextBuffer));
+    if (sweep->outputs == NULL) {
+        printf("Error: Gagal mengalokasikan buffer keluaran sweep.\n");
+        return;
+    }
+    for (int i = 0; i < num_cases; i++) text_buffer_init(&sweep->outputs[i]);
+
+    TaskPool pool;
+    int parallel = 0;
+    if (num_threads > 1 && num_cases > 1) {
+        parallel = task_pool_start(&pool, num_cases, num_threads, run_sweep_case, sweep);
+        // Tidak ada pekerja yang berjalan: kasus dijalankan di thread utama
+        if (!parallel) task_pool_finish(&pool);
+    }
+
+    for (int i = 0; i < num_cases; i++) {
+        if (parallel) {
+            task_pool_wait(&pool, i);
+        } else {
+            run_sweep_case(sweep, i);
+        }
+        if (!sweep->quiet || sweep->summaries[i].steps == 0) text_buffer_flush(&sweep->outputs[i], stdout);
+        text_buffer_free(&sweep->outputs[i]);
+    }
+
+    if (parallel) task_pool_finish(&pool);
+    free(sweep->outputs);
+    sweep->outputs = NULL;
+}
+
+/**
+ * SIMULASI DENGAN STEP ADAPTIF
+ * ============================
+ * 
+ * Satu run Dormand-Prince 5(4) dengan kontrol step dari t_start hingga t_end
+ * (menggantikan sweep delta_t). Tabel konsol, CSV, file biner, dan reduktor
+ * error memakai sink yang sama dengan mode step tetap: pada mode array penuh
+ * seluruh hasil diberikan ke setiap sink sebagai satu chunk, pada mode
+ * streaming per chunk. Kolom waktu berisi grid variabel dari pengontrol.
+ * 
+ * Return:
+ * @return int - 0 jika berhasil, 1 jika simulasi gagal
+ */
+static int run_adaptive(const CaseConfig* config, const AdaptiveControl* control, int streaming) {
+    // Jumlah baris diperlukan di depan untuk sampling tabel dan file biner
+    AdaptiveStats stats;
+    int num_steps = decay_adaptive_step_count(config->N0, config->lambda, config->t_start,
+                                              config->t_end, control, &stats);
+    if (num_steps == 0) return 1;
+    int total_rows = num_steps + 1;
+
+    TextBuffer output;
+    TextBuffer* out = &output;
+    text_buffer_init(out);
+
+    char filename[OUTPUT_PATH_MAX];
+    output_path(filename, sizeof(filename), config->output_dir, "output_adaptive.csv");
+    CsvWriter writer;
+    int csv_opened = config->write_csv && csv_writer_open(&writer, filename);
+    int csv_ok = csv_opened && csv_writer_write_header(&writer);
+
+    // delta_t = 0 pada header biner menandakan grid waktu variabel
+    char binary_filename[OUTPUT_PATH_MAX];
+    output_path(binary_filename, sizeof(binary_filename), config->output_dir, "output_adaptive.bin");
+    OutputMetadata metadata = { config->N0, config->lambda, config->t_start, 0.0, "rk45-adaptive" };
+    BinaryWriter binary_writer;
+    int binary_opened = config->write_binary &&
+                        binary_writer_open(&binary_writer, binary_filename, &metadata, total_rows);
+    int binary_ok = binary_opened;
+
+    TableSampler sampler = { out, table_print_interval(total_rows), total_rows - 1 };
+    ErrorReducer reducer;
+    error_reducer_init(&reducer);
+
+    ResultSink sinks[4];
+    int num_sinks = 0;
+    sinks[num_sinks++] = (ResultSink){ table_sampler_consume, &sampler };
+    if (csv_ok) sinks[num_sinks++] = (ResultSink){ csv_sink_consume, &writer };
+    if (binary_ok) sinks[num_sinks++] = (ResultSink){ binary_sink_consume, &binary_writer };
+    sinks[num_sinks++] = (ResultSink){ error_reducer_consume, &reducer };
+
+    text_printf(out, "\nSimulasi Peluruhan %s dengan step adaptif (atol = %.3e atom, rtol = %.3e):\n",
+                config->isotope, control->atol, control->rtol);
+    print_table_columns(out);
+    int actual_steps;
+    if (streaming) {
+        actual_steps = decay_simulate_adaptive_stream(
+            config->N0, config->lambda, config->t_start, config->t_end,
+            control, config->result_layout, sinks, num_sinks, &stats
+        );
+    } else {
+        SimulationResults simulation_results = results_empty(config->result_layout);
+        actual_steps = decay_simulate_adaptive(
+            config->N0, config->lambda, config->t_start, config->t_end,
+            control, &simulation_results, &stats
+        );
+        for (int s = 0; s < num_sinks && actual_steps > 0; s++) {
+            if (!sinks[s].consume(sinks[s].context, &simulation_results, 0)) actual_steps = 0;
+        }
+        results_free(&simulation_results);
+    }
+    print_table_footer(out);
+
+    if (csv_opened) csv_ok = csv_writer_close(&writer) && csv_ok;
+    if (binary_opened) binary_ok = binary_writer_close(&binary_writer) && binary_ok;
+
+    if (actual_steps == 0 || reducer.num_rows == 0) {
+        text_buffer_flush(out, stdout);
+        text_buffer_free(out);
+        printf("Simulasi adaptif gagal.\n");
+        return 1;
+    }
+
+    // STATISTIK PENGONTROL STEP
+    // =========================
+    text_printf(out, "Step diterima: %d, ditolak: %d, evaluasi f: %lld.\n",
+                stats.accepted_steps, stats.rejected_steps, stats.function_evaluations);
+    text_printf(out, "Ukuran step: terkecil %.4f s, terbesar %.4f s (%.2f jam).\n",
+                stats.h_smallest, stats.h_largest, stats.h_largest / 3600.0);
+    text_printf(out, "Error absolut akhir (pada t=%.1f s): %.3e atom\n",
+                reducer.last_row.time_s, reducer.last_row.error_absolute);
+    text_printf(out, "Error relatif akhir: %.4e %%\n", reducer.last_row.error_relative_percent);
+    text_printf(out, "Error relatif maksimum: %.4e %%\n", reducer.max_error_relative_percent);
+
+    if (csv_ok) {
+        text_printf(out, "Data hasil simulasi disimpan ke: %s\n", filename);
+    } else if (config->write_csv) {
+        text_printf(out, "Error: Gagal menulis data ke file %s.\n", filename);
+    }
+    if (binary_ok) {
+        text_printf(out, "Data biner kolumnar disimpan ke: %s\n", binary_filename);
+    } else if (config->write_binary) {
+        text_printf(out, "Error: Gagal menulis data ke file %s.\n", binary_filename);
+    }
+    text_printf(out, "======================================================================\n");
+
+    text_buffer_flush(out, stdout);
+    text_buffer_free(out);
+    return 0;
+}
+
+/**
+ * SIMULASI STOKASTIK (MONTE CARLO)
+ * ================================
+ * 
+ * Satu ensemble per delta_t di sweep (lihat stochastic.h). Tabel konsol
+ * menampilkan mean dan simpangan baku ensemble di samping nilai analitik,
+ * serta z = (mean - E[N]) / √(Var[N] / M): untuk ensemble yang benar |z|
+ * umumnya di bawah 3. Hasil lengkap ditulis ke
+ * output_stochastic_<sampler>_<delta_t>.csv di output_dir (kecuali write_csv = 0).
+ * 
+ * Return:
+ * @return int - 0 jika berhasil, 1 jika simulasi gagal
+ */
+static int run_stochastic(const StochasticConfig* base, const double* delta_t_values, int num_cases,
+                          int write_csv, const char* output_dir) {
+    const char* sampler_name = (base->sampler == STOCHASTIC_GILLESPIE) ? "gillespie" : "binomial";
+
+    for (int c = 0; c < num_cases; c++) {
+        StochasticConfig config = *base;
+        config.delta_t = delta_t_values[c];
+        StochasticResults results;
+        int steps = stochastic_simulate(&config, &results);
+        if (steps == 0) return 1;
+
+        printf("\nSimulasi Stokastik (%s, %lld trajektori, seed %llu) dengan delta_t = %.4f s (%.2f jam):\n",
+               sampler_name, config.num_trajectories, (unsigned long long)config.seed,
+               config.delta_t, config.delta_t / 3600.0);
+        printf("------------------------------------------------------------------------------------------\n");
+        printf("| Waktu (s)  | Mean N          | Simp. Baku      | N Analitik      | Simp. Baku Anal.| z      |\n");
+        printf("------------------------------------------------------------------------------------------\n");
+        int print_interval = table_print_interval(results.num_rows);
+        double max_abs_z = 0.0;
+        for (int row = 0; row < results.num_rows; row++) {
+            double variance = results.variance_analytical[row];
+            double z = (variance > 0.0)
+                       ? (results.N_mean[row] - results.N_analytical[row]) /
+                         sqrt(variance / (double)config.num_trajectories)
+                       : 0.0;
+            if (fabs(z) > max_abs_z) max_abs_z = fabs(z);
+            if (row % print_interval == 0 || row == results.num_rows - 1) {
+                printf("| %10.1f | %15.6e | %15.6e | %15.6e | %15.6e | %6.2f |\n",
+                       results.time_s[row], results.N_mean[row], sqrt(results.N_variance[row]),
+                       results.N_analytical[row], sqrt(variance), z);
+            }
+        }
+        printf("------------------------------------------------------------------------------------------\n");
+
+        int last = results.num_rows - 1;
+        printf("Total step: %d, |z| maksimum: %.2f, rasio variansi akhir (ensemble / analitik): %.4f\n",
+               steps, max_abs_z,
+               (results.variance_analytical[last] > 0.0)
+                   ? results.N_variance[last] / results.variance_analytical[last] : 0.0);
+
+        char name[128], label[64], filename[OUTPUT_PATH_MAX];
+        output_delta_t_label(label, sizeof(label), delta_t_values, num_cases, c);
+        snprintf(name, sizeof(name), "output_stochastic_%s_%s.csv", sampler_name, label);
+        output_path(filename, sizeof(filename), output_dir, name);
+        CsvWriter writer;
+        int csv_ok = write_csv && csv_writer_open(&writer, filename);
+        if (csv_ok) {
+            csv_ok = csv_writer_write_stochastic_header(&writer) &&
+                     csv_writer_write_stochastic_rows(&writer, &results);
+            csv_ok = csv_writer_close(&writer) && csv_ok;
+        }
+        if (csv_ok) {
+            printf("Data hasil simulasi stokastik disimpan ke: %s\n", filename);
+        } else if (write_csv) {
+            printf("Error: Gagal menulis file %s.\n", filename);
+        }
+        printf("======================================================================\n");
+        stochastic_results_free(&results);
+    }
+    return 0;
+}
+
+/**
+ * ENSEMBLE PARAMETER (N0, λ) TERPERTURBASI
+ * ========================================
+ * 
+ * Satu run lockstep per delta_t di sweep (lihat ensemble.h) dengan anggota
+ * yang sama. Tabel konsol menampilkan mean, simpangan baku, dan kuantil N,
+ * serta mean solusi eksak ensemble dan error relatif mean. Hasil lengkap
+ * ditulis ke output_ensemble_<metode>_<delta_t>.csv di output_dir (kecuali
+ * write_csv = 0).
+ * 
+ * Return:
+ * @return int - 0 jika berhasil, 1 jika simulasi gagal
+ */
+static int run_ensemble(const EnsembleConfig* base, const double* delta_t_values, int num_cases,
+                        int write_csv, const char* output_dir) {
+    const char* method_name = integrator_info(base->method)->name;
+
+    for (int c = 0; c < num_cases; c++) {
+        EnsembleConfig config = *base;
+        config.delta_t = delta_t_values[c];
+        EnsembleResults results;
+        int steps = ensemble_simulate(&config, &results);
+        if (steps == 0) return 1;
+
+        printf("\nEnsemble %lld anggota (%s) dengan delta_t = %.4f s (%.2f jam):\n",
+               results.num_members, integrator_info(config.method)->display_name,
+               config.delta_t, config.delta_t / 3600.0);
+        int width = 13 + 18 * (4 + results.num_quantiles) + 14;
+        char rule[13 + 18 * (4 + ENSEMBLE_MAX_QUANTILES) + 15];
+        memset(rule, '-', (size_t)width);
+        rule[width] = '\0';
+        printf("%s\n| Waktu (s)  | Mean N          | Simp. Baku      |", rule);
+        for (int q = 0; q < results.num_quantiles; q++) {
+            char label[32];
+            snprintf(label, sizeof(label), "Kuantil %g%%", results.quantile_p[q] * 100.0);
+            printf(" %-15s |", label);
+        }
+        printf(" Mean Analitik   | Error (%%)   |\n%s\n", rule);
+
+        int print_interval = table_print_interval(results.num_rows);
+        for (int row = 0; row < results.num_rows; row++) {
+            if (row % print_interval != 0 && row != results.num_rows - 1) continue;
+            printf("| %10.1f | %15.6e | %15.6e |", results.time_s[row], results.N_mean[row],
+                   results.N_stddev[row]);
+            for (int q = 0; q < results.num_quantiles; q++) printf(" %15.6e |", results.quantile[q][row]);
+            printf(" %15.6e | %11.6f |\n", results.N_analytical_mean[row], results.error_relative_percent[row]);
+        }
+        printf("%s\n", rule);
+        printf("Total step: %d, error relatif mean ensemble di akhir: %.6f%%\n",
+               steps, results.error_relative_percent[results.num_rows - 1]);
+
+        char name[128], label[64], filename[OUTPUT_PATH_MAX];
+        output_delta_t_label(label, sizeof(label), delta_t_values, num_cases, c);
+        snprintf(name, sizeof(name), "output_ensemble_%s_%s.csv", method_name, label);
+        output_path(filename, sizeof(filename), output_dir, name);
+        CsvWriter writer;
+        int csv_ok = write_csv && csv_writer_open(&writer, filename);
+        if (csv_ok) {
+            csv_ok = csv_writer_write_ensemble_header(&writer, &results) &&
+                     csv_writer_write_ensemble_rows(&writer, &results);
+            csv_ok = csv_writer_close(&writer) && csv_ok;
+        }
+        if (csv_ok) {
+            printf("Data statistik ensemble disimpan ke: %s\n", filename);
+        } else if (write_csv) {
+            printf("Error: Gagal menulis file %s.\n", filename);
+        }
+        printf("======================================================================\n");
+        ensemble_results_free(&results);
+    }
+    return 0;
+}
+
+/**
+ * JARINGAN PELURUHAN DARI PUSTAKA NUKLIDA
+ * =======================================
+ *
+ * Seluruh nuklida dan cabang pustaka dalam satu DecayNetwork (lihat
+ * network.h) dengan N0 atom parent pada t_start, dimajukan dengan
+ * network_solver_step per delta_t di sweep. Step CRAM akurat untuk Δt berapa
+ * pun, sehingga delta_t hanya menentukan resolusi keluaran; setiap kasus
+ * dibandingkan dengan satu step exp(A (t_akhir - t_start)) N0 dan diperiksa
+ * kekekalan jumlah atomnya. CSV output_network_<delta_t>.csv berisi kolom
+ * untuk nuklida yang terjangkau dari parent saja.
+ *
+ * Return:
+ * @return int - 0 jika berhasil, 1 jika simulasi gagal
+ */
+
+// Menandai nuklida yang terjangkau dari parent: dalam urutan topologis
+// setiap induk mendahului anaknya, sehingga satu lintasan maju cukup
+static int network_reachable(const DecayNetwork* network, int parent, int* species) {
+    int n = network->num_nuclides;
+    char* reached = (char*)calloc((size_t)n, 1);
+    if (reached == NULL) return -1;
+    int count = 0;
+    for (int p = 0; p < n; p++) {
+        int nuclide = network->order[p];
+        int hit = nuclide == parent;
+        for (int k = network->row_start[p]; k < network->row_start[p + 1] && !hit; k++) {
+            hit = reached[network->column[k]];
+        }
+        reached[p] = (char)hit;
+        if (hit) species[count++] = nuclide;
+    }
+    free(reached);
+    return count;
+}
+
+static int run_network(const DecayNetwork* network, int parent, double N0, double t_start, double t_end,
+                       const double* delta_t_values, int num_cases, int write_csv, const char* output_dir) {
+    int n = network->num_nuclides;
+    int* species = (int*)malloc((size_t)n * sizeof(int));
+    double* N = (double*)malloc((size_t)n * sizeof(double));
+    double* N_reference = (double*)malloc((size_t)n * sizeof(double));
+    NetworkSolver solver;
+    int ok = species != NULL && N != NULL && N_reference != NULL;
+    if (!ok) printf("Error: Gagal mengalokasikan memori untuk jaringan peluruhan.\n");
+    ok = ok && network_solver_init(&solver, network);
+    int num_species = ok ? network_reachable(network, parent, species) : 0;
+    if (ok && num_species < 0) {
+        printf("Error: Gagal mengalokasikan memori untuk jaringan peluruhan.\n");
+        network_solver_free(&solver);
+        ok = 0;
+    }
+    if (!ok) {
+        free(species);
+        free(N);
+        free(N_reference);
+        return 1;
+    }
+
+    double t_last = t_start;
+    for (int c = 0; c < num_cases; c++) {
+        double delta_t = delta_t_values[c];
+        int steps = euler_step_count(t_start, t_end, delta_t);
+        t_last = t_start + steps * delta_t;
+
+        char name[128], label[64], filename[OUTPUT_PATH_MAX];
+        output_delta_t_label(label, sizeof(label), delta_t_values, num_cases, c);
+        snprintf(name, sizeof(name), "output_network_%s.csv", label);
+        output_path(filename, sizeof(filename), output_dir, name);
+        CsvWriter writer;
+        int csv_opened = write_csv && csv_writer_open(&writer, filename);
+        int csv_ok = csv_opened && csv_writer_write_network_header(&writer, network, species, num_species);
+
+        double start = stats_now();
+        for (int i = 0; i < n; i++) N[i] = (i == parent) ? N0 : 0.0;
+        if (csv_ok) csv_ok = csv_writer_write_network_row(&writer, t_start, N, species, num_species);
+        for (int step = 1; step <= steps; step++) {
+            network_solver_step(&solver, delta_t, N, N);
+            if (csv_ok) csv_ok = csv_writer_write_network_row(&writer, t_start + step * delta_t, N,
+                                                             species, num_species);
+        }
+        double seconds = stats_now() - start;
+        if (csv_opened) csv_ok = csv_writer_close(&writer) && csv_ok;
+
+        // Referensi: satu step CRAM dari t_start ke waktu akhir yang sama
+        for (int i = 0; i < n; i++) N_reference[i] = (i == parent) ? N0 : 0.0;
+        network_solver_step(&solver, t_last - t_start, N_reference, N_reference);
+        double total = 0.0, deviation = 0.0;
+        for (int i = 0; i < n; i++) {
+            total += N[i];
+            double difference = fabs(N[i] - N_reference[i]) / N0;
+            if (difference > deviation) deviation = difference;
+        }
+
+        printf("\nJaringan Peluruhan %s dengan delta_t = %.4f s (%.2f jam):\n",
+               network->names[parent], delta_t, delta_t / 3600.0);
+        printf("Total step: %d (%.3f ms), kekekalan atom |sum N - N0| / N0 = %.2e, "
+               "deviasi maks. terhadap satu step / N0 = %.2e\n",
+               steps, seconds * 1e3, fabs(total - N0) / N0, deviation);
+        if (csv_ok) {
+            printf("Data hasil jaringan (%d nuklida) disimpan ke: %s\n", num_species, filename);
+        } else if (write_csv) {
+            printf("Error: Gagal menulis file %s.\n", filename);
+        }
+        printf("======================================================================\n");
+    }
+
+    // Populasi akhir nuklida terjangkau (referensi satu step kasus terakhir)
+    printf("\nPopulasi akhir pada t = %.1f s:\n", t_last);
+    printf("----------------------------------------------------------------------\n");
+    printf("| Nuklida      | Waktu Paruh (s) | N               | Aktivitas (Bq)  |\n");
+    printf("----------------------------------------------------------------------\n");
+    for (int s = 0; s < num_species; s++) {
+        int i = species[s];
+        printf("| %-12s | %15.6e | %15.6e | %15.6e |\n", network->names[i], network->half_life_s[i],
+               N_reference[i], network->lambda[i] * N_reference[i]);
+    }
+    printf("----------------------------------------------------------------------\n");
+
+    network_solver_free(&solver);
+    free(species);
+    free(N);
+    free(N_reference);
+    return 0;
+}
+
+// Fungsi evaluasi pencarian target: error relatif akhir dengan `steps` step
+// seragam (kernel streaming dengan reduktor error, tanpa file)
+static double target_case_error(void* context, int steps) {
+    const CaseConfig* config = (const CaseConfig*)context;
+    SweepCaseSummary summary;
+    run_case_summary(&summary, config, (config->t_end - config->t_start) / (double)steps);
+    return (summary.steps > 0) ? summary.final_error_relative_percent / 100.0 : INFINITY;
+}
+
+/**
+ * MODE TARGET AKURASI
+ * ===================
+ *
+ * Untuk setiap metode kandidat (semua metode, atau hanya --method), cari
+ * jumlah step seragam terkecil yang memberi error relatif akhir <= target
+ * (lihat convergence_search_steps), lalu ukur waktu satu run konfigurasi
+ * tersebut. Konfigurasi termurah adalah yang memerlukan evaluasi ruas kanan
+ * paling sedikit (step x tahap metode).
+ *
+ * @param base            - Parameter kasus (method diganti per kandidat)
+ * @param all_methods     - 1 untuk mencoba semua metode
+ * @param target_error    - Error relatif target (pecahan)
+ * @param max_steps       - Jumlah step maksimum per run
+ * @return int - 0 jika ada konfigurasi yang memenuhi target, 1 jika tidak
+ */
+static int run_target_search(const CaseConfig* base, int all_methods, double target_error, int max_steps) {
+    double time_span = base->t_end - base->t_start;
+    int best = -1;
+    long long best_cost = 0;
+    ConvergenceSearch searches[INTEGRATOR_COUNT];
+    double run_seconds[INTEGRATOR_COUNT];
+
+    printf("\nPencarian delta_t untuk error relatif akhir <= %.3e (maks. %d step per run):\n",
+           target_error, max_steps);
+    printf("----------------------------------------------------------------------------------------------------------------------------\n");
+    printf("| Metode         | Step       | delta_t (s)       | Error Relatif Akhir | Evaluasi f   | Run | Step Cari    | Waktu Cari (s) | Waktu Run (s) |\n");
+    printf("|----------------|------------|-------------------|---------------------|--------------|-----|--------------|----------------|---------------|\n");
+    for (int m = 0; m < INTEGRATOR_COUNT; m++) {
+        if (!all_methods && (IntegratorMethod)m != base->method) continue;
+        const IntegratorInfo* info = integrator_info((IntegratorMethod)m);
+        CaseConfig config = *base;
+        config.method = info->method;
+
+        ConvergenceSearch* search = &searches[m];
+        double start = stats_now();
+        convergence_search_steps(target_case_error, &config, time_span, target_error, max_steps, search);
+        double search_seconds = stats_now() - start;
+        if (!search->reached) {
+            printf("| %-14s | %10s | %17s | %19s | %12s | %3d | %12lld | %14.3e | %13s |\n",
+                   info->name, "-", "-", "-", "-", search->evaluations, search->total_steps,
+                   search_seconds, "-");
+            continue;
+        }
+
+        start = stats_now();
+        target_case_error(&config, search->steps);
+        run_seconds[m] = stats_now() - start;
+
+        long long cost = (long long)search->steps * info->stages;
+        printf("| %-14s | %10d | %17.6f | %19.4e | %12lld | %3d | %12lld | %14.3e | %13.3e |\n",
+               info->name, search->steps, time_span / search->steps, search->error, cost,
+               search->evaluations, search->total_steps, search_seconds, run_seconds[m]);
+        if (best < 0 || cost < best_cost) {
+            best = m;
+            best_cost = cost;
+        }
+    }
+    printf("----------------------------------------------------------------------------------------------------------------------------\n");
+
+    for (int m = 0; m < INTEGRATOR_COUNT; m++) {
+        if ((!all_methods && (IntegratorMethod)m != base->method) || searches[m].reached) continue;
+        if (isfinite(searches[m].predicted_steps)) {
+            printf("%s: target tidak tercapai (perkiraan model: %.3e step).\n",
+                   integrator_info((IntegratorMethod)m)->name, searches[m].predicted_steps);
+        } else {
+            printf("%s: target tidak tercapai (error berhenti turun, setingkat pembulatan).\n",
+                   integrator_info((IntegratorMethod)m)->name);
+        }
+    }
+    if (best < 0) {
+        printf("Tidak ada metode yang mencapai error relatif %.3e dalam %d step.\n", target_error, max_steps);
+        return 1;
+    }
+
+    const IntegratorInfo* info = integrator_info((IntegratorMethod)best);
+    printf("Konfigurasi termurah: %s dengan %d step (delta_t = %.6f s, %lld evaluasi f, %.3e s).\n",
+           info->name, searches[best].steps, time_span / searches[best].steps, best_cost, run_seconds[best]);
+    printf("Jalankan: --method %s --sweep list:%.17g\n", info->name, time_span / searches[best].steps);
+    return 0;
 }
 
 /**
  * FUNGSI UTAMA PROGRAM
  * ====================
  * 
- * Fungsi main menjalankan simulasi peluruhan Radon-222 dengan berbagai
- * ukuran step waktu (delta_t) untuk menganalisis akurasi metode Euler.
+ * Fungsi main menjalankan simulasi peluruhan (default Radon-222) dengan
+ * berbagai ukuran step waktu (delta_t) untuk menganalisis akurasi metode Euler.
+ * 
+ * Opsi baris perintah (semuanya juga dapat ditulis di file --config, lihat
+ * cli.h):
+ *   --config FILE
+ *              baca opsi dari file konfigurasi (kunci = nilai per baris)
+ *   --isotope NAMA|ZAI
+ *              nuklida (default Rn-222); tanpa --nuclide-data hanya label
+ *              dan nuklida selain Rn-222 memerlukan --half-life
+ *   --half-life X[ns|us|ms|s|m|h|d|y]
+ *              waktu paruh (default dari pustaka nuklida, atau 3.8235d)
+ *   --nuclide-data FILE
+ *              pustaka data nuklida (teks atau image biner, lihat nuclide.h),
+ *              mis. nuclides.txt
+ *   --compile-nuclides FILE
+ *              tulis pustaka --nuclide-data sebagai image biner terindeks
+ *              (dimuat dengan mmap) lalu keluar
+ *   --horizon T*x|T/x|DETIK
+ *              waktu akhir simulasi (default T*4)
+ *   --method euler|heun|rk4|rk45|backward-euler|crank-nicolson|exp-euler|cram
+ *              metode integrasi (default euler, lihat integrator.h)
+ *   --direct   gunakan mode evaluasi langsung (N_i = N₀ * r^i)
+ *   --precision PRESISI
+ *              mode presisi loop sekuensial: double (default), indexed-time,
+ *              kahan, double-double, long-double, float (lihat simulation.h)
+ *   --chain    simulasikan rantai Rn-222 -> Po-218 -> Pb-214 -> Bi-214 ->
+ *              Po-214 -> Pb-210 dengan referensi analitik Bateman per spesies
+ *              (lihat chain.h); metode default exp-euler. Dengan pustaka
+ *              nuklida, rantai --isotope mengikuti cabang dominan hingga anak
+ *              stabil
+ *   --network  dengan --nuclide-data: jaringan seluruh nuklida dan cabang
+ *              pustaka (lihat network.h) dari --isotope, dimajukan dengan CRAM
+ *              sparse per delta_t, ke output_network_<delta_t>.csv
+ *   --n0 X     jumlah atom awal (default 10^15)
+ *   --stochastic M
+ *              simulasi Monte Carlo dengan M trajektori per delta_t (lihat
+ *              stochastic.h): mean dan variansi ensemble di samping nilai
+ *              analitik, ke output_stochastic_<sampler>_<delta_t>.csv
+ *   --seed S   seed Philox untuk --stochastic dan --ensemble (default 1)
+ *   --gillespie
+ *              sampler event-per-event eksak (N0 kecil) alih-alih binomial
+ *   --ensemble M
+ *              M anggota dengan N0 dan waktu paruh terperturbasi dimajukan
+ *              bersama dengan --method (lihat ensemble.h): mean, simpangan
+ *              baku, dan kuantil N per baris, ke
+ *              output_ensemble_<metode>_<delta_t>.csv
+ *   --n0-spread S, --half-life-spread S
+ *              simpangan log-normal relatif N0 dan waktu paruh anggota
+ *              (default 0.05 dan 0.02)
+ *   --quantiles P,...
+ *              kuantil ensemble (default 0.025,0.5,0.975)
+ *   --adaptive satu run Dormand-Prince 5(4) dengan kontrol step adaptif dari
+ *              t = 0 hingga t_end (menggantikan sweep), ke output_adaptive.csv
+ *   --atol X, --rtol X
+ *              toleransi absolut (atom) dan relatif mode adaptif
+ *              (default 1 dan 1e-6)
+ *   --layout aos|soa
+ *              tata letak penyimpanan hasil (default aos)
+ *   --stream   mode streaming: hasil dikirim per chunk ke CSV dan reduktor
+ *              error tanpa menyimpan seluruh array
+ *   --format csv|binary|csv+binary|none
+ *              file hasil per kasus (default csv)
+ *   --binary   tulis juga output_*.bin (format biner kolumnar, lihat output.h)
+ *   --output-dir DIR
+ *              direktori semua file keluaran (dibuat jika belum ada)
+ *   -q, --quiet, -v, --verbose, --verbosity 0|1|2
+ *              tanpa header dan tabel per kasus sweep / cetak konfigurasi
+ *              lengkap sebelum run
+ *   --print-config
+ *              cetak konfigurasi hasil parsing (format --config) lalu keluar
+ *   --threads N
+ *              jumlah thread pekerja untuk sweep delta_t (default: jumlah
+ *              prosesor); keluaran konsol tetap dalam urutan kasus
+ *   --sweep SPEK
+ *              sweep delta_t, mis. "geom:T/10:T/10000:1000" (lihat sweep.h);
+ *              dapat diulang, nilai digabung sesuai urutan
+ *   --sweep-file FILE
+ *              baca spesifikasi sweep dari file
+ *   --summary-only
+ *              hanya tabel ringkasan (sweep_summary.csv), tanpa tabel konsol
+ *              dan file CSV per kasus
+ *   --richardson
+ *              setelah analisis konvergensi (orde teramati dari regresi
+ *              kuadrat terkecil, lihat convergence.h), ekstrapolasi
+ *              Richardson untuk setiap pasangan delta_t berurutan
+ *   --target-error X
+ *              cari jumlah step terkecil (dan metode dengan evaluasi ruas
+ *              kanan paling sedikit, kecuali --method diberikan) yang
+ *              memberi error relatif akhir <= X (menggantikan sweep)
+ *   --max-steps N
+ *              batas step per run untuk --target-error (default 10^8)
  */
-int main() {
-    // PARAMETER FISIK RADON-222
-    // =========================
-    double N0_initial = 1.0e15;           // Jumlah atom awal (10^15 atom)
-    double T_half_days = 3.8235;           // Waktu paruh Radon-222 dalam hari
-    double T_half_seconds = T_half_days * 24.0 * 60.0 * 60.0; // Konversi ke detik
-    
-    // PERHITUNGAN KONSTANTA PELURUHAN
-    // ===============================
+int main(int argc, char** argv) {
+    // OPSI BARIS PERINTAH DAN FILE KONFIGURASI
+    // ========================================
+    RunOptions options;
+    run_options_init(&options);
+    CliStatus status = run_options_parse_args(&options, argc, argv);
+    if (status != CLI_RUN) {
+        run_options_free(&options);
+        return (status == CLI_EXIT_SUCCESS) ? 0 : 1;
+    }
+
+    // KOMPILASI PUSTAKA NUKLIDA KE IMAGE BINER
+    // ========================================
+    if (options.compile_nuclides[0] != '\0') {
+        int ok = nuclide_library_write_image(&options.nuclides, options.compile_nuclides);
+        if (ok) {
+            printf("Pustaka nuklida %s (%u nuklida) ditulis ke %s (%zu byte).\n", options.nuclide_data,
+                   options.nuclides.num_nuclides, options.compile_nuclides, options.nuclides.block_bytes);
+        }
+        run_options_free(&options);
+        return ok ? 0 : 1;
+    }
+
+    // PARAMETER FISIK
+    // ===============
+    // Default Radon-222: N0 = 10^15 atom, T_half = 3.8235 hari, dan
     // λ = ln(2) / T_half (hubungan fundamental radioaktivitas)
-    double lambda_decay = log(2.0) / T_half_seconds;
+    double N0_initial = options.N0;
+    double T_half_seconds = options.half_life_s;
+    double lambda_decay = options.lambda;
 
     // PARAMETER SIMULASI
     // ==================
-    double t_start = 0.0;                  // Waktu awal (detik)
-    double t_end = 4.0 * T_half_seconds;   // Waktu akhir = 4 × waktu paruh
-
-    // ARRAY UKURAN step WAKTU UNTUK ANALISIS KONVERGENSI
-    // =====================================================
-    // Berbagai delta_t sebagai fraksi dari waktu paruh untuk studi konvergensi
-    double delta_t_values[] = {
-        T_half_seconds / 10.0,   // T_half/10  ≈ 9.18 jam
-        T_half_seconds / 20.0,   // T_half/20  ≈ 4.59 jam  
-        T_half_seconds / 50.0,   // T_half/50  ≈ 1.84 jam
-        T_half_seconds / 100.0,  // T_half/100 ≈ 0.92 jam
-        T_half_seconds / 200.0   // T_half/200 ≈ 0.46 jam
-    };
-    int num_delta_t_cases = sizeof(delta_t_values) / sizeof(delta_t_values[0]);
+    double t_start = options.t_start;      // Waktu awal (detik)
+    double t_end = options.t_end;          // Waktu akhir (default 4 × waktu paruh)
+
+    const char* output_dir = (options.output_dir[0] != '\0') ? options.output_dir : NULL;
+    if (output_dir != NULL && !output_make_directory(output_dir)) {
+        printf("Error: Gagal membuat direktori keluaran %s.\n", output_dir);
+        run_options_free(&options);
+        return 1;
+    }
+    if (options.verbosity >= CLI_VERBOSE) {
+        printf("Konfigurasi run:\n");
+        run_options_write(&options, stdout);
+        printf("======================================================================\n");
+    }
+
+    const double* delta_t_values = options.delta_t_sweep.values;
+    int num_delta_t_cases = options.delta_t_sweep.count;
+
+    if (options.adaptive && options.evaluation_mode != EULER_MODE_SEQUENTIAL) {
+        printf("Error: --direct/--precision tidak dapat digabung dengan --adaptive (grid waktu tidak seragam).\n");
+        run_options_free(&options);
+        return 1;
+    }
+    if (options.stochastic_trajectories > 0 &&
+        (options.use_chain || options.adaptive || options.method_given ||
+         options.evaluation_mode != EULER_MODE_SEQUENTIAL)) {
+        printf("Error: --stochastic tidak dapat digabung dengan --chain, --adaptive, --method, --direct, "
+               "atau --precision.\n");
+        run_options_free(&options);
+        return 1;
+    }
+    if (options.ensemble_members > 0 &&
+        (options.use_chain || options.adaptive || options.stochastic_trajectories > 0 ||
+         options.evaluation_mode != EULER_MODE_SEQUENTIAL)) {
+        printf("Error: --ensemble tidak dapat digabung dengan --chain, --adaptive, --stochastic, --direct, "
+               "atau --precision.\n");
+        run_options_free(&options);
+        return 1;
+    }
+    if (options.stochastic_sampler == STOCHASTIC_GILLESPIE && options.stochastic_trajectories == 0) {
+        printf("Error: --gillespie memerlukan --stochastic M.\n");
+        run_options_free(&options);
+        return 1;
+    }
+    if (options.richardson &&
+        (options.adaptive || options.stochastic_trajectories > 0 || options.ensemble_members > 0)) {
+        printf("Error: --richardson memerlukan sweep delta_t deterministik (tanpa --adaptive, --stochastic, atau --ensemble).\n");
+        run_options_free(&options);
+        return 1;
+    }
+    if (options.target_error > 0.0 &&
+        (options.use_chain || options.adaptive || options.stochastic_trajectories > 0 ||
+         options.ensemble_members > 0 || options.richardson)) {
+        printf("Error: --target-error tidak dapat digabung dengan --chain, --adaptive, --stochastic, "
+               "--ensemble, atau --richardson.\n");
+        run_options_free(&options);
+        return 1;
+    }
+    if (options.collect_stats &&
+        (options.use_chain || options.adaptive || options.stochastic_trajectories > 0 ||
+         options.ensemble_members > 0 || options.target_error > 0.0)) {
+        printf("Error: --stats hanya tersedia untuk sweep delta_t satu nuklida (tanpa --chain, --adaptive, "
+               "--stochastic, --ensemble, atau --target-error).\n");
+        run_options_free(&options);
+        return 1;
+    }
+    if (options.use_chain && (options.adaptive || options.evaluation_mode != EULER_MODE_SEQUENTIAL)) {
+        printf("Error: --chain tidak dapat digabung dengan --adaptive, --direct, atau --precision.\n");
+        run_options_free(&options);
+        return 1;
+    }
+
+    if (options.use_network &&
+        (options.use_chain || options.adaptive || options.stochastic_trajectories > 0 ||
+         options.ensemble_members > 0 || options.target_error > 0.0 || options.richardson ||
+         options.collect_stats || options.evaluation_mode != EULER_MODE_SEQUENTIAL ||
+         options.half_life_given || (options.method_given && options.method != INTEGRATOR_CRAM))) {
+        printf("Error: --network (selalu CRAM, waktu paruh dari pustaka) tidak dapat digabung dengan "
+               "--chain, --adaptive, --stochastic, --ensemble, --target-error, --richardson, --stats, "
+               "--direct, --precision, --half-life, atau --method selain cram.\n");
+        run_options_free(&options);
+        return 1;
+    }
+
+    // RANTAI PELURUHAN
+    // ================
+    // Dari pustaka nuklida (cabang dominan hingga anak stabil) jika dimuat,
+    // selain itu rantai Rn-222 bawaan. Anak berumur pendek membuat sistem
+    // kaku (λΔt >> 2), sehingga metode default untuk rantai adalah Euler
+    // eksponensial
+    DecayChain decay_chain;
+    if (options.nuclide != NULL) {
+        nuclide_library_chain(&options.nuclides, options.nuclide, N0_initial, &decay_chain);
+        decay_chain.species[0].half_life_s = T_half_seconds;
+        decay_chain.species[0].lambda = lambda_decay;
+    } else {
+        chain_radon222(&decay_chain, N0_initial, T_half_seconds);
+    }
+    if (options.use_chain) {
+        if (!chain_validate(&decay_chain)) {
+            run_options_free(&options);
+            return 1;
+        }
+        if (!options.method_given) options.method = INTEGRATOR_EXPONENTIAL_EULER;
+    }
+
+    // JARINGAN PELURUHAN
+    // ==================
+    // Seluruh nuklida dan cabang pustaka; indeks jaringan parent sama dengan
+    // indeks record-nya
+    DecayNetwork decay_network;
+    int network_parent = 0;
+    if (options.use_network) {
+        if (!nuclide_library_network(&options.nuclides, &decay_network)) {
+            run_options_free(&options);
+            return 1;
+        }
+        network_parent = (int)(options.nuclide - options.nuclides.records);
+        options.method = INTEGRATOR_CRAM;
+    }
 
     // HEADER INFORMASI PROGRAM
     // ========================
-    printf("Simulasi Peluruhan Radioaktif RADON-222 Menggunakan Metode Euler\n");
-    printf("N0 = %.2e atom\n", N0_initial);
-    printf("Waktu Paruh (T_half) = %.2f hari (%.2f s)\n", T_half_days, T_half_seconds);
-    printf("Konstanta Peluruhan (lambda) = %.4e s^-1\n", lambda_decay);
-    printf("Simulasi dari t = %.1f s hingga t = %.1f s (sekitar %.1f hari)\n", 
-           t_start, t_end, t_end / (24.0 * 3600.0));
-    printf("======================================================================\n");
+    const char* method_title = integrator_info(options.method)->display_name;
+    if (options.adaptive) method_title = "Dormand-Prince RK45 Adaptif";
+    if (options.target_error > 0.0 && !options.method_given) method_title = "Terpilih Otomatis (Target Akurasi)";
+    if (options.stochastic_trajectories > 0) {
+        method_title = (options.stochastic_sampler == STOCHASTIC_GILLESPIE) ? "Monte Carlo (Gillespie)"
+                                                                            : "Monte Carlo (Binomial)";
+    }
+    if (options.verbosity >= CLI_NORMAL) {
+        printf("Simulasi Peluruhan Radioaktif %s%s Menggunakan Metode %s\n", options.isotope,
+               options.use_chain ? " (Rantai Peluruhan)" : options.use_network ? " (Jaringan Peluruhan)"
+               : (options.ensemble_members > 0) ? " (Ensemble Parameter)" : "",
+               method_title);
+        printf("N0 = %.2e atom\n", N0_initial);
+        printf("Waktu Paruh (T_half) = %.2f hari (%.2f s)\n", T_half_seconds / (24.0 * 3600.0), T_half_seconds);
+        printf("Konstanta Peluruhan (lambda) = %.4e s^-1\n", lambda_decay);
+        printf("Simulasi dari t = %.1f s hingga t = %.1f s (sekitar %.1f hari)\n", 
+               t_start, t_end, t_end / (24.0 * 3600.0));
+        if (options.nuclides_loaded) {
+            printf("Pustaka nuklida: %s (%u nuklida, %s, dimuat dalam %.3f ms)\n", options.nuclide_data,
+                   options.nuclides.num_nuclides, options.nuclides.mapped ? "image mmap" : "dibaca",
+                   options.nuclides_load_seconds * 1e3);
+        }
+        if (output_dir != NULL) printf("Direktori keluaran: %s\n", output_dir);
+        if (options.evaluation_mode != EULER_MODE_SEQUENTIAL) {
+            printf("Mode evaluasi: %s\n", evaluation_mode_name(options.evaluation_mode));
+        }
+        if (options.use_chain) {
+            printf("Rantai:");
+            for (int i = 0; i < decay_chain.num_species; i++) {
+                printf("%s %s (T_half = %.4e s)", (i > 0) ? " ->" : "",
+                       decay_chain.species[i].name, decay_chain.species[i].half_life_s);
+            }
+            printf("\n");
+            if (options.write_binary) printf("Catatan: --binary belum didukung untuk --chain; hanya CSV yang ditulis.\n");
+        }
+        if (options.use_network) {
+            printf("Jaringan: %d nuklida, %d transisi (%.1f KiB)\n", decay_network.num_nuclides,
+                   decay_network.num_nonzeros, network_bytes(&decay_network) / 1024.0);
+            if (options.write_binary) printf("Catatan: --binary belum didukung untuk --network; hanya CSV yang ditulis.\n");
+        }
+        if (options.ensemble_members > 0) {
+            printf("Ensemble: %llu anggota, N0 dan waktu paruh log-normal dengan spread %.4g dan %.4g "
+                   "(seed %llu)\n", options.ensemble_members, options.ensemble_N0_spread,
+                   options.ensemble_half_life_spread, options.seed);
+        }
+        printf("======================================================================\n");
+    }
 
-    // LOOP UTAMA: SIMULASI UNTUK BERBAGAI DELTA_T
-    // ===========================================
-    for (int i = 0; i < num_delta_t_cases; i++) {
-        double current_delta_t = delta_t_values[i];
-        SimulationStep* simulation_results = NULL;
-
-        // PANGGIL FUNGSI SIMULASI EULER
-        // =============================
-        int actual_steps = euler_radioactive_decay(
-            N0_initial, lambda_decay,
-            t_start, t_end, current_delta_t,
-            &simulation_results
-        );
+    // MODE JARINGAN: SATU RUN CRAM SPARSE PER DELTA_T
+    // ===============================================
+    if (options.use_network) {
+        int failed = run_network(&decay_network, network_parent, N0_initial, t_start, t_end,
+                                 delta_t_values, num_delta_t_cases, options.write_csv, output_dir);
+        network_free(&decay_network);
+        run_options_free(&options);
+        return failed;
+    }
 
-        // VALIDASI HASIL SIMULASI
-        // =======================
-        if (simulation_results != NULL && actual_steps > 0) {
-            
-            // TAMPILKAN STATISTIK SIMULASI
-            // ============================
-            printf("Total step untuk delta_t = %.2f s (%.2f jam) adalah %d.\n",
-                   current_delta_t, current_delta_t / 3600.0, actual_steps);
-            printf("Error absolut akhir (pada t=%.1f s): %.3e atom\n",
-                   simulation_results[actual_steps - 1].time_s,
-                   simulation_results[actual_steps - 1].error_absolute);
-            printf("Error relatif akhir: %.4f %%\n",
-                   simulation_results[actual_steps - 1].error_relative_percent);
-
-            // EKSPOR DATA KE FILE CSV
-            // =======================
-            // Buat nama file unik berdasarkan delta_t
-            char filename[100];
-            sprintf(filename, "output_%.0f.csv", current_delta_t);
-            FILE *fp = fopen(filename, "w");
-
-            if (fp != NULL) {
-                // Header CSV
-                fprintf(fp, "Time_s,N_Numerical,N_Analytical,Error_Absolute,Error_Relative_Percent\n");
-                
-                // Tulis semua data simulasi ke CSV
-                for (int j = 0; j < actual_steps; j++) {
-                    fprintf(fp, "%.4f,%.6e,%.6e,%.6e,%.6f\n",
-                            simulation_results[j].time_s,
-                            simulation_results[j].N_numerical,
-                            simulation_results[j].N_analytical,
-                            simulation_results[j].error_absolute,
-                            simulation_results[j].error_relative_percent);
-                }
-                fclose(fp);
-                printf("Data hasil simulasi disimpan ke: %s\n", filename);
-            } else {
-                printf("Error: Gagal membuka file %s untuk ditulis.\n", filename);
-            }
+    // MODE ENSEMBLE PARAMETER: SATU RUN LOCKSTEP PER DELTA_T
+    // ======================================================
+    if (options.ensemble_members > 0) {
+        EnsembleMembers members;
+        if (!ensemble_members_allocate(&members, (long long)options.ensemble_members)) {
+            printf("Error: Gagal mengalokasikan memori untuk anggota ensemble.\n");
+            run_options_free(&options);
+            return 1;
+        }
+        ensemble_members_perturb(&members, N0_initial, lambda_decay, options.ensemble_N0_spread,
+                                 options.ensemble_half_life_spread, (uint64_t)options.seed,
+                                 options.num_threads);
+        EnsembleConfig config = {
+            &members, t_start, t_end, 0.0, options.method, options.ensemble_quantiles,
+            options.num_ensemble_quantiles, options.num_threads
+        };
+        int failed = run_ensemble(&config, delta_t_values, num_delta_t_cases, options.write_csv, output_dir);
+        ensemble_members_free(&members);
+        run_options_free(&options);
+        return failed;
+    }
 
-            printf("======================================================================\n");
+    // MODE STOKASTIK: SATU ENSEMBLE PER DELTA_T
+    // =========================================
+    if (options.stochastic_trajectories > 0) {
+        StochasticConfig config = {
+            N0_initial, lambda_decay, t_start, t_end, 0.0, (long long)options.stochastic_trajectories,
+            (uint64_t)options.seed, options.stochastic_sampler, options.num_threads
+        };
+        int failed = run_stochastic(&config, delta_t_values, num_delta_t_cases, options.write_csv, output_dir);
+        run_options_free(&options);
+        return failed;
+    }
 
-            // Dealokasi memori untuk mencegah memory leak
-            free(simulation_results);
-            simulation_results = NULL;
-            
-        } else {
-            // ERROR HANDLING
-            printf("Simulasi gagal atau tidak ada step untuk delta_t = %.2f s.\n", current_delta_t);
-            printf("======================================================================\n");
+    // MODE ADAPTIF: SATU RUN, TANPA SWEEP DELTA_T
+    // ===========================================
+    if (options.adaptive) {
+        CaseConfig config = { N0_initial, lambda_decay, t_start, t_end, INTEGRATOR_RK45,
+                              EULER_MODE_SEQUENTIAL, options.result_layout, options.write_binary, NULL,
+                              options.write_csv, output_dir, options.isotope, NULL, 0 };
+        int failed = run_adaptive(&config, &options.adaptive_control, options.streaming);
+        run_options_free(&options);
+        return failed;
+    }
+
+    // MODE TARGET AKURASI: CARI DELTA_T/METODE TERMURAH, TANPA SWEEP
+    // ==============================================================
+    if (options.target_error > 0.0) {
+        CaseConfig config = { N0_initial, lambda_decay, t_start, t_end, options.method,
+                              options.evaluation_mode, RESULT_LAYOUT_SOA, 0, NULL, 0, NULL, NULL, NULL, 0 };
+        int failed = run_target_search(&config, !options.method_given, options.target_error,
+                                       (int)options.target_max_steps);
+        run_options_free(&options);
+        return failed;
+    }
+
+    // LOOP UTAMA: SIMULASI UNTUK BERBAGAI DELTA_T
+    // ===========================================
+    SweepCaseSummary* summaries =
+        (SweepCaseSummary*)calloc((size_t)num_delta_t_cases, sizeof(SweepCaseSummary));
+    if (summaries == NULL) {
+        printf("Error: Gagal mengalokasikan memori untuk ringkasan sweep.\n");
+        run_options_free(&options);
+        return 1;
+    }
+    RunStats* case_stats = NULL;
+    if (options.collect_stats) {
+        case_stats = (RunStats*)calloc((size_t)num_delta_t_cases, sizeof(RunStats));
+        if (case_stats == NULL) {
+            printf("Error: Gagal mengalokasikan memori untuk instrumentasi.\n");
+            free(summaries);
+            run_options_free(&options);
+            return 1;
         }
     }
+    SweepContext sweep = {
+        { N0_initial, lambda_decay, t_start, t_end, options.method, options.evaluation_mode,
+          options.result_layout, options.write_binary, options.use_chain ? &decay_chain : NULL,
+          options.write_csv, output_dir, options.isotope, delta_t_values, num_delta_t_cases },
+        delta_t_values, options.streaming, options.summary_only, options.verbosity == CLI_QUIET,
+        NULL, summaries, case_stats
+    };
+    run_sweep(&sweep, num_delta_t_cases, options.num_threads);
+
+    // TABEL RINGKASAN SWEEP
+    // =====================
+    print_sweep_summary(summaries, num_delta_t_cases);
+    print_convergence_analysis(summaries, num_delta_t_cases, options.method, options.richardson,
+                               options.use_chain, t_end - t_start);
+    if (case_stats != NULL) {
+        print_run_stats(&sweep.config, summaries, case_stats, num_delta_t_cases, !options.summary_only);
+        free(case_stats);
+    }
+    char summary_filename[OUTPUT_PATH_MAX];
+    output_path(summary_filename, sizeof(summary_filename), output_dir, SWEEP_SUMMARY_FILENAME);
+    if (sweep_write_summary_csv(summary_filename, summaries, num_delta_t_cases)) {
+        printf("Ringkasan %d kasus disimpan ke: %s\n", num_delta_t_cases, summary_filename);
+    } else {
+        printf("Error: Gagal menulis ringkasan ke file %s.\n", summary_filename);
+    }
 
+    free(summaries);
+    run_options_free(&options);
     return 0; 
 }
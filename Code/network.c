@@ -0,0 +1,361 @@
+/**
+ * ========================================================================
+ * IMPLEMENTASI JARINGAN PELURUHAN SPARSE (CRAM)
+ * ========================================================================
+ *
+ * Lihat network.h untuk bentuk matriks dan urutan topologis.
+ */
+
+#include "network.h"
+
+#include <complex.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Toleransi jumlah rasio percabangan per induk (data nuklir dibulatkan)
+#define NETWORK_BRANCHING_TOLERANCE 1e-6
+
+void network_init(DecayNetwork* network) {
+    memset(network, 0, sizeof(*network));
+}
+
+// Membuang bentuk terkompilasi (dipanggil ulang jika jaringan berubah)
+static void network_free_compiled(DecayNetwork* network) {
+    free(network->order);
+    free(network->row_start);
+    free(network->column);
+    free(network->rate);
+    free(network->sorted_lambda);
+    network->order = NULL;
+    network->row_start = NULL;
+    network->column = NULL;
+    network->rate = NULL;
+    network->sorted_lambda = NULL;
+    network->num_nonzeros = 0;
+    network->finalized = 0;
+}
+
+void network_free(DecayNetwork* network) {
+    network_free_compiled(network);
+    free(network->names);
+    free(network->half_life_s);
+    free(network->lambda);
+    free(network->transitions);
+    network_init(network);
+}
+
+/**
+ * MEMBANGUN JARINGAN
+ * ==================
+ */
+int network_add_nuclide(DecayNetwork* network, const char* name, double half_life_s) {
+    if (!(half_life_s > 0.0)) {
+        printf("Error: Waktu paruh %s harus positif (INFINITY untuk nuklida stabil).\n", name);
+        return -1;
+    }
+    if (network->num_nuclides == network->nuclide_capacity) {
+        int capacity = network->nuclide_capacity ? network->nuclide_capacity * 2 : 64;
+        char (*names)[NETWORK_NAME_BYTES] = realloc(network->names, (size_t)capacity * NETWORK_NAME_BYTES);
+        if (names != NULL) network->names = names;
+        double* half_life = realloc(network->half_life_s, (size_t)capacity * sizeof(double));
+        if (half_life != NULL) network->half_life_s = half_life;
+        double* lambda = realloc(network->lambda, (size_t)capacity * sizeof(double));
+        if (lambda != NULL) network->lambda = lambda;
+        if (names == NULL || half_life == NULL || lambda == NULL) {
+            printf("Error: Gagal mengalokasikan memori untuk nuklida jaringan.\n");
+            return -1;
+        }
+        network->nuclide_capacity = capacity;
+    }
+
+    int index = network->num_nuclides++;
+    snprintf(network->names[index], NETWORK_NAME_BYTES, "%s", name);
+    network->half_life_s[index] = half_life_s;
+    network->lambda[index] = isinf(half_life_s) ? 0.0 : log(2.0) / half_life_s;
+    network_free_compiled(network);
+    return index;
+}
+
+int network_add_transition(DecayNetwork* network, int parent, int daughter, double branching) {
+    if (parent < 0 || parent >= network->num_nuclides || daughter < 0 ||
+        daughter >= network->num_nuclides || parent == daughter) {
+        printf("Error: Transisi jaringan %d -> %d tidak valid.\n", parent, daughter);
+        return 0;
+    }
+    if (!(branching > 0.0 && branching <= 1.0)) {
+        printf("Error: Rasio percabangan %s -> %s harus di (0, 1].\n",
+               network->names[parent], network->names[daughter]);
+        return 0;
+    }
+    if (network->num_transitions == network->transition_capacity) {
+        int capacity = network->transition_capacity ? network->transition_capacity * 2 : 64;
+        NetworkTransition* transitions = realloc(network->transitions,
+                                                 (size_t)capacity * sizeof(NetworkTransition));
+        if (transitions == NULL) {
+            printf("Error: Gagal mengalokasikan memori untuk transisi jaringan.\n");
+            return 0;
+        }
+        network->transitions = transitions;
+        network->transition_capacity = capacity;
+    }
+
+    network->transitions[network->num_transitions++] = (NetworkTransition){ parent, daughter, branching };
+    network_free_compiled(network);
+    return 1;
+}
+
+int network_find(const DecayNetwork* network, const char* name) {
+    for (int i = 0; i < network->num_nuclides; i++) {
+        if (strncmp(network->names[i], name, NETWORK_NAME_BYTES) == 0) return i;
+    }
+    return -1;
+}
+
+/**
+ * FINALISASI: VALIDASI, URUTAN TOPOLOGIS, DAN CSR
+ * ===============================================
+ *
+ * Urutan topologis dengan algoritma Kahn (antrian diproses menurut indeks
+ * sehingga hasilnya deterministik). Jika tidak semua nuklida terurut,
+ * jaringan memiliki siklus dan A tidak dapat dibuat segitiga.
+ */
+static int network_validate(const DecayNetwork* network) {
+    int n = network->num_nuclides;
+    double* branching_sum = (double*)calloc((size_t)n, sizeof(double));
+    if (branching_sum == NULL) {
+        printf("Error: Gagal mengalokasikan memori untuk validasi jaringan.\n");
+        return 0;
+    }
+
+    int ok = 1;
+    for (int t = 0; t < network->num_transitions; t++) {
+        branching_sum[network->transitions[t].parent] += network->transitions[t].branching;
+    }
+    for (int i = 0; i < n && ok; i++) {
+        if (branching_sum[i] > 1.0 + NETWORK_BRANCHING_TOLERANCE) {
+            printf("Error: Jumlah rasio percabangan %s adalah %.6f (> 1).\n",
+                   network->names[i], branching_sum[i]);
+            ok = 0;
+        } else if (branching_sum[i] > 0.0 && network->lambda[i] == 0.0) {
+            printf("Error: Nuklida stabil %s tidak boleh memiliki anak.\n", network->names[i]);
+            ok = 0;
+        }
+    }
+
+    free(branching_sum);
+    return ok;
+}
+
+// Mengurutkan entri satu baris menurut kolom lalu menggabungkan duplikat
+static int merge_row(int* column, double* rate, int count) {
+    for (int i = 1; i < count; i++) {
+        int c = column[i];
+        double r = rate[i];
+        int j = i - 1;
+        for (; j >= 0 && column[j] > c; j--) {
+            column[j + 1] = column[j];
+            rate[j + 1] = rate[j];
+        }
+        column[j + 1] = c;
+        rate[j + 1] = r;
+    }
+    int merged = 0;
+    for (int i = 0; i < count; i++) {
+        if (merged > 0 && column[merged - 1] == column[i]) {
+            rate[merged - 1] += rate[i];
+        } else {
+            column[merged] = column[i];
+            rate[merged] = rate[i];
+            merged++;
+        }
+    }
+    return merged;
+}
+
+int network_finalize(DecayNetwork* network) {
+    network_free_compiled(network);
+    int n = network->num_nuclides;
+    int num_transitions = network->num_transitions;
+    if (n < 1) {
+        printf("Error: Jaringan peluruhan kosong.\n");
+        return 0;
+    }
+    if (!network_validate(network)) return 0;
+
+    // Daftar anak per induk (CSR sementara) dan derajat masuk
+    int* child_start = (int*)calloc((size_t)n + 1, sizeof(int));
+    int* children = (int*)malloc(((size_t)num_transitions + 1) * sizeof(int));
+    int* in_degree = (int*)calloc((size_t)n, sizeof(int));
+    int* position = (int*)malloc((size_t)n * sizeof(int));
+    network->order = (int*)malloc((size_t)n * sizeof(int));
+    network->row_start = (int*)calloc((size_t)n + 1, sizeof(int));
+    network->column = (int*)malloc(((size_t)num_transitions + 1) * sizeof(int));
+    network->rate = (double*)malloc(((size_t)num_transitions + 1) * sizeof(double));
+    network->sorted_lambda = (double*)malloc((size_t)n * sizeof(double));
+    int ok = child_start && children && in_degree && position && network->order &&
+             network->row_start && network->column && network->rate && network->sorted_lambda;
+    if (!ok) printf("Error: Gagal mengalokasikan memori untuk jaringan terkompilasi.\n");
+
+    if (ok) {
+        for (int t = 0; t < num_transitions; t++) {
+            child_start[network->transitions[t].parent + 1]++;
+            in_degree[network->transitions[t].daughter]++;
+        }
+        for (int i = 0; i < n; i++) child_start[i + 1] += child_start[i];
+        int* fill = position;   // dipinjam sebagai penghitung isi
+        memcpy(fill, child_start, (size_t)n * sizeof(int));
+        for (int t = 0; t < num_transitions; t++) {
+            children[fill[network->transitions[t].parent]++] = network->transitions[t].daughter;
+        }
+
+        // Kahn: order[] sekaligus berfungsi sebagai antrian
+        int head = 0, tail = 0;
+        for (int i = 0; i < n; i++) {
+            if (in_degree[i] == 0) network->order[tail++] = i;
+        }
+        while (head < tail) {
+            int parent = network->order[head++];
+            for (int k = child_start[parent]; k < child_start[parent + 1]; k++) {
+                if (--in_degree[children[k]] == 0) network->order[tail++] = children[k];
+            }
+        }
+        if (tail < n) {
+            printf("Error: Jaringan peluruhan memiliki siklus (%d nuklida tidak dapat diurutkan).\n",
+                   n - tail);
+            ok = 0;
+        }
+    }
+
+    if (ok) {
+        for (int p = 0; p < n; p++) {
+            position[network->order[p]] = p;
+            network->sorted_lambda[p] = network->lambda[network->order[p]];
+        }
+
+        // Baris CSR per anak (posisi topologis), lalu gabungkan duplikat
+        int* row_fill = in_degree;   // dipinjam lagi; semuanya 0 setelah Kahn
+        for (int t = 0; t < num_transitions; t++) {
+            network->row_start[position[network->transitions[t].daughter] + 1]++;
+        }
+        for (int p = 0; p < n; p++) network->row_start[p + 1] += network->row_start[p];
+        for (int t = 0; t < num_transitions; t++) {
+            const NetworkTransition* transition = &network->transitions[t];
+            int row = position[transition->daughter];
+            int slot = network->row_start[row] + row_fill[row]++;
+            network->column[slot] = position[transition->parent];
+            network->rate[slot] = transition->branching * network->lambda[transition->parent];
+        }
+
+        int nonzeros = 0;
+        for (int p = 0; p < n; p++) {
+            int start = network->row_start[p];
+            int count = network->row_start[p + 1] - start;
+            network->row_start[p] = nonzeros;
+            memmove(&network->column[nonzeros], &network->column[start], (size_t)count * sizeof(int));
+            memmove(&network->rate[nonzeros], &network->rate[start], (size_t)count * sizeof(double));
+            nonzeros += merge_row(&network->column[nonzeros], &network->rate[nonzeros], count);
+        }
+        network->row_start[n] = nonzeros;
+        network->num_nonzeros = nonzeros;
+        network->finalized = 1;
+    }
+
+    free(child_start);
+    free(children);
+    free(in_degree);
+    free(position);
+    if (!ok) network_free_compiled(network);
+    return ok;
+}
+
+size_t network_bytes(const DecayNetwork* network) {
+    size_t bytes = (size_t)network->nuclide_capacity * (NETWORK_NAME_BYTES + 2 * sizeof(double)) +
+                   (size_t)network->transition_capacity * sizeof(NetworkTransition);
+    if (network->finalized) {
+        size_t n = (size_t)network->num_nuclides;
+        size_t transitions = (size_t)network->num_transitions + 1;
+        bytes += n * sizeof(int) + (n + 1) * sizeof(int) + n * sizeof(double) +
+                 transitions * (sizeof(int) + sizeof(double));
+    }
+    return bytes;
+}
+
+int network_from_chain(const DecayChain* chain, DecayNetwork* network) {
+    network_init(network);
+    int ok = 1;
+    for (int i = 0; i < chain->num_species && ok; i++) {
+        ok = network_add_nuclide(network, chain->species[i].name, chain->species[i].half_life_s) == i;
+    }
+    for (int i = 0; i + 1 < chain->num_species && ok; i++) {
+        ok = network_add_transition(network, i, i + 1, chain->species[i].branching);
+    }
+    ok = ok && network_finalize(network);
+    if (!ok) network_free(network);
+    return ok;
+}
+
+/**
+ * STEP CRAM
+ * =========
+ *
+ * Untuk setiap kutub θ_j: (AΔt - θ_j I) x = α_j y dengan substitusi maju
+ * dalam urutan topologis,
+ *
+ *   x_p = (α_j y_p - Δt Σ_k rate_pk x_k) / (-λ_p Δt - θ_j),
+ *
+ * lalu hasil = α0 y + 2 Re Σ_j x. Ruang kerja: x kompleks (2n double), y
+ * terurut (n), dan akumulator hasil terurut (n).
+ */
+int network_solver_init(NetworkSolver* solver, const DecayNetwork* network) {
+    solver->network = network;
+    solver->workspace = NULL;
+    if (!network->finalized) {
+        printf("Error: Jaringan peluruhan belum difinalisasi.\n");
+        return 0;
+    }
+    solver->workspace = (double*)malloc(4 * (size_t)network->num_nuclides * sizeof(double));
+    if (solver->workspace == NULL) {
+        printf("Error: Gagal mengalokasikan ruang kerja solver jaringan.\n");
+        return 0;
+    }
+    return 1;
+}
+
+void network_solver_free(NetworkSolver* solver) {
+    free(solver->workspace);
+    solver->workspace = NULL;
+}
+
+void network_solver_step(NetworkSolver* solver, double delta_t, const double* N_in, double* N_out) {
+    const DecayNetwork* network = solver->network;
+    int n = network->num_nuclides;
+    const int* order = network->order;
+    const int* row_start = network->row_start;
+    const int* column = network->column;
+    const double* rate = network->rate;
+    const double* lambda = network->sorted_lambda;
+
+    double complex* x = (double complex*)solver->workspace;
+    double* y = solver->workspace + 2 * (size_t)n;
+    double* result = y + n;
+
+    for (int p = 0; p < n; p++) {
+        y[p] = N_in[order[p]];
+        result[p] = integrator_cram_alpha0 * y[p];
+    }
+
+    for (int j = 0; j < CRAM_NUM_POLES; j++) {
+        double complex alpha = integrator_cram_alpha[j][0] + integrator_cram_alpha[j][1] * I;
+        double complex theta = integrator_cram_theta[j][0] + integrator_cram_theta[j][1] * I;
+        for (int p = 0; p < n; p++) {
+            double complex source = 0.0;
+            for (int k = row_start[p]; k < row_start[p + 1]; k++) source += rate[k] * x[column[k]];
+            x[p] = (alpha * y[p] - delta_t * source) / (-delta_t * lambda[p] - theta);
+            result[p] += 2.0 * creal(x[p]);
+        }
+    }
+
+    for (int p = 0; p < n; p++) N_out[order[p]] = result[p];
+}
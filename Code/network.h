@@ -0,0 +1,146 @@
+/**
+ * ========================================================================
+ * MODUL JARINGAN PELURUHAN SPARSE DENGAN EKSPONENSIAL MATRIKS (CRAM)
+ * ========================================================================
+ *
+ * Jaringan umum berisi ribuan nuklida dengan beberapa anak per induk
+ * (percabangan alfa/beta, transisi isomerik). Sistemnya dN/dt = A N dengan
+ *
+ *   A_ii = -λ_i,   A_ji = b_{i->j} λ_i  (laju pembentukan j dari induk i)
+ *
+ * Matriks disimpan sparse (CSR per baris anak), sehingga memori tumbuh
+ * dengan jumlah transisi, bukan N². Karena peluruhan tidak pernah kembali ke
+ * induknya, nuklida dapat diurutkan topologis (induk sebelum anak) sehingga
+ * A segitiga bawah: setiap sistem (AΔt - θI) x = α N pada CRAM (lihat
+ * integrator.h) diselesaikan dengan satu substitusi maju tanpa fill-in,
+ * berbiaya O(nuklida + transisi) per kutub. Satu step dengan Δt berapa pun
+ * menghasilkan exp(AΔt) N dengan error relatif terhadap |N| sekitar 10^-14;
+ * tidak ada batas stabilitas dan tidak perlu step kecil untuk nuklida
+ * berumur pendek.
+ *
+ * Pemakaian:
+ *   network_init -> network_add_nuclide / network_add_transition ->
+ *   network_finalize -> network_solver_init -> network_solver_step ...
+ */
+
+#ifndef NETWORK_H
+#define NETWORK_H
+
+#include <stddef.h>
+
+#include "chain.h"
+
+#define NETWORK_NAME_BYTES 16
+
+/**
+ * SATU TRANSISI INDUK -> ANAK
+ */
+typedef struct {
+    int parent;
+    int daughter;
+    double branching;                 // Fraksi peluruhan induk ke anak ini
+} NetworkTransition;
+
+/**
+ * JARINGAN PELURUHAN
+ * ==================
+ *
+ * Nuklida diindeks menurut urutan penambahan. Setelah network_finalize,
+ * bentuk terkompilasi tersedia dalam urutan topologis: baris p dari CSR
+ * adalah nuklida order[p], dan kolomnya adalah posisi topologis induk.
+ */
+typedef struct {
+    int num_nuclides;
+    int nuclide_capacity;
+    char (*names)[NETWORK_NAME_BYTES];
+    double* half_life_s;              // INFINITY = stabil
+    double* lambda;                   // 0 untuk nuklida stabil
+
+    int num_transitions;
+    int transition_capacity;
+    NetworkTransition* transitions;
+
+    // Bentuk terkompilasi (network_finalize)
+    int finalized;
+    int* order;                       // Posisi topologis -> indeks nuklida
+    int* row_start;                   // CSR, num_nuclides + 1 entri
+    int* column;                      // Posisi topologis induk
+    double* rate;                     // b λ_induk (s⁻¹)
+    double* sorted_lambda;            // λ menurut posisi topologis
+    int num_nonzeros;                 // Entri di luar diagonal (transisi setelah digabung)
+} DecayNetwork;
+
+void network_init(DecayNetwork* network);
+void network_free(DecayNetwork* network);
+
+/**
+ * Menambah nuklida; half_life_s = INFINITY untuk nuklida stabil.
+ *
+ * @return int - Indeks nuklida, atau -1 jika waktu paruh tidak valid atau
+ *               alokasi gagal
+ */
+int network_add_nuclide(DecayNetwork* network, const char* name, double half_life_s);
+
+/**
+ * Menambah transisi parent -> daughter dengan rasio percabangan (0, 1].
+ * Transisi ganda antara pasangan yang sama dijumlahkan saat finalize.
+ *
+ * @return int - 1 jika berhasil, 0 jika indeks/rasio tidak valid atau
+ *               alokasi gagal
+ */
+int network_add_transition(DecayNetwork* network, int parent, int daughter, double branching);
+
+/**
+ * Mencari nuklida berdasarkan nama (pencarian linear).
+ *
+ * @return int - Indeks nuklida, atau -1 jika tidak ada
+ */
+int network_find(const DecayNetwork* network, const char* name);
+
+/**
+ * Memvalidasi jaringan (jumlah percabangan per induk <= 1, tanpa siklus)
+ * lalu membangun bentuk CSR terurut topologis. Pesan error dicetak ke
+ * stdout.
+ *
+ * @return int - 1 jika berhasil, 0 jika tidak
+ */
+int network_finalize(DecayNetwork* network);
+
+/**
+ * Memori yang dipakai jaringan (termasuk bentuk terkompilasi), dalam byte.
+ */
+size_t network_bytes(const DecayNetwork* network);
+
+/**
+ * Membangun jaringan (sudah difinalisasi) dari rantai linear.
+ *
+ * @return int - 1 jika berhasil, 0 jika tidak
+ */
+int network_from_chain(const DecayChain* chain, DecayNetwork* network);
+
+/**
+ * SOLVER CRAM
+ * ===========
+ *
+ * Menyimpan ruang kerja (vektor kompleks dan N terurut topologis) agar step
+ * tidak mengalokasikan memori.
+ */
+typedef struct {
+    const DecayNetwork* network;
+    double* workspace;                // 4 * num_nuclides double
+} NetworkSolver;
+
+/**
+ * @return int - 1 jika berhasil, 0 jika jaringan belum difinalisasi atau
+ *               alokasi gagal
+ */
+int network_solver_init(NetworkSolver* solver, const DecayNetwork* network);
+void network_solver_free(NetworkSolver* solver);
+
+/**
+ * N_out = exp(A Δt) N_in (diindeks menurut indeks nuklida). N_in dan N_out
+ * boleh menunjuk array yang sama.
+ */
+void network_solver_step(NetworkSolver* solver, double delta_t, const double* N_in, double* N_out);
+
+#endif // NETWORK_H
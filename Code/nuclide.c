@@ -0,0 +1,743 @@
+/**
+ * ========================================================================
+ * IMPLEMENTASI PUSTAKA DATA NUKLIDA
+ * ========================================================================
+ *
+ * Lihat nuclide.h untuk format file teks dan layout image biner.
+ */
+
+#include "nuclide.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define NUCLIDE_IMAGE_MAGIC "DKNUCLIB"
+#define NUCLIDE_IMAGE_VERSION 1u
+#define NUCLIDE_BYTE_ORDER_MARK 0x01020304u
+
+// Toleransi jumlah rasio cabang di atas 1 (pembulatan data sumber)
+#define NUCLIDE_BRANCH_SUM_TOLERANCE 1.0e-6
+
+// Satu tahun Julian dalam detik
+#define SECONDS_PER_YEAR (365.25 * 24.0 * 3600.0)
+
+/**
+ * NAMA DAN ZAI
+ * ============
+ */
+static const char* const element_symbols[] = {
+    "",
+    "H", "He", "Li", "Be", "B", "C", "N", "O", "F", "Ne",
+    "Na", "Mg", "Al", "Si", "P", "S", "Cl", "Ar", "K", "Ca",
+    "Sc", "Ti", "V", "Cr", "Mn", "Fe", "Co", "Ni", "Cu", "Zn",
+    "Ga", "Ge", "As", "Se", "Br", "Kr", "Rb", "Sr", "Y", "Zr",
+    "Nb", "Mo", "Tc", "Ru", "Rh", "Pd", "Ag", "Cd", "In", "Sn",
+    "Sb", "Te", "I", "Xe", "Cs", "Ba", "La", "Ce", "Pr", "Nd",
+    "Pm", "Sm", "Eu", "Gd", "Tb", "Dy", "Ho", "Er", "Tm", "Yb",
+    "Lu", "Hf", "Ta", "W", "Re", "Os", "Ir", "Pt", "Au", "Hg",
+    "Tl", "Pb", "Bi", "Po", "At", "Rn", "Fr", "Ra", "Ac", "Th",
+    "Pa", "U", "Np", "Pu", "Am", "Cm", "Bk", "Cf", "Es", "Fm",
+    "Md", "No", "Lr", "Rf", "Db", "Sg", "Bh", "Hs", "Mt", "Ds",
+    "Rg", "Cn", "Nh", "Fl", "Mc", "Lv", "Ts", "Og"
+};
+
+#define NUCLIDE_MAX_Z ((int)(sizeof(element_symbols) / sizeof(element_symbols[0])) - 1)
+
+// Nomor atom dari simbol (tidak peka huruf besar/kecil), 0 jika tidak dikenal
+static int element_from_symbol(const char* symbol, size_t length) {
+    for (int z = 1; z <= NUCLIDE_MAX_Z; z++) {
+        const char* candidate = element_symbols[z];
+        if (strlen(candidate) != length) continue;
+        size_t i = 0;
+        while (i < length && tolower((unsigned char)symbol[i]) == tolower((unsigned char)candidate[i])) i++;
+        if (i == length) return z;
+    }
+    return 0;
+}
+
+int nuclide_zai_from_name(const char* name, uint32_t* zai) {
+    const char* p = name;
+    size_t letters = 0;
+    while (isalpha((unsigned char)p[letters]) && letters < 3) letters++;
+    if (letters == 0 || letters > 2) return 0;
+
+    int z = element_from_symbol(p, letters);
+    if (z == 0) return 0;
+    p += letters;
+    if (*p == '-') p++;
+
+    // Nomor massa
+    unsigned long a = 0;
+    int digits = 0;
+    while (isdigit((unsigned char)*p) && digits < 4) {
+        a = a * 10 + (unsigned long)(*p++ - '0');
+        digits++;
+    }
+    if (digits == 0 || a < (unsigned long)z || a > 999) return 0;
+
+    // State isomer: m = 1, m2..m9 = 2..9
+    unsigned long state = 0;
+    if (*p == 'm' || *p == 'M') {
+        p++;
+        state = 1;
+        if (*p >= '1' && *p <= '9') state = (unsigned long)(*p++ - '0');
+    }
+    if (*p != '\0') return 0;
+
+    *zai = (uint32_t)((unsigned long)z * 10000ul + a * 10ul + state);
+    return 1;
+}
+
+int nuclide_name_from_zai(uint32_t zai, char* out, size_t size) {
+    uint32_t z = zai / 10000u;
+    uint32_t a = (zai / 10u) % 1000u;
+    uint32_t state = zai % 10u;
+    if (z < 1 || z > (uint32_t)NUCLIDE_MAX_Z || a < z) {
+        snprintf(out, size, "%u", zai);
+        return 0;
+    }
+    if (state == 0) {
+        snprintf(out, size, "%s-%u", element_symbols[z], a);
+    } else if (state == 1) {
+        snprintf(out, size, "%s-%um", element_symbols[z], a);
+    } else {
+        snprintf(out, size, "%s-%um%u", element_symbols[z], a, state);
+    }
+    return 1;
+}
+
+int nuclide_parse_half_life(const char* text, int allow_stable, double* seconds) {
+    if (strcmp(text, "stable") == 0) {
+        if (!allow_stable) return 0;
+        *seconds = INFINITY;
+        return 1;
+    }
+
+    char* end;
+    double parsed = strtod(text, &end);
+    if (end == text) return 0;
+    while (isspace((unsigned char)*end)) end++;
+
+    double unit = 1.0;
+    if (*end != '\0') {
+        if (strcmp(end, "ns") == 0) unit = 1.0e-9;
+        else if (strcmp(end, "us") == 0) unit = 1.0e-6;
+        else if (strcmp(end, "ms") == 0) unit = 1.0e-3;
+        else if (strcmp(end, "s") == 0) unit = 1.0;
+        else if (strcmp(end, "m") == 0) unit = 60.0;
+        else if (strcmp(end, "h") == 0) unit = 3600.0;
+        else if (strcmp(end, "d") == 0) unit = 86400.0;
+        else if (strcmp(end, "y") == 0) unit = SECONDS_PER_YEAR;
+        else return 0;
+    }
+    double value = parsed * unit;
+    if (!isfinite(value) || value <= 0.0) return 0;
+    *seconds = value;
+    return 1;
+}
+
+/**
+ * INDEKS HASH
+ * ===========
+ *
+ * Pencampur bit 32-bit (finalizer gaya murmur) agar ZAI yang berdekatan
+ * tersebar ke seluruh tabel; probe linear dengan mask pangkat dua.
+ */
+static uint32_t zai_hash(uint32_t zai) {
+    uint32_t h = zai;
+    h ^= h >> 16;
+    h *= 0x7feb352du;
+    h ^= h >> 15;
+    h *= 0x846ca68bu;
+    h ^= h >> 16;
+    return h;
+}
+
+const NuclideRecord* nuclide_find_zai(const NuclideLibrary* library, uint32_t zai) {
+    if (library->index == NULL) return NULL;
+    uint32_t slots = library->header->index_slots;
+    uint32_t mask = slots - 1;
+    uint32_t slot = zai_hash(zai) & mask;
+    for (uint32_t probe = 0; probe < slots; probe++, slot = (slot + 1) & mask) {
+        uint32_t entry = library->index[slot];
+        if (entry == 0) return NULL;
+        const NuclideRecord* record = &library->records[entry - 1];
+        if (record->zai == zai) return record;
+    }
+    return NULL;
+}
+
+const NuclideRecord* nuclide_find(const NuclideLibrary* library, const char* name_or_zai) {
+    uint32_t zai;
+    if (isdigit((unsigned char)name_or_zai[0])) {
+        char* end;
+        unsigned long parsed = strtoul(name_or_zai, &end, 10);
+        if (*end != '\0' || parsed > UINT32_MAX) return NULL;
+        zai = (uint32_t)parsed;
+    } else if (!nuclide_zai_from_name(name_or_zai, &zai)) {
+        return NULL;
+    }
+    return nuclide_find_zai(library, zai);
+}
+
+/**
+ * MEMBANGUN IMAGE DARI FILE TEKS
+ * ==============================
+ */
+typedef struct {
+    uint32_t zai;
+    double half_life_s;
+    uint32_t first_branch;            // Indeks di array cabang sementara
+    uint32_t num_branches;
+    int line;
+} ParsedNuclide;
+
+typedef struct {
+    double ratio;
+    uint32_t daughter_zai;
+    char mode[NUCLIDE_MODE_BYTES];
+} ParsedBranch;
+
+static int compare_parsed_zai(const void* a, const void* b) {
+    uint32_t za = ((const ParsedNuclide*)a)->zai;
+    uint32_t zb = ((const ParsedNuclide*)b)->zai;
+    return (za > zb) - (za < zb);
+}
+
+static size_t index_slots_for(size_t num_nuclides) {
+    size_t slots = 16;
+    while (slots < 2 * num_nuclides) slots *= 2;
+    return slots;
+}
+
+// Mengikat pointer pustaka ke blok image yang sudah divalidasi
+static void bind_image(NuclideLibrary* library, void* block, size_t bytes, int mapped) {
+    const NuclideImageHeader* header = (const NuclideImageHeader*)block;
+    library->header = header;
+    library->records = (const NuclideRecord*)((const char*)block + header->records_offset);
+    library->branches = (const NuclideBranch*)((const char*)block + header->branches_offset);
+    library->index = (const uint32_t*)((const char*)block + header->index_offset);
+    library->num_nuclides = header->num_nuclides;
+    library->block = block;
+    library->block_bytes = bytes;
+    library->mapped = mapped;
+}
+
+/**
+ * Menyusun image (header, record urut ZAI, cabang, indeks) dalam satu blok.
+ * nuclides diurutkan in-place.
+ */
+static int build_image(NuclideLibrary* library, ParsedNuclide* nuclides, size_t num_nuclides,
+                       const ParsedBranch* parsed_branches, size_t num_branches,
+                       const char* filename) {
+    qsort(nuclides, num_nuclides, sizeof(ParsedNuclide), compare_parsed_zai);
+    for (size_t i = 1; i < num_nuclides; i++) {
+        if (nuclides[i].zai == nuclides[i - 1].zai) {
+            char name[NUCLIDE_NAME_BYTES];
+            nuclide_name_from_zai(nuclides[i].zai, name, sizeof(name));
+            int first = nuclides[i - 1].line, second = nuclides[i].line;
+            if (first > second) {
+                first = nuclides[i].line;
+                second = nuclides[i - 1].line;
+            }
+            printf("Error: %s baris %d: %s sudah didefinisikan di baris %d.\n", filename, second, name, first);
+            return 0;
+        }
+    }
+
+    size_t slots = index_slots_for(num_nuclides);
+    size_t records_offset = sizeof(NuclideImageHeader);
+    size_t branches_offset = records_offset + num_nuclides * sizeof(NuclideRecord);
+    size_t index_offset = branches_offset + num_branches * sizeof(NuclideBranch);
+    size_t total_bytes = index_offset + slots * sizeof(uint32_t);
+
+    char* block = (char*)calloc(1, total_bytes);
+    if (block == NULL) {
+        printf("Error: Gagal mengalokasikan pustaka nuklida (%zu byte).\n", total_bytes);
+        return 0;
+    }
+
+    NuclideImageHeader* header = (NuclideImageHeader*)block;
+    memcpy(header->magic, NUCLIDE_IMAGE_MAGIC, 8);
+    header->version = NUCLIDE_IMAGE_VERSION;
+    header->byte_order = NUCLIDE_BYTE_ORDER_MARK;
+    header->num_nuclides = (uint32_t)num_nuclides;
+    header->num_branches = (uint32_t)num_branches;
+    header->index_slots = (uint32_t)slots;
+    header->records_offset = records_offset;
+    header->branches_offset = branches_offset;
+    header->index_offset = index_offset;
+    header->file_bytes = total_bytes;
+
+    NuclideRecord* records = (NuclideRecord*)(block + records_offset);
+    NuclideBranch* branches = (NuclideBranch*)(block + branches_offset);
+    uint32_t* index = (uint32_t*)(block + index_offset);
+
+    // Record dan cabang dalam urutan ZAI
+    uint32_t next_branch = 0;
+    for (size_t i = 0; i < num_nuclides; i++) {
+        const ParsedNuclide* source = &nuclides[i];
+        NuclideRecord* record = &records[i];
+        nuclide_name_from_zai(source->zai, record->name, sizeof(record->name));
+        record->half_life_s = source->half_life_s;
+        record->lambda = isfinite(source->half_life_s) ? log(2.0) / source->half_life_s : 0.0;
+        record->zai = source->zai;
+        record->first_branch = next_branch;
+        record->num_branches = source->num_branches;
+        for (uint32_t b = 0; b < source->num_branches; b++) {
+            const ParsedBranch* parsed = &parsed_branches[source->first_branch + b];
+            NuclideBranch* branch = &branches[next_branch++];
+            branch->ratio = parsed->ratio;
+            branch->daughter_zai = parsed->daughter_zai;
+            branch->daughter_index = -1;
+            memcpy(branch->mode, parsed->mode, sizeof(branch->mode));
+        }
+
+        uint32_t mask = (uint32_t)slots - 1;
+        uint32_t slot = zai_hash(record->zai) & mask;
+        while (index[slot] != 0) slot = (slot + 1) & mask;
+        index[slot] = (uint32_t)i + 1;
+    }
+
+    bind_image(library, block, total_bytes, 0);
+
+    // Anak dihubungkan setelah indeks lengkap
+    for (size_t b = 0; b < num_branches; b++) {
+        const NuclideRecord* daughter = nuclide_find_zai(library, branches[b].daughter_zai);
+        if (daughter != NULL) branches[b].daughter_index = (int32_t)(daughter - records);
+    }
+    return 1;
+}
+
+// Mem-parse satu cabang "MODA:ANAK:RASIO"
+static int parse_branch(char* token, ParsedBranch* branch) {
+    char* first_colon = strchr(token, ':');
+    char* second_colon = first_colon ? strchr(first_colon + 1, ':') : NULL;
+    if (second_colon == NULL) return 0;
+    *first_colon = '\0';
+    *second_colon = '\0';
+
+    size_t mode_length = strlen(token);
+    if (mode_length == 0 || mode_length >= NUCLIDE_MODE_BYTES) return 0;
+    memset(branch->mode, 0, sizeof(branch->mode));
+    memcpy(branch->mode, token, mode_length);
+    if (!nuclide_zai_from_name(first_colon + 1, &branch->daughter_zai)) return 0;
+
+    char* end;
+    branch->ratio = strtod(second_colon + 1, &end);
+    return end != second_colon + 1 && *end == '\0' && branch->ratio > 0.0 && branch->ratio <= 1.0;
+}
+
+static int load_text(NuclideLibrary* library, char* text, const char* filename) {
+    ParsedNuclide* nuclides = NULL;
+    ParsedBranch* branches = NULL;
+    size_t num_nuclides = 0, nuclide_capacity = 0;
+    size_t num_branches = 0, branch_capacity = 0;
+    int ok = 1;
+    int line_number = 0;
+
+    char* next_line = text;
+    while (ok && next_line != NULL) {
+        char* line = next_line;
+        next_line = strchr(line, '\n');
+        if (next_line != NULL) *next_line++ = '\0';
+        line_number++;
+
+        char* comment = strchr(line, '#');
+        if (comment != NULL) *comment = '\0';
+
+        const char* separators = " \t\r";
+        char* name = strtok(line, separators);
+        if (name == NULL) continue;
+        char* half_life = strtok(NULL, separators);
+
+        if (num_nuclides == nuclide_capacity) {
+            size_t capacity = nuclide_capacity ? nuclide_capacity * 2 : 256;
+            ParsedNuclide* grown = (num_nuclides < NUCLIDE_MAX_NUCLIDES)
+                ? (ParsedNuclide*)realloc(nuclides, capacity * sizeof(ParsedNuclide)) : NULL;
+            if (grown == NULL) {
+                printf("Error: %s: terlalu banyak nuklida (maks. %d).\n", filename, NUCLIDE_MAX_NUCLIDES);
+                ok = 0;
+                break;
+            }
+            nuclides = grown;
+            nuclide_capacity = capacity;
+        }
+        ParsedNuclide* nuclide = &nuclides[num_nuclides];
+        nuclide->line = line_number;
+        nuclide->first_branch = (uint32_t)num_branches;
+        nuclide->num_branches = 0;
+
+        if (!nuclide_zai_from_name(name, &nuclide->zai)) {
+            printf("Error: %s baris %d: nama nuklida tidak valid '%s'.\n", filename, line_number, name);
+            ok = 0;
+            break;
+        }
+        if (half_life == NULL || !nuclide_parse_half_life(half_life, 1, &nuclide->half_life_s)) {
+            printf("Error: %s baris %d: waktu paruh tidak valid untuk %s.\n", filename, line_number, name);
+            ok = 0;
+            break;
+        }
+
+        double ratio_sum = 0.0;
+        for (char* token = strtok(NULL, separators); token != NULL; token = strtok(NULL, separators)) {
+            if (num_branches == branch_capacity) {
+                size_t capacity = branch_capacity ? branch_capacity * 2 : 256;
+                ParsedBranch* grown = (ParsedBranch*)realloc(branches, capacity * sizeof(ParsedBranch));
+                if (grown == NULL) {
+                    printf("Error: %s: gagal mengalokasikan tabel cabang.\n", filename);
+                    ok = 0;
+                    break;
+                }
+                branches = grown;
+                branch_capacity = capacity;
+            }
+            if (nuclide->num_branches == NUCLIDE_MAX_BRANCHES || !parse_branch(token, &branches[num_branches])) {
+                printf("Error: %s baris %d: cabang peluruhan tidak valid untuk %s "
+                       "(format MODA:ANAK:RASIO, maks. %d cabang).\n",
+                       filename, line_number, name, NUCLIDE_MAX_BRANCHES);
+                ok = 0;
+                break;
+            }
+            ratio_sum += branches[num_branches].ratio;
+            num_branches++;
+            nuclide->num_branches++;
+        }
+        if (!ok) break;
+
+        if (isinf(nuclide->half_life_s) && nuclide->num_branches > 0) {
+            printf("Error: %s baris %d: nuklida stabil %s tidak boleh punya cabang peluruhan.\n",
+                   filename, line_number, name);
+            ok = 0;
+        } else if (ratio_sum > 1.0 + NUCLIDE_BRANCH_SUM_TOLERANCE) {
+            printf("Error: %s baris %d: jumlah rasio cabang %s = %.6g melebihi 1.\n",
+                   filename, line_number, name, ratio_sum);
+            ok = 0;
+        }
+        num_nuclides++;
+    }
+
+    if (ok && num_nuclides == 0) {
+        printf("Error: %s tidak berisi nuklida.\n", filename);
+        ok = 0;
+    }
+    if (ok) ok = build_image(library, nuclides, num_nuclides, branches, num_branches, filename);
+
+    free(nuclides);
+    free(branches);
+    return ok;
+}
+
+/**
+ * MEMUAT IMAGE BINER
+ * ==================
+ *
+ * Seluruh offset, nilai record, cabang, dan invarian indeks hash diperiksa
+ * sebelum dipakai sehingga file yang terpotong atau rusak ditolak alih-alih
+ * dibaca di luar batas atau membuat pencarian berputar tanpa henti.
+ */
+static int validate_image(const void* block, size_t bytes, const char* filename) {
+    const NuclideImageHeader* header = (const NuclideImageHeader*)block;
+    if (bytes < sizeof(NuclideImageHeader) || memcmp(header->magic, NUCLIDE_IMAGE_MAGIC, 8) != 0) {
+        printf("Error: %s bukan image pustaka nuklida.\n", filename);
+        return 0;
+    }
+    if (header->byte_order != NUCLIDE_BYTE_ORDER_MARK) {
+        printf("Error: %s ditulis dengan urutan byte berbeda; kompilasi ulang dari file teks.\n", filename);
+        return 0;
+    }
+    if (header->version != NUCLIDE_IMAGE_VERSION) {
+        printf("Error: %s: versi image %u tidak didukung (diharapkan %u).\n",
+               filename, header->version, NUCLIDE_IMAGE_VERSION);
+        return 0;
+    }
+
+    uint64_t n = header->num_nuclides;
+    uint64_t m = header->num_branches;
+    uint64_t slots = header->index_slots;
+    int layout_ok = header->file_bytes == (uint64_t)bytes &&
+                    n >= 1 && n <= NUCLIDE_MAX_NUCLIDES &&
+                    m <= n * NUCLIDE_MAX_BRANCHES &&
+                    slots >= 2 * n && (slots & (slots - 1)) == 0 &&
+                    header->records_offset >= sizeof(NuclideImageHeader) &&
+                    header->records_offset % 8 == 0 && header->branches_offset % 8 == 0 &&
+                    header->index_offset % 4 == 0 &&
+                    // Offset dibandingkan dulu lalu ukuran lewat selisih (tanpa overflow)
+                    header->records_offset <= header->branches_offset &&
+                    header->branches_offset <= header->index_offset &&
+                    header->index_offset <= header->file_bytes &&
+                    n <= (header->branches_offset - header->records_offset) / sizeof(NuclideRecord) &&
+                    m <= (header->index_offset - header->branches_offset) / sizeof(NuclideBranch) &&
+                    slots <= (header->file_bytes - header->index_offset) / sizeof(uint32_t);
+    if (!layout_ok) {
+        printf("Error: %s: header image tidak konsisten (file terpotong atau rusak).\n", filename);
+        return 0;
+    }
+
+    const NuclideRecord* records = (const NuclideRecord*)((const char*)block + header->records_offset);
+    const NuclideBranch* branches = (const NuclideBranch*)((const char*)block + header->branches_offset);
+    const uint32_t* index = (const uint32_t*)((const char*)block + header->index_offset);
+    // Record: nama berterminator, ZAI urut naik tegas (unik), waktu paruh
+    // positif atau tak hingga (stabil, tanpa cabang) dengan λ yang sesuai
+    for (uint64_t i = 0; i < n; i++) {
+        const NuclideRecord* record = &records[i];
+        int stable = isinf(record->half_life_s) && record->half_life_s > 0.0;
+        int physical = stable ? (record->lambda == 0.0 && record->num_branches == 0)
+                              : (isfinite(record->half_life_s) && record->half_life_s > 0.0 &&
+                                 isfinite(record->lambda) && record->lambda > 0.0);
+        if (memchr(record->name, '\0', sizeof(record->name)) == NULL || !physical ||
+            (i > 0 && record->zai <= records[i - 1].zai) ||
+            (uint64_t)record->first_branch + record->num_branches > m) {
+            printf("Error: %s: record nuklida %llu rusak.\n", filename, (unsigned long long)i);
+            return 0;
+        }
+    }
+
+    // Indeks: setiap record dirujuk tepat satu slot (bitmap record yang
+    // sudah terlihat), dan setiap entri berada dalam run probe yang dimulai
+    // dari slot hash ZAI record-nya (invarian probe linear), sehingga setiap
+    // pencarian berhenti di slot kosong atau di record-nya. Pemindaian
+    // dimulai tepat setelah sebuah slot kosong (ada karena slots >= 2n),
+    // sehingga awal run selalu diketahui: O(slots).
+    unsigned char* seen = (unsigned char*)calloc((size_t)(n + 7) / 8, 1);
+    if (seen == NULL) {
+        printf("Error: Gagal mengalokasikan memori untuk validasi %s.\n", filename);
+        return 0;
+    }
+    uint64_t mask = slots - 1;
+    uint64_t empty = 0;
+    while (empty < slots && index[empty] != 0) empty++;
+    int index_ok = empty < slots;
+    uint64_t occupied = 0, run_start = 0;
+    for (uint64_t k = 1; k <= slots && index_ok; k++) {
+        uint64_t s = (empty + k) & mask;
+        uint32_t entry = index[s];
+        if (entry == 0) continue;
+        uint64_t record = (uint64_t)entry - 1;
+        if (entry > n || (seen[record / 8] & (1u << (record % 8))) != 0) {
+            index_ok = 0;
+            break;
+        }
+        seen[record / 8] |= (unsigned char)(1u << (record % 8));
+        if (index[(s - 1) & mask] == 0) run_start = s;
+        uint64_t home = zai_hash(records[record].zai) & mask;
+        index_ok = ((s - home) & mask) <= ((s - run_start) & mask);
+        occupied++;
+    }
+    free(seen);
+    if (!index_ok || occupied != n) {
+        printf("Error: %s: indeks hash rusak.\n", filename);
+        return 0;
+    }
+
+    for (uint64_t b = 0; b < m; b++) {
+        double ratio = branches[b].ratio;
+        if (branches[b].daughter_index < -1 || (int64_t)branches[b].daughter_index >= (int64_t)n ||
+            !(ratio > 0.0 && ratio <= 1.0) ||
+            memchr(branches[b].mode, '\0', sizeof(branches[b].mode)) == NULL) {
+            printf("Error: %s: cabang peluruhan %llu rusak.\n", filename, (unsigned long long)b);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+#ifndef _WIN32
+// Memetakan image read-only; 0 jika file tidak dapat dipetakan
+static int map_image(NuclideLibrary* library, const char* filename) {
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) return 0;
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        close(fd);
+        return 0;
+    }
+    size_t bytes = (size_t)info.st_size;
+    void* block = mmap(NULL, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (block == MAP_FAILED) return 0;
+
+    if (!validate_image(block, bytes, filename)) {
+        munmap(block, bytes);
+        return -1;
+    }
+    bind_image(library, block, bytes, 1);
+    return 1;
+}
+#endif
+
+// Membaca seluruh file (+ terminator NUL) ke memori heap
+static char* read_file(const char* filename, size_t* bytes) {
+    FILE* fp = fopen(filename, "rb");
+    if (fp == NULL) return NULL;
+    size_t capacity = 1 << 16;
+    size_t length = 0;
+    char* data = (char*)malloc(capacity + 1);
+    while (data != NULL) {
+        length += fread(data + length, 1, capacity - length, fp);
+        if (length < capacity) break;
+        char* grown = (char*)realloc(data, capacity * 2 + 1);
+        if (grown == NULL) {
+            free(data);
+            data = NULL;
+            break;
+        }
+        data = grown;
+        capacity *= 2;
+    }
+    int failed = ferror(fp);
+    fclose(fp);
+    if (data == NULL || failed) {
+        free(data);
+        return NULL;
+    }
+    data[length] = '\0';
+    *bytes = length;
+    return data;
+}
+
+int nuclide_library_load(NuclideLibrary* library, const char* filename) {
+    memset(library, 0, sizeof(*library));
+
+    FILE* fp = fopen(filename, "rb");
+    if (fp == NULL) {
+        printf("Error: Gagal membuka pustaka nuklida %s.\n", filename);
+        return 0;
+    }
+    char magic[8] = { 0 };
+    size_t magic_bytes = fread(magic, 1, sizeof(magic), fp);
+    fclose(fp);
+    int is_image = magic_bytes == sizeof(magic) && memcmp(magic, NUCLIDE_IMAGE_MAGIC, 8) == 0;
+
+#ifndef _WIN32
+    if (is_image) {
+        int mapped = map_image(library, filename);
+        if (mapped != 0) return mapped > 0;
+        // mmap tidak tersedia (mis. pipe): jatuh ke pembacaan biasa
+    }
+#endif
+
+    size_t bytes = 0;
+    char* data = read_file(filename, &bytes);
+    if (data == NULL) {
+        printf("Error: Gagal membaca pustaka nuklida %s.\n", filename);
+        return 0;
+    }
+    if (is_image) {
+        if (!validate_image(data, bytes, filename)) {
+            free(data);
+            return 0;
+        }
+        bind_image(library, data, bytes, 0);
+        return 1;
+    }
+
+    int ok = load_text(library, data, filename);
+    free(data);
+    return ok;
+}
+
+void nuclide_library_free(NuclideLibrary* library) {
+#ifndef _WIN32
+    if (library->mapped) {
+        munmap(library->block, library->block_bytes);
+    } else {
+        free(library->block);
+    }
+#else
+    free(library->block);
+#endif
+    memset(library, 0, sizeof(*library));
+}
+
+int nuclide_library_write_image(const NuclideLibrary* library, const char* filename) {
+    FILE* fp = fopen(filename, "wb");
+    if (fp == NULL) {
+        printf("Error: Gagal membuat image pustaka nuklida %s.\n", filename);
+        return 0;
+    }
+    size_t written = fwrite(library->block, 1, library->block_bytes, fp);
+    int closed = fclose(fp) == 0;
+    if (written != library->block_bytes || !closed) {
+        printf("Error: Gagal menulis image pustaka nuklida %s.\n", filename);
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ * RANTAI DARI PUSTAKA
+ * ===================
+ */
+int nuclide_library_chain(const NuclideLibrary* library, const NuclideRecord* parent,
+                          double N0, DecayChain* chain) {
+    chain->num_species = 0;
+    const NuclideRecord* current = parent;
+    while (current != NULL && current->lambda > 0.0 && chain->num_species < CHAIN_MAX_SPECIES) {
+        ChainSpecies* species = &chain->species[chain->num_species++];
+        snprintf(species->name, sizeof(species->name), "%s", current->name);
+        species->half_life_s = current->half_life_s;
+        species->lambda = current->lambda;
+        species->branching = 1.0;
+        species->N0 = (current == parent) ? N0 : 0.0;
+
+        // Cabang dominan; rantai berhenti jika anaknya stabil atau tidak ada di pustaka
+        const NuclideBranch* next = NULL;
+        for (uint32_t b = 0; b < current->num_branches; b++) {
+            const NuclideBranch* branch = &library->branches[current->first_branch + b];
+            if (next == NULL || branch->ratio > next->ratio) next = branch;
+        }
+        if (next == NULL || next->daughter_index < 0) break;
+        species->branching = next->ratio;
+        current = &library->records[next->daughter_index];
+    }
+    return chain->num_species;
+}
+
+/**
+ * JARINGAN DARI PUSTAKA
+ * =====================
+ */
+int nuclide_library_network(const NuclideLibrary* library, DecayNetwork* network) {
+    network_init(network);
+    uint32_t n = library->num_nuclides;
+    int ok = 1;
+    for (uint32_t i = 0; i < n && ok; i++) {
+        ok = network_add_nuclide(network, library->records[i].name, library->records[i].half_life_s) == (int)i;
+    }
+
+    // Anak yang tidak ada di tabel menjadi ujung jaringan (stabil), satu
+    // nuklida per ZAI, agar jumlah atom tetap terjaga
+    for (uint32_t i = 0; i < n && ok; i++) {
+        const NuclideRecord* record = &library->records[i];
+        for (uint32_t b = 0; b < record->num_branches && ok; b++) {
+            const NuclideBranch* branch = &library->branches[record->first_branch + b];
+            int daughter = branch->daughter_index;
+            if (daughter < 0) {
+                char name[NUCLIDE_NAME_BYTES];
+                nuclide_name_from_zai(branch->daughter_zai, name, sizeof(name));
+                daughter = -1;
+                for (int k = (int)n; k < network->num_nuclides && daughter < 0; k++) {
+                    if (strcmp(network->names[k], name) == 0) daughter = k;
+                }
+                if (daughter < 0) daughter = network_add_nuclide(network, name, INFINITY);
+                ok = daughter >= 0;
+            }
+            ok = ok && network_add_transition(network, (int)i, daughter, branch->ratio);
+        }
+    }
+
+    ok = ok && network_finalize(network);
+    if (!ok) network_free(network);
+    return ok;
+}
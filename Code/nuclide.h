@@ -0,0 +1,194 @@
+/**
+ * ========================================================================
+ * MODUL PUSTAKA DATA NUKLIDA
+ * ========================================================================
+ *
+ * Waktu paruh, moda peluruhan, rasio percabangan, dan anak setiap nuklida
+ * dibaca dari file data lokal alih-alih ditulis di kode. Dua format diterima
+ * oleh nuclide_library_load (dibedakan dari 8 byte pertama):
+ *
+ * 1. Teks, satu nuklida per baris (lihat nuclides.txt):
+ *
+ *      # NAMA    WAKTU_PARUH   [MODA:ANAK:RASIO ...]
+ *      Rn-222    3.8235d       alpha:Po-218:1
+ *      Po-218    3.098m        alpha:Pb-214:0.9998 beta-:At-218:0.0002
+ *      Pb-206    stable
+ *
+ *    Waktu paruh dalam detik, dengan akhiran satuan (ns, us, ms, s, m, h, d,
+ *    y = tahun Julian), atau "stable". Nama berbentuk Simbol-A dengan akhiran
+ *    m/m2/... untuk state metastabil; ZAI = Z * 10000 + A * 10 + I diturunkan
+ *    dari nama sehingga anak yang tidak ada di tabel tetap punya identitas.
+ *
+ * 2. Image biner terindeks (nuclide_library_write_image, --compile-nuclides)
+ *    yang dipetakan langsung ke memori (mmap) tanpa parsing:
+ *
+ *      offset 0   : NuclideImageHeader (64 byte)
+ *      records    : NuclideRecord[num_nuclides], urut menurut ZAI
+ *      branches   : NuclideBranch[num_branches]
+ *      index      : uint32[index_slots], tabel hash open addressing atas ZAI
+ *                   (nilai = indeks record + 1, 0 = slot kosong)
+ *
+ *    Image memakai urutan byte native dan ditolak jika penanda urutan byte
+ *    tidak cocok. Memuat image hanya memvalidasi header, nilai record dan
+ *    cabang, serta invarian indeks hash (O(n), satu bitmap n bit), sehingga tabel
+ *    ~3000 nuklida siap dalam orde milidetik.
+ *
+ * Pencarian menurut ZAI adalah satu probe hash (faktor beban <= 0.5,
+ * probe dibatasi jumlah slot);
+ * pencarian menurut nama mem-parse nama menjadi ZAI lalu memakai indeks yang
+ * sama, sehingga keduanya O(1) terhadap ukuran tabel.
+ */
+
+#ifndef NUCLIDE_H
+#define NUCLIDE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "chain.h"
+#include "network.h"
+
+#define NUCLIDE_NAME_BYTES 16
+#define NUCLIDE_MODE_BYTES 16
+
+// Batas ukuran tabel (melindungi dari file rusak)
+#define NUCLIDE_MAX_NUCLIDES 1000000
+#define NUCLIDE_MAX_BRANCHES 8
+
+/**
+ * RECORD IMAGE
+ * ============
+ */
+typedef struct {
+    char magic[8];                    // "DKNUCLIB"
+    uint32_t version;                 // NUCLIDE_IMAGE_VERSION
+    uint32_t byte_order;              // NUCLIDE_BYTE_ORDER_MARK dalam urutan byte penulis
+    uint32_t num_nuclides;
+    uint32_t num_branches;
+    uint32_t index_slots;             // Pangkat dua
+    uint32_t reserved;
+    uint64_t records_offset;
+    uint64_t branches_offset;
+    uint64_t index_offset;
+    uint64_t file_bytes;
+} NuclideImageHeader;
+
+typedef struct {
+    char name[NUCLIDE_NAME_BYTES];    // Nama kanonik, mis. "Pa-234m"
+    double half_life_s;               // INFINITY untuk nuklida stabil
+    double lambda;                    // ln(2) / waktu paruh (0 untuk stabil)
+    uint32_t zai;
+    uint32_t first_branch;            // Indeks cabang pertama di tabel cabang
+    uint32_t num_branches;
+    uint32_t reserved;
+} NuclideRecord;
+
+typedef struct {
+    double ratio;                     // Fraksi peluruhan melalui cabang ini
+    uint32_t daughter_zai;
+    int32_t daughter_index;           // Indeks record anak, -1 jika tidak ada di tabel
+    char mode[NUCLIDE_MODE_BYTES];    // Mis. "alpha", "beta-", "it"
+} NuclideBranch;
+
+/**
+ * PUSTAKA TERMUAT
+ *
+ * Semua pointer menunjuk ke satu blok (hasil mmap atau alokasi).
+ */
+typedef struct {
+    const NuclideImageHeader* header;
+    const NuclideRecord* records;
+    const NuclideBranch* branches;
+    const uint32_t* index;
+    uint32_t num_nuclides;
+    void* block;
+    size_t block_bytes;
+    int mapped;                       // 1 = block hasil mmap, 0 = alokasi heap
+} NuclideLibrary;
+
+/**
+ * Memuat pustaka dari file teks atau image biner. Pesan error (dengan nomor
+ * baris untuk file teks) dicetak ke stdout.
+ *
+ * @return int - 1 jika berhasil, 0 jika file tidak dapat dibaca atau tidak valid
+ */
+int nuclide_library_load(NuclideLibrary* library, const char* filename);
+
+void nuclide_library_free(NuclideLibrary* library);
+
+/**
+ * Menulis pustaka sebagai image biner yang dapat dimuat dengan mmap.
+ *
+ * @return int - 1 jika berhasil, 0 jika penulisan gagal
+ */
+int nuclide_library_write_image(const NuclideLibrary* library, const char* filename);
+
+/**
+ * PENCARIAN
+ * =========
+ *
+ * @return const NuclideRecord* - Record nuklida, atau NULL jika tidak ada
+ */
+const NuclideRecord* nuclide_find_zai(const NuclideLibrary* library, uint32_t zai);
+
+/**
+ * Mencari menurut nama (tidak peka huruf besar/kecil, tanda hubung opsional:
+ * "Rn-222", "rn222", "Pa-234m") atau ZAI desimal ("862220").
+ */
+const NuclideRecord* nuclide_find(const NuclideLibrary* library, const char* name_or_zai);
+
+/**
+ * KONVERSI NAMA DAN WAKTU PARUH
+ * =============================
+ */
+
+/**
+ * Nama nuklida -> ZAI.
+ *
+ * @return int - 1 jika nama valid, 0 jika tidak
+ */
+int nuclide_zai_from_name(const char* name, uint32_t* zai);
+
+/**
+ * ZAI -> nama kanonik (Simbol-A[m[I]]).
+ *
+ * @return int - 1 jika berhasil, 0 jika ZAI tidak valid (out berisi angka ZAI)
+ */
+int nuclide_name_from_zai(uint32_t zai, char* out, size_t size);
+
+/**
+ * Waktu paruh dengan akhiran satuan opsional (ns, us, ms, s, m, h, d, y);
+ * "stable" menghasilkan INFINITY hanya jika allow_stable.
+ *
+ * @return int - 1 jika valid (> 0), 0 jika tidak
+ */
+int nuclide_parse_half_life(const char* text, int allow_stable, double* seconds);
+
+/**
+ * RANTAI DARI PUSTAKA
+ * ===================
+ *
+ * Rantai linear dari parent dengan N0 atom pada t = 0, mengikuti cabang
+ * dengan rasio terbesar hingga anaknya stabil atau tidak ada di pustaka,
+ * atau CHAIN_MAX_SPECIES spesies tercapai.
+ * Rasio cabang yang diikuti menjadi b_i (cabang lain tidak dilacak; lihat
+ * nuclide_library_network untuk seluruh cabang).
+ *
+ * @return int - Jumlah spesies, atau 0 jika parent stabil
+ */
+int nuclide_library_chain(const NuclideLibrary* library, const NuclideRecord* parent,
+                          double N0, DecayChain* chain);
+
+/**
+ * JARINGAN DARI PUSTAKA
+ * =====================
+ *
+ * Jaringan peluruhan (sudah difinalisasi) berisi setiap nuklida pustaka dan
+ * setiap cabangnya. Nuklida ke-i jaringan adalah records[i]; anak yang tidak
+ * ada di tabel ditambahkan sesudahnya sebagai nuklida stabil.
+ *
+ * @return int - 1 jika berhasil, 0 jika jaringan tidak valid atau alokasi gagal
+ */
+int nuclide_library_network(const NuclideLibrary* library, DecayNetwork* network);
+
+#endif // NUCLIDE_H
@@ -0,0 +1,702 @@
+/**
+ * ========================================================================
+ * IMPLEMENTASI MODUL EKSPOR HASIL SIMULASI
+ * ========================================================================
+ */
+
+#include "output.h"
+#include "stats.h"
+
+#include <errno.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#endif
+
+// Pangkat 10 yang dapat direpresentasikan eksak sebagai double (10^0..10^22)
+static const double exact_pow10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static const uint64_t integer_pow10[] = {
+    1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull,
+    100000000ull, 1000000000ull, 10000000000ull, 100000000000ull, 1000000000000ull,
+    10000000000000ull, 100000000000000ull, 1000000000000000ull, 10000000000000000ull
+};
+
+#define TWO_POW_52 4503599627370496.0
+
+/**
+ * PEMBULATAN EKSAK x * 10^k KE INTEGER
+ * ====================================
+ *
+ * Menghitung round-half-even dari nilai real eksak x * 10^k (x > 0) tanpa
+ * aritmetika presisi ganda. Untuk k >= 0: p = fl(x * 10^k) dan galat produk
+ * e = fma(x, 10^k, -p) eksak. Untuk k < 0: q = fl(x / 10^-k) dan sisa
+ * pembagian r = fma(-q, 10^-k, x) eksak. Keputusan pembulatan hanya
+ * bergantung pada tanda (frac - 1/2) + galat, dan tanda hasil operasi
+ * floating-point dengan satu pembulatan selalu sama dengan tanda nilai eksak.
+ *
+ * @return int - 1 jika berhasil, 0 jika di luar jalur cepat (|k| > 22 atau hasil >= 2^52)
+ */
+static int round_scaled(double x, int k, uint64_t* result) {
+    double scaled, sign_of_remainder;
+
+    if (k >= 0) {
+        if (k > 22) return 0;
+        double P = exact_pow10[k];
+        scaled = x * P;
+        if (!(scaled < TWO_POW_52)) return 0;
+        double product_error = fma(x, P, -scaled);
+        double floor_scaled = floor(scaled);
+        sign_of_remainder = ((scaled - floor_scaled) - 0.5) + product_error;
+        *result = (uint64_t)floor_scaled;
+    } else {
+        if (k < -22) return 0;
+        double D = exact_pow10[-k];
+        scaled = x / D;
+        if (!(scaled < TWO_POW_52)) return 0;
+        double division_remainder = fma(-scaled, D, x);
+        double floor_scaled = floor(scaled);
+        sign_of_remainder = fma((scaled - floor_scaled) - 0.5, D, division_remainder);
+        *result = (uint64_t)floor_scaled;
+    }
+
+    // Di atas setengah: naik; tepat setengah: ke genap
+    if (sign_of_remainder > 0.0 || (sign_of_remainder == 0.0 && (*result & 1u))) {
+        (*result)++;
+    }
+    return 1;
+}
+
+// Menulis `num_digits` digit desimal terakhir dari value (dengan nol di depan)
+static void write_digits(char* out, uint64_t value, int num_digits) {
+    for (int i = num_digits - 1; i >= 0; i--) {
+        out[i] = (char)('0' + value % 10u);
+        value /= 10u;
+    }
+}
+
+// Jumlah digit desimal value (minimal 1)
+static int count_digits(uint64_t value) {
+    int digits = 1;
+    while (value >= 10u) {
+        value /= 10u;
+        digits++;
+    }
+    return digits;
+}
+
+size_t format_fixed(char* out, double x, int precision) {
+    if (isnan(x) || isinf(x) || precision < 0 || precision > 9) {
+        return (size_t)snprintf(out, FORMAT_MAX_BYTES, "%.*f", precision, x);
+    }
+
+    uint64_t mantissa = 0;
+    if (x != 0.0 && !round_scaled(fabs(x), precision, &mantissa)) {
+        return (size_t)snprintf(out, FORMAT_MAX_BYTES, "%.*f", precision, x);
+    }
+
+    char* p = out;
+    if (signbit(x)) *p++ = '-';
+
+    uint64_t integer_part = mantissa / integer_pow10[precision];
+    uint64_t fraction_part = mantissa % integer_pow10[precision];
+
+    int int_digits = count_digits(integer_part);
+    write_digits(p, integer_part, int_digits);
+    p += int_digits;
+
+    if (precision > 0) {
+        *p++ = '.';
+        write_digits(p, fraction_part, precision);
+        p += precision;
+    }
+    return (size_t)(p - out);
+}
+
+size_t format_exponent(char* out, double x, int precision) {
+    if (isnan(x) || isinf(x) || precision < 0 || precision > 15) {
+        return (size_t)snprintf(out, FORMAT_MAX_BYTES, "%.*e", precision, x);
+    }
+
+    char* p = out;
+    if (signbit(x)) *p++ = '-';
+
+    uint64_t mantissa = 0;
+    int exponent10 = 0;
+
+    if (x != 0.0) {
+        double ax = fabs(x);
+
+        // Estimasi eksponen desimal dari eksponen biner: hasil <= eksponen sebenarnya
+        int exponent2;
+        frexp(ax, &exponent2);
+        exponent10 = (int)floor((exponent2 - 1) * 0.30102999566398119521);
+
+        if (!round_scaled(ax, precision - exponent10, &mantissa)) {
+            return (size_t)snprintf(out, FORMAT_MAX_BYTES, "%.*e", precision, x);
+        }
+        // Mantissa harus tepat precision + 1 digit; naikkan eksponen jika lebih
+        // (estimasi kurang satu, atau pembulatan membawa carry ke digit baru)
+        while (mantissa >= integer_pow10[precision + 1]) {
+            exponent10++;
+            if (!round_scaled(ax, precision - exponent10, &mantissa)) {
+                return (size_t)snprintf(out, FORMAT_MAX_BYTES, "%.*e", precision, x);
+            }
+        }
+    }
+
+    // d.ddddddd
+    uint64_t leading = mantissa / integer_pow10[precision];
+    *p++ = (char)('0' + leading);
+    if (precision > 0) {
+        *p++ = '.';
+        write_digits(p, mantissa % integer_pow10[precision], precision);
+        p += precision;
+    }
+
+    // e±XX (minimal dua digit eksponen)
+    *p++ = 'e';
+    *p++ = (exponent10 < 0) ? '-' : '+';
+    int abs_exponent = (exponent10 < 0) ? -exponent10 : exponent10;
+    int exp_digits = (abs_exponent >= 100) ? 3 : 2;
+    write_digits(p, (uint64_t)abs_exponent, exp_digits);
+    p += exp_digits;
+
+    return (size_t)(p - out);
+}
+
+/**
+ * PENULIS CSV BERBUFFER
+ * =====================
+ */
+
+// Menulis seluruh isi buffer ke file dengan satu pemanggilan fwrite
+static int csv_writer_flush(CsvWriter* writer) {
+    if (writer->used == 0) return !writer->failed;
+    if (fwrite(writer->buffer, 1, writer->used, writer->fp) != writer->used) {
+        writer->failed = 1;
+    } else {
+        writer->bytes_written += writer->used;
+        stats_count(STATS_COUNTER_BYTES_WRITTEN, (long long)writer->used);
+    }
+    writer->used = 0;
+    return !writer->failed;
+}
+
+int csv_writer_open(CsvWriter* writer, const char* filename) {
+    writer->used = 0;
+    writer->bytes_written = 0;
+    writer->failed = 0;
+    writer->buffer = NULL;
+
+    writer->fp = fopen(filename, "wb");
+    if (writer->fp == NULL) return 0;
+
+    // Buffer stdio dimatikan: setiap blok langsung menjadi satu syscall write
+    setvbuf(writer->fp, NULL, _IONBF, 0);
+
+    writer->buffer = (char*)malloc(CSV_BLOCK_BYTES);
+    if (writer->buffer == NULL) {
+        fclose(writer->fp);
+        writer->fp = NULL;
+        return 0;
+    }
+    return 1;
+}
+
+int csv_writer_write_header(CsvWriter* writer) {
+    static const char header[] =
+        "Time_s,N_Numerical,N_Analytical,Error_Absolute,Error_Relative_Percent\n";
+    memcpy(writer->buffer + writer->used, header, sizeof(header) - 1);
+    writer->used += sizeof(header) - 1;
+    return !writer->failed;
+}
+
+int csv_writer_write_rows(CsvWriter* writer, const SimulationResults* results) {
+    size_t stride = results->stride;
+
+    for (int j = 0; j < results->num_rows; j++) {
+        if (writer->used + CSV_MAX_ROW_BYTES > CSV_BLOCK_BYTES && !csv_writer_flush(writer)) {
+            return 0;
+        }
+
+        // Format baris: %.4f,%.6e,%.6e,%.6e,%.6f
+        size_t k = (size_t)j * stride;
+        char* p = writer->buffer + writer->used;
+        p += format_fixed(p, results->time_s[k], 4);
+        *p++ = ',';
+        p += format_exponent(p, results->N_numerical[k], 6);
+        *p++ = ',';
+        p += format_exponent(p, results->N_analytical[k], 6);
+        *p++ = ',';
+        p += format_exponent(p, results->error_absolute[k], 6);
+        *p++ = ',';
+        p += format_fixed(p, results->error_relative_percent[k], 6);
+        *p++ = '\n';
+        writer->used = (size_t)(p - writer->buffer);
+    }
+    return !writer->failed;
+}
+
+int csv_writer_close(CsvWriter* writer) {
+    int ok = csv_writer_flush(writer);
+    if (writer->fp != NULL && fclose(writer->fp) != 0) ok = 0;
+    free(writer->buffer);
+    writer->fp = NULL;
+    writer->buffer = NULL;
+    return ok;
+}
+
+int csv_sink_consume(void* context, const SimulationResults* chunk, int first_row) {
+    (void)first_row;
+    return csv_writer_write_rows((CsvWriter*)context, chunk);
+}
+
+/**
+ * CSV RANTAI PELURUHAN
+ * ====================
+ */
+int csv_writer_write_chain_header(CsvWriter* writer, const DecayChain* chain) {
+    static const char* const suffixes[4] = {
+        "N_Numerical", "N_Analytical", "Error_Absolute", "Error_Relative_Percent"
+    };
+    char* p = writer->buffer + writer->used;
+    p += sprintf(p, "Time_s");
+    for (int s = 0; s < chain->num_species; s++) {
+        for (int c = 0; c < 4; c++) p += sprintf(p, ",%s_%s", chain->species[s].name, suffixes[c]);
+    }
+    *p++ = '\n';
+    writer->used = (size_t)(p - writer->buffer);
+    return !writer->failed;
+}
+
+int csv_writer_write_chain_rows(CsvWriter* writer, const ChainResults* results) {
+    // Satu baris: waktu + 4 field per spesies
+    size_t max_row_bytes = (1 + 4 * (size_t)results->num_species) * (FORMAT_MAX_BYTES + 1) + 1;
+
+    for (int j = 0; j < results->num_rows; j++) {
+        if (writer->used + max_row_bytes > CSV_BLOCK_BYTES && !csv_writer_flush(writer)) {
+            return 0;
+        }
+
+        char* p = writer->buffer + writer->used;
+        p += format_fixed(p, results->time_s[j], 4);
+        for (int s = 0; s < results->num_species; s++) {
+            *p++ = ',';
+            p += format_exponent(p, results->N_numerical[s][j], 6);
+            *p++ = ',';
+            p += format_exponent(p, results->N_analytical[s][j], 6);
+            *p++ = ',';
+            p += format_exponent(p, results->error_absolute[s][j], 6);
+            *p++ = ',';
+            p += format_fixed(p, results->error_relative_percent[s][j], 6);
+        }
+        *p++ = '\n';
+        writer->used = (size_t)(p - writer->buffer);
+    }
+    return !writer->failed;
+}
+
+int chain_csv_sink_consume(void* context, const ChainResults* chunk, int first_row) {
+    (void)first_row;
+    return csv_writer_write_chain_rows((CsvWriter*)context, chunk);
+}
+
+/**
+ * CSV JARINGAN PELURUHAN
+ * ======================
+ */
+int csv_writer_write_network_header(CsvWriter* writer, const DecayNetwork* network,
+                                    const int* species, int num_species) {
+    size_t max_header_bytes = 8 + (size_t)num_species * (NETWORK_NAME_BYTES + 4);
+    if (max_header_bytes > CSV_BLOCK_BYTES) return 0;
+    if (writer->used + max_header_bytes > CSV_BLOCK_BYTES && !csv_writer_flush(writer)) return 0;
+
+    char* p = writer->buffer + writer->used;
+    p += sprintf(p, "Time_s");
+    for (int s = 0; s < num_species; s++) p += sprintf(p, ",%s_N", network->names[species[s]]);
+    *p++ = '\n';
+    writer->used = (size_t)(p - writer->buffer);
+    return !writer->failed;
+}
+
+int csv_writer_write_network_row(CsvWriter* writer, double time_s, const double* N,
+                                 const int* species, int num_species) {
+    size_t max_row_bytes = (1 + (size_t)num_species) * (FORMAT_MAX_BYTES + 1) + 1;
+    if (max_row_bytes > CSV_BLOCK_BYTES) return 0;
+    if (writer->used + max_row_bytes > CSV_BLOCK_BYTES && !csv_writer_flush(writer)) return 0;
+
+    char* p = writer->buffer + writer->used;
+    p += format_fixed(p, time_s, 4);
+    for (int s = 0; s < num_species; s++) {
+        *p++ = ',';
+        p += format_exponent(p, N[species[s]], 6);
+    }
+    *p++ = '\n';
+    writer->used = (size_t)(p - writer->buffer);
+    return !writer->failed;
+}
+
+/**
+ * CSV ENSEMBLE STOKASTIK
+ * ======================
+ */
+int csv_writer_write_stochastic_header(CsvWriter* writer) {
+    static const char header[] =
+        "Time_s,N_Mean,N_Variance,N_Analytical,Variance_Analytical,N_Sample\n";
+    memcpy(writer->buffer + writer->used, header, sizeof(header) - 1);
+    writer->used += sizeof(header) - 1;
+    return !writer->failed;
+}
+
+int csv_writer_write_stochastic_rows(CsvWriter* writer, const StochasticResults* results) {
+    const double* columns[5] = {
+        results->N_mean, results->N_variance, results->N_analytical,
+        results->variance_analytical, results->N_sample
+    };
+    for (int j = 0; j < results->num_rows; j++) {
+        if (writer->used + 6 * (FORMAT_MAX_BYTES + 1) + 1 > CSV_BLOCK_BYTES && !csv_writer_flush(writer)) {
+            return 0;
+        }
+
+        char* p = writer->buffer + writer->used;
+        p += format_fixed(p, results->time_s[j], 4);
+        for (int c = 0; c < 5; c++) {
+            *p++ = ',';
+            p += format_exponent(p, columns[c][j], 6);
+        }
+        *p++ = '\n';
+        writer->used = (size_t)(p - writer->buffer);
+    }
+    return !writer->failed;
+}
+
+/**
+ * CSV ENSEMBLE PARAMETER
+ * ======================
+ */
+int csv_writer_write_ensemble_header(CsvWriter* writer, const EnsembleResults* results) {
+    char* p = writer->buffer + writer->used;
+    p += sprintf(p, "Time_s,N_Mean,N_StdDev");
+    for (int q = 0; q < results->num_quantiles; q++) p += sprintf(p, ",N_Q%g", results->quantile_p[q] * 100.0);
+    p += sprintf(p, ",N_Analytical_Mean,Error_Relative_Percent\n");
+    writer->used = (size_t)(p - writer->buffer);
+    return !writer->failed;
+}
+
+int csv_writer_write_ensemble_rows(CsvWriter* writer, const EnsembleResults* results) {
+    // Satu baris: waktu, mean, simpangan baku, kuantil, mean analitik, error
+    size_t max_row_bytes = (5 + (size_t)results->num_quantiles) * (FORMAT_MAX_BYTES + 1) + 1;
+
+    for (int j = 0; j < results->num_rows; j++) {
+        if (writer->used + max_row_bytes > CSV_BLOCK_BYTES && !csv_writer_flush(writer)) {
+            return 0;
+        }
+
+        char* p = writer->buffer + writer->used;
+        p += format_fixed(p, results->time_s[j], 4);
+        *p++ = ',';
+        p += format_exponent(p, results->N_mean[j], 6);
+        *p++ = ',';
+        p += format_exponent(p, results->N_stddev[j], 6);
+        for (int q = 0; q < results->num_quantiles; q++) {
+            *p++ = ',';
+            p += format_exponent(p, results->quantile[q][j], 6);
+        }
+        *p++ = ',';
+        p += format_exponent(p, results->N_analytical_mean[j], 6);
+        *p++ = ',';
+        p += format_fixed(p, results->error_relative_percent[j], 6);
+        *p++ = '\n';
+        writer->used = (size_t)(p - writer->buffer);
+    }
+    return !writer->failed;
+}
+
+/**
+ * PENULIS BINER KOLUMNAR
+ * ======================
+ */
+
+// Nama kolom, urutan sama dengan header CSV
+static const char* const result_column_names[SIMULATION_NUM_COLUMNS] = {
+    "Time_s", "N_Numerical", "N_Analytical", "Error_Absolute", "Error_Relative_Percent"
+};
+
+// Jumlah double di buffer kumpul kolom (32 KiB)
+#define BINARY_STAGING_DOUBLES 4096
+
+static int host_is_little_endian(void) {
+    const uint16_t probe = 1;
+    unsigned char first_byte;
+    memcpy(&first_byte, &probe, 1);
+    return first_byte == 1;
+}
+
+static void put_u32_le(unsigned char* out, uint32_t value) {
+    for (int i = 0; i < 4; i++) out[i] = (unsigned char)(value >> (8 * i));
+}
+
+static void put_u64_le(unsigned char* out, uint64_t value) {
+    for (int i = 0; i < 8; i++) out[i] = (unsigned char)(value >> (8 * i));
+}
+
+static void put_f64_le(unsigned char* out, double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    put_u64_le(out, bits);
+}
+
+static void put_name(unsigned char* out, const char* name) {
+    size_t length = (name != NULL) ? strlen(name) : 0;
+    if (length > BINARY_NAME_BYTES - 1) length = BINARY_NAME_BYTES - 1;
+    memcpy(out, name, length);
+}
+
+// Seek 64-bit (file lebih dari 2 GiB pada platform dengan long 32-bit)
+static int binary_seek(FILE* fp, uint64_t offset) {
+#ifdef _WIN32
+    return _fseeki64(fp, (__int64)offset, SEEK_SET) == 0;
+#else
+    return fseeko(fp, (off_t)offset, SEEK_SET) == 0;
+#endif
+}
+
+int binary_writer_open(BinaryWriter* writer, const char* filename,
+                       const OutputMetadata* metadata, int num_rows) {
+    writer->num_rows = num_rows;
+    writer->header_bytes = BINARY_HEADER_BYTES(SIMULATION_NUM_COLUMNS);
+    writer->failed = 0;
+    writer->staging = NULL;
+
+    writer->fp = fopen(filename, "wb");
+    if (writer->fp == NULL) return 0;
+
+    writer->staging = (double*)malloc(BINARY_STAGING_DOUBLES * sizeof(double));
+    unsigned char* header = (unsigned char*)calloc(1, writer->header_bytes);
+    if (writer->staging == NULL || header == NULL) {
+        free(header);
+        binary_writer_close(writer);
+        return 0;
+    }
+
+    // HEADER
+    // ======
+    memcpy(header, BINARY_MAGIC, 8);
+    put_u32_le(header + 8, BINARY_FORMAT_VERSION);
+    put_u32_le(header + 12, (uint32_t)writer->header_bytes);
+    put_u64_le(header + 16, (uint64_t)num_rows);
+    put_u32_le(header + 24, (uint32_t)SIMULATION_NUM_COLUMNS);
+    put_f64_le(header + 32, metadata->N0);
+    put_f64_le(header + 40, metadata->lambda);
+    put_f64_le(header + 48, metadata->t_initial);
+    put_f64_le(header + 56, metadata->delta_t);
+    put_name(header + 64, metadata->method);
+    for (size_t c = 0; c < SIMULATION_NUM_COLUMNS; c++) {
+        put_name(header + BINARY_FIXED_HEADER_BYTES + c * BINARY_NAME_BYTES, result_column_names[c]);
+    }
+
+    int ok = fwrite(header, 1, writer->header_bytes, writer->fp) == writer->header_bytes;
+    free(header);
+    if (ok) stats_count(STATS_COUNTER_BYTES_WRITTEN, (long long)writer->header_bytes);
+
+    // Alokasikan file penuh dengan menulis byte terakhir kolom terakhir
+    uint64_t total_bytes = writer->header_bytes +
+                           (uint64_t)SIMULATION_NUM_COLUMNS * (uint64_t)num_rows * sizeof(double);
+    if (ok && total_bytes > writer->header_bytes) {
+        ok = binary_seek(writer->fp, total_bytes - 1) && fputc(0, writer->fp) != EOF;
+    }
+    if (!ok) {
+        writer->failed = 1;
+        binary_writer_close(writer);
+        return 0;
+    }
+    return 1;
+}
+
+int binary_writer_write_rows(BinaryWriter* writer, const SimulationResults* results, int first_row) {
+    if (writer->failed) return 0;
+    if (first_row < 0 || results->num_rows > writer->num_rows - first_row) {
+        writer->failed = 1;
+        return 0;
+    }
+
+    const double* columns[SIMULATION_NUM_COLUMNS] = {
+        results->time_s, results->N_numerical, results->N_analytical,
+        results->error_absolute, results->error_relative_percent
+    };
+    size_t stride = results->stride;
+    int little_endian = host_is_little_endian();
+
+    for (size_t c = 0; c < SIMULATION_NUM_COLUMNS && !writer->failed; c++) {
+        uint64_t offset = writer->header_bytes +
+                          ((uint64_t)c * (uint64_t)writer->num_rows + (uint64_t)first_row) * sizeof(double);
+        if (!binary_seek(writer->fp, offset)) {
+            writer->failed = 1;
+            break;
+        }
+
+        // Kolom kontigu pada host little-endian ditulis langsung tanpa salinan
+        if (stride == 1 && little_endian) {
+            size_t count = (size_t)results->num_rows;
+            if (fwrite(columns[c], sizeof(double), count, writer->fp) != count) writer->failed = 1;
+            continue;
+        }
+
+        for (int begin = 0; begin < results->num_rows && !writer->failed; begin += BINARY_STAGING_DOUBLES) {
+            int count = results->num_rows - begin;
+            if (count > BINARY_STAGING_DOUBLES) count = BINARY_STAGING_DOUBLES;
+
+            for (int j = 0; j < count; j++) {
+                double value = columns[c][(size_t)(begin + j) * stride];
+                if (!little_endian) put_f64_le((unsigned char*)&writer->staging[j], value);
+                else writer->staging[j] = value;
+            }
+            if (fwrite(writer->staging, sizeof(double), (size_t)count, writer->fp) != (size_t)count) {
+                writer->failed = 1;
+            }
+        }
+    }
+    if (!writer->failed) {
+        stats_count(STATS_COUNTER_BYTES_WRITTEN,
+                    (long long)results->num_rows * (long long)(SIMULATION_NUM_COLUMNS * sizeof(double)));
+    }
+    return !writer->failed;
+}
+
+int binary_writer_close(BinaryWriter* writer) {
+    int ok = !writer->failed;
+    if (writer->fp != NULL && fclose(writer->fp) != 0) ok = 0;
+    free(writer->staging);
+    writer->fp = NULL;
+    writer->staging = NULL;
+    return ok;
+}
+
+int binary_sink_consume(void* context, const SimulationResults* chunk, int first_row) {
+    return binary_writer_write_rows((BinaryWriter*)context, chunk, first_row);
+}
+
+/**
+ * BUFFER TEKS KONSOL
+ * ==================
+ */
+void text_buffer_init(TextBuffer* buffer) {
+    buffer->data = NULL;
+    buffer->length = 0;
+    buffer->capacity = 0;
+    buffer->failed = 0;
+}
+
+void text_printf(TextBuffer* buffer, const char* format, ...) {
+    if (buffer->failed) return;
+
+    va_list args;
+    va_start(args, format);
+    size_t available = buffer->capacity - buffer->length;
+    int needed = vsnprintf(buffer->data ? buffer->data + buffer->length : NULL, available, format, args);
+    va_end(args);
+    if (needed < 0) return;
+
+    if ((size_t)needed >= available) {
+        // Tumbuh dua kali lipat (minimal 4 KiB) lalu format ulang
+        size_t capacity = buffer->capacity ? buffer->capacity : 4096;
+        while (capacity - buffer->length <= (size_t)needed) capacity *= 2;
+        char* data = (char*)realloc(buffer->data, capacity);
+        if (data == NULL) {
+            buffer->failed = 1;
+            return;
+        }
+        stats_count(STATS_COUNTER_REALLOCATIONS, 1);
+        buffer->data = data;
+        buffer->capacity = capacity;
+
+        va_start(args, format);
+        vsnprintf(buffer->data + buffer->length, capacity - buffer->length, format, args);
+        va_end(args);
+    }
+    buffer->length += (size_t)needed;
+}
+
+void text_buffer_flush(TextBuffer* buffer, FILE* stream) {
+    if (buffer->length > 0) fwrite(buffer->data, 1, buffer->length, stream);
+    if (buffer->failed) fprintf(stream, "Error: Keluaran konsol terpotong (alokasi buffer gagal).\n");
+    buffer->length = 0;
+    buffer->failed = 0;
+}
+
+void text_buffer_free(TextBuffer* buffer) {
+    free(buffer->data);
+    text_buffer_init(buffer);
+}
+
+/**
+ * DIREKTORI KELUARAN
+ * ==================
+ */
+static int make_one_directory(const char* path) {
+#ifdef _WIN32
+    if (_mkdir(path) == 0) return 1;
+#else
+    if (mkdir(path, 0777) == 0) return 1;
+#endif
+    struct stat info;
+    return errno == EEXIST && stat(path, &info) == 0 && (info.st_mode & S_IFMT) == S_IFDIR;
+}
+
+int output_make_directory(const char* path) {
+    char partial[OUTPUT_PATH_MAX];
+    size_t length = strlen(path);
+    if (length == 0) return 1;
+    if (length >= sizeof(partial)) return 0;
+    memcpy(partial, path, length + 1);
+
+    // Setiap komponen induk dibuat dulu; pemisah di awal (path absolut) dilewati
+    for (size_t i = 1; i < length; i++) {
+        if (partial[i] != '/' && partial[i] != '\\') continue;
+        if (partial[i - 1] == '/' || partial[i - 1] == '\\' || partial[i - 1] == ':') continue;
+        partial[i] = '\0';
+        int ok = make_one_directory(partial);
+        partial[i] = path[i];
+        if (!ok) return 0;
+    }
+    return make_one_directory(partial);
+}
+
+int output_path(char* out, size_t size, const char* directory, const char* name) {
+    int length;
+    if (directory == NULL || directory[0] == '\0') {
+        length = snprintf(out, size, "%s", name);
+    } else {
+        char last = directory[strlen(directory) - 1];
+        const char* separator = (last == '/' || last == '\\') ? "" : "/";
+        length = snprintf(out, size, "%s%s%s", directory, separator, name);
+    }
+    return length >= 0 && (size_t)length < size;
+}
+
+void output_delta_t_label(char* out, size_t size, const double* delta_t_values, int num_cases,
+                          int case_index) {
+    char legacy[64], other[64];
+    snprintf(legacy, sizeof(legacy), "%.0f", delta_t_values[case_index]);
+    int collides = 0;
+    for (int i = 0; i < num_cases && !collides; i++) {
+        if (i == case_index) continue;
+        snprintf(other, sizeof(other), "%.0f", delta_t_values[i]);
+        collides = strcmp(legacy, other) == 0;
+    }
+    if (collides) {
+        snprintf(out, size, "%.6g_c%d", delta_t_values[case_index], case_index);
+    } else {
+        snprintf(out, size, "%s", legacy);
+    }
+}
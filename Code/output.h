@@ -0,0 +1,317 @@
+/**
+ * ========================================================================
+ * MODUL EKSPOR HASIL SIMULASI
+ * ========================================================================
+ *
+ * Penulisan hasil simulasi ke file CSV dengan format output_*.csv:
+ *
+ *   Time_s,N_Numerical,N_Analytical,Error_Absolute,Error_Relative_Percent
+ *   %.4f,%.6e,%.6e,%.6e,%.6f
+ *
+ * CsvWriter memformat angka sendiri (tanpa fprintf) ke dalam blok buffer
+ * besar dan menulis satu blok per pemanggilan write ke file tanpa buffer stdio,
+ * sehingga hanya ada satu syscall per CSV_BLOCK_BYTES. Formatter tidak
+ * bergantung pada locale (selalu memakai titik desimal) dan menghasilkan byte
+ * yang identik dengan printf glibc: pembulatan dilakukan terhadap nilai biner
+ * eksak (round-half-even) memakai transformasi bebas-error berbasis fma.
+ *
+ * Selain CSV, hasil dapat disimpan dalam format biner kolumnar output_*.bin
+ * (lihat BinaryWriter) yang jauh lebih kecil dan dapat dipetakan langsung ke
+ * memori oleh pembaca (numpy.memmap di plot.py).
+ *
+ * Fungsi-fungsi di sini bekerja untuk kedua tata letak hasil (AoS / SoA) dan
+ * dapat dipakai langsung sebagai sink pada mode streaming.
+ */
+
+#ifndef OUTPUT_H
+#define OUTPUT_H
+
+#include <stdio.h>
+#include <stddef.h>
+
+#include "chain.h"
+#include "ensemble.h"
+#include "network.h"
+#include "simulation.h"
+#include "stochastic.h"
+
+// Ukuran blok output: satu syscall write per blok
+#define CSV_BLOCK_BYTES (1u << 20)
+
+// Panjang maksimum satu angka terformat (%.9f dari ±DBL_MAX = 320 karakter)
+#define FORMAT_MAX_BYTES 384
+
+// Panjang maksimum satu baris CSV (lima field + pemisah)
+#define CSV_MAX_ROW_BYTES (5 * FORMAT_MAX_BYTES + 8)
+
+/**
+ * PENULIS CSV BERBUFFER
+ */
+typedef struct {
+    FILE* fp;
+    char* buffer;
+    size_t used;                      // Byte terisi di buffer
+    size_t bytes_written;             // Total byte yang sudah ditulis ke file
+    int failed;                       // 1 jika ada penulisan yang gagal
+} CsvWriter;
+
+/**
+ * Membuka file CSV untuk ditulis (stdio tanpa buffer + blok buffer sendiri).
+ *
+ * @return int - 1 jika berhasil, 0 jika file atau buffer gagal dibuat
+ */
+int csv_writer_open(CsvWriter* writer, const char* filename);
+
+/**
+ * Menulis baris header CSV.
+ */
+int csv_writer_write_header(CsvWriter* writer);
+
+/**
+ * Menulis baris [0, results->num_rows) ke CSV.
+ *
+ * @return int - 1 jika berhasil, 0 jika penulisan gagal
+ */
+int csv_writer_write_rows(CsvWriter* writer, const SimulationResults* results);
+
+/**
+ * Menulis sisa buffer, menutup file, dan membebaskan buffer.
+ *
+ * @return int - 1 jika seluruh penulisan berhasil, 0 jika ada yang gagal
+ */
+int csv_writer_close(CsvWriter* writer);
+
+/**
+ * Fungsi sink streaming yang menulis setiap chunk ke CSV (context = CsvWriter*).
+ */
+int csv_sink_consume(void* context, const SimulationResults* chunk, int first_row);
+
+/**
+ * CSV RANTAI PELURUHAN
+ * ====================
+ *
+ * Kolom Time_s lalu empat kolom per spesies dengan prefiks nama nuklida
+ * (mis. Po-218_N_Numerical, Po-218_N_Analytical, Po-218_Error_Absolute,
+ * Po-218_Error_Relative_Percent), format angka sama dengan CSV tunggal.
+ */
+int csv_writer_write_chain_header(CsvWriter* writer, const DecayChain* chain);
+int csv_writer_write_chain_rows(CsvWriter* writer, const ChainResults* results);
+
+/**
+ * Fungsi sink streaming rantai (context = CsvWriter*).
+ */
+int chain_csv_sink_consume(void* context, const ChainResults* chunk, int first_row);
+
+/**
+ * CSV ENSEMBLE STOKASTIK
+ * ======================
+ *
+ *   Time_s,N_Mean,N_Variance,N_Analytical,Variance_Analytical,N_Sample
+ *   %.4f,%.6e,%.6e,%.6e,%.6e,%.6e
+ *
+ * N_Sample adalah trajektori ke-0 (satu realisasi).
+ */
+int csv_writer_write_stochastic_header(CsvWriter* writer);
+int csv_writer_write_stochastic_rows(CsvWriter* writer, const StochasticResults* results);
+
+/**
+ * CSV ENSEMBLE PARAMETER
+ * ======================
+ *
+ *   Time_s,N_Mean,N_StdDev,N_Q<p1>,...,N_Analytical_Mean,Error_Relative_Percent
+ *   %.4f,%.6e,%.6e,%.6e,...,%.6e,%.6f
+ *
+ * Nama kolom kuantil memakai peluang dalam persen (N_Q2.5, N_Q50, ...).
+ */
+int csv_writer_write_ensemble_header(CsvWriter* writer, const EnsembleResults* results);
+int csv_writer_write_ensemble_rows(CsvWriter* writer, const EnsembleResults* results);
+
+/**
+ * CSV JARINGAN PELURUHAN
+ * ======================
+ *
+ *   Time_s,<nuklida>_N,...
+ *   %.4f,%.6e,...
+ *
+ * Satu kolom per nuklida terpilih (species[], indeks nuklida jaringan),
+ * satu baris per pemanggilan (N diindeks menurut indeks nuklida).
+ *
+ * @return int - 1 jika berhasil, 0 jika penulisan gagal atau baris tidak muat
+ *               di satu blok
+ */
+int csv_writer_write_network_header(CsvWriter* writer, const DecayNetwork* network,
+                                    const int* species, int num_species);
+int csv_writer_write_network_row(CsvWriter* writer, double time_s, const double* N,
+                                 const int* species, int num_species);
+
+/**
+ * FORMAT BINER KOLUMNAR (output_*.bin)
+ * ====================================
+ *
+ * Seluruh field little-endian. Header berukuran BINARY_HEADER_BYTES(num_columns)
+ * (kelipatan 64 byte sehingga setiap kolom dimulai pada batas cache line):
+ *
+ *   offset  ukuran  isi
+ *        0       8  magic "DECAYBIN"
+ *        8       4  uint32 versi format (BINARY_FORMAT_VERSION)
+ *       12       4  uint32 ukuran header = offset kolom pertama (byte)
+ *       16       8  uint64 jumlah baris
+ *       24       4  uint32 jumlah kolom
+ *       28       4  (cadangan, nol)
+ *       32       8  double N0
+ *       40       8  double lambda (s⁻¹)
+ *       48       8  double t_initial (s)
+ *       56       8  double delta_t (s); 0 untuk grid waktu variabel (adaptif)
+ *       64      32  nama metode (ASCII, diisi nol)
+ *       96      32  (cadangan, nol)
+ *      128  32 * C  nama kolom (ASCII, diisi nol), urutan sama dengan CSV
+ *
+ * Setelah header, kolom ke-c adalah num_rows double kontigu mulai dari
+ * offset header + c * num_rows * 8.
+ */
+#define BINARY_MAGIC "DECAYBIN"
+#define BINARY_FORMAT_VERSION 1u
+#define BINARY_NAME_BYTES 32
+#define BINARY_FIXED_HEADER_BYTES 128
+#define BINARY_HEADER_BYTES(num_columns) \
+    ((BINARY_FIXED_HEADER_BYTES + (num_columns) * BINARY_NAME_BYTES + 63u) & ~(size_t)63u)
+
+/**
+ * METADATA RUN UNTUK HEADER BINER
+ */
+typedef struct {
+    double N0;
+    double lambda;
+    double t_initial;
+    double delta_t;
+    const char* method;               // Nama metode (maks. 31 karakter)
+} OutputMetadata;
+
+/**
+ * PENULIS BINER KOLUMNAR
+ *
+ * Jumlah baris harus diketahui saat file dibuka: file langsung dialokasikan
+ * penuh, lalu setiap blok baris ditulis ke posisinya di masing-masing kolom.
+ * Karena itu baris boleh datang per chunk (mode streaming) tanpa buffer penuh.
+ */
+typedef struct {
+    FILE* fp;
+    double* staging;                  // Buffer kumpul kolom (AoS) / tukar byte
+    int num_rows;                     // Jumlah baris total di file
+    size_t header_bytes;              // Offset kolom pertama
+    int failed;                       // 1 jika ada penulisan yang gagal
+} BinaryWriter;
+
+/**
+ * Membuat file biner, menulis header, dan mengalokasikan file untuk
+ * num_rows baris.
+ *
+ * @return int - 1 jika berhasil, 0 jika file atau buffer gagal dibuat
+ */
+int binary_writer_open(BinaryWriter* writer, const char* filename,
+                       const OutputMetadata* metadata, int num_rows);
+
+/**
+ * Menulis baris kontainer results ke baris global
+ * [first_row, first_row + results->num_rows) di setiap kolom.
+ *
+ * @return int - 1 jika berhasil, 0 jika penulisan gagal atau di luar rentang
+ */
+int binary_writer_write_rows(BinaryWriter* writer, const SimulationResults* results, int first_row);
+
+/**
+ * Menutup file dan membebaskan buffer.
+ *
+ * @return int - 1 jika seluruh penulisan berhasil, 0 jika ada yang gagal
+ */
+int binary_writer_close(BinaryWriter* writer);
+
+/**
+ * Fungsi sink streaming yang menulis setiap chunk ke file biner
+ * (context = BinaryWriter*).
+ */
+int binary_sink_consume(void* context, const SimulationResults* chunk, int first_row);
+
+/**
+ * BUFFER TEKS KONSOL
+ * ==================
+ *
+ * Penampung keluaran konsol satu kasus simulasi. Saat sweep berjalan
+ * paralel, setiap kasus menulis ke buffernya sendiri dan buffer dicetak
+ * dalam urutan kasus sehingga keluaran konsol identik dengan run sekuensial.
+ */
+typedef struct {
+    char* data;
+    size_t length;
+    size_t capacity;
+    int failed;                       // 1 jika alokasi gagal (teks terpotong)
+} TextBuffer;
+
+void text_buffer_init(TextBuffer* buffer);
+
+/**
+ * Menambahkan teks berformat printf ke buffer.
+ */
+#if defined(__GNUC__)
+__attribute__((format(printf, 2, 3)))
+#endif
+void text_printf(TextBuffer* buffer, const char* format, ...);
+
+/**
+ * Menulis isi buffer ke stream lalu mengosongkannya.
+ */
+void text_buffer_flush(TextBuffer* buffer, FILE* stream);
+
+void text_buffer_free(TextBuffer* buffer);
+
+/**
+ * DIREKTORI KELUARAN
+ * ==================
+ *
+ * Semua file hasil ditulis relatif terhadap direktori keluaran (--output-dir);
+ * direktori kosong atau NULL berarti direktori kerja.
+ */
+
+// Panjang maksimum path file keluaran (direktori + nama file)
+#define OUTPUT_PATH_MAX 1024
+
+/**
+ * Membuat direktori beserta induknya jika belum ada (seperti mkdir -p).
+ *
+ * @return int - 1 jika direktori ada atau berhasil dibuat, 0 jika gagal
+ */
+int output_make_directory(const char* path);
+
+/**
+ * Menggabungkan direktori keluaran dan nama file ke out.
+ *
+ * @return int - 1 jika berhasil, 0 jika path melebihi size (out terpotong)
+ */
+int output_path(char* out, size_t size, const char* directory, const char* name);
+
+/**
+ * Label delta_t_values[case_index] untuk nama file hasil. Nama lama "%.0f"
+ * (mis. "33035", "1652") dipakai selama unik di sweep; jika bertabrakan
+ * dengan kasus lain (mis. 0.25 dan 0.5 -> "0"), label menjadi
+ * "%.6g_c<indeks kasus>" (mis. "0.25_c3") sehingga kasus sweep tidak pernah
+ * menimpa file satu sama lain.
+ */
+void output_delta_t_label(char* out, size_t size, const double* delta_t_values, int num_cases,
+                          int case_index);
+
+/**
+ * FORMATTER ANGKA (SETARA printf "%.{precision}f" DAN "%.{precision}e")
+ * =====================================================================
+ *
+ * Menulis representasi teks x ke out (tanpa terminator nol) dan
+ * mengembalikan jumlah byte yang ditulis. Buffer out minimal FORMAT_MAX_BYTES.
+ * Nilai di luar jalur cepat (NaN, tak hingga, magnitudo ekstrem) diformat
+ * dengan snprintf sehingga hasilnya selalu identik dengan printf.
+ *
+ * format_fixed    : precision 0..9
+ * format_exponent : precision 0..15
+ */
+size_t format_fixed(char* out, double x, int precision);
+size_t format_exponent(char* out, double x, int precision);
+
+#endif // OUTPUT_H
@@ -1,11 +1,102 @@
 """
 DOKUMENTASI PROGRAM PLOT HASIL SIMULASI PELURUHAN RADON-222
 ===============================================
+
+Tanpa argumen, program memplot data sampel yang tertulis di bawah.
+Dengan argumen file output_*.bin (hasil `./main --binary`), kolom dibaca
+langsung dari file via numpy.memmap tanpa parsing teks:
+
+    python plot.py output_33035.bin output_1652.bin
 """
 
+import struct
+import sys
+
 import matplotlib.pyplot as plt
 import numpy as np
 
+# ================== BAGIAN 0: PEMBACA FORMAT BINER KOLUMNAR ==================
+
+# Header tetap 128 byte (lihat output.h): magic, versi, ukuran header,
+# jumlah baris, jumlah kolom, N0, lambda, t_awal, delta_t, nama metode
+BINER_MAGIC = b'DECAYBIN'
+BINER_VERSI = 1
+BINER_HEADER_TETAP = struct.Struct('<8sIIQII4d32s32s')
+BINER_PANJANG_NAMA = 32
+
+
+def baca_output_biner(path):
+    """
+    Membaca header file output_*.bin dan memetakan kolomnya ke memori.
+
+    Mengembalikan (metadata, kolom): metadata berisi N0, lambda, t_awal,
+    delta_t, dan metode; kolom adalah dict nama kolom -> array numpy
+    read-only yang menunjuk langsung ke file (tanpa salinan).
+    """
+    with open(path, 'rb') as f:
+        header = f.read(BINER_HEADER_TETAP.size)
+        (magic, versi, ukuran_header, jumlah_baris, jumlah_kolom, _,
+         N0_file, lambda_file, t_awal, delta_t, metode, _) = BINER_HEADER_TETAP.unpack(header)
+        if magic != BINER_MAGIC or versi != BINER_VERSI:
+            raise ValueError(f'{path}: bukan file output biner versi {BINER_VERSI}')
+        nama_kolom = [f.read(BINER_PANJANG_NAMA).rstrip(b'\0').decode('ascii')
+                      for _ in range(jumlah_kolom)]
+
+    # Seluruh kolom kontigu: baris ke-c dari matriks adalah kolom ke-c
+    data = np.memmap(path, dtype='<f8', mode='r', offset=ukuran_header,
+                     shape=(jumlah_kolom, jumlah_baris))
+    metadata = {
+        'N0': N0_file,
+        'lambda': lambda_file,
+        't_awal': t_awal,
+        'delta_t': delta_t,
+        'metode': metode.rstrip(b'\0').decode('ascii'),
+    }
+    return metadata, {nama: data[c] for c, nama in enumerate(nama_kolom)}
+
+
+def label_kasus(metadata):
+    """Label legenda; delta_t = 0 menandakan grid waktu variabel (mode adaptif)."""
+    if metadata['delta_t'] == 0:
+        return f"step adaptif ({metadata['metode']})"
+    return f"dt = {metadata['delta_t'] / 3600:.2f} jam ({metadata['metode']})"
+
+
+def plot_file_biner(paths):
+    """Memplot N(t) dan error relatif dari satu atau lebih file output_*.bin."""
+    hasil = [(path, *baca_output_biner(path)) for path in paths]
+
+    plt.figure(figsize=(10, 6))
+    _, _, kolom_pertama = hasil[0]
+    plt.plot(kolom_pertama['Time_s'] / (24 * 3600), kolom_pertama['N_Analytical'] / 1e14,
+             'k-', linewidth=2, label='Analitik')
+    for path, metadata, kolom in hasil:
+        plt.plot(kolom['Time_s'] / (24 * 3600), kolom['N_Numerical'] / 1e14, '--',
+                 label=label_kasus(metadata))
+    plt.xlabel('Waktu (hari)')
+    plt.ylabel('Jumlah Atom (×10¹⁴)')
+    plt.title('Peluruhan Radon-222: Numerik vs Analitik')
+    plt.legend()
+    plt.grid(True, alpha=0.3)
+    plt.tight_layout()
+
+    plt.figure(figsize=(10, 6))
+    for path, metadata, kolom in hasil:
+        plt.plot(kolom['Time_s'] / (24 * 3600), kolom['Error_Relative_Percent'],
+                 label=label_kasus(metadata))
+    plt.xlabel('Waktu (hari)')
+    plt.ylabel('Error Relatif (%)')
+    plt.title('Error Relatif vs Waktu')
+    plt.legend()
+    plt.grid(True, alpha=0.3)
+    plt.tight_layout()
+    plt.show()
+
+
+if len(sys.argv) > 1:
+    plot_file_biner(sys.argv[1:])
+    sys.exit(0)
+
 # ================== BAGIAN 1: INISIALISASI DATA ==================
 
 # Data waktu simulasi (dalam detik)
@@ -0,0 +1,873 @@
+/**
+ * ========================================================================
+ * IMPLEMENTASI MODUL SIMULASI PELURUHAN RADIOAKTIF
+ * ========================================================================
+ *
+ * Lihat simulation.h untuk deskripsi struktur hasil dan antarmuka kernel.
+ */
+
+#include "simulation.h"
+#include "stats.h"
+#include "vexp.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#ifdef _WIN32
+#include <malloc.h>
+#elif defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+/**
+ * KONTAINER HASIL: ALOKASI DAN AKSES
+ * ==================================
+ */
+SimulationResults results_empty(ResultLayout layout) {
+    SimulationResults results = { 0 };
+    results.layout = layout;
+    results.stride = (layout == RESULT_LAYOUT_AOS) ? SIMULATION_NUM_COLUMNS : 1;
+    return results;
+}
+
+// Menyusun ulang pointer kolom AoS setelah array baris dialokasikan / dipindah
+static void results_bind_aos_columns(SimulationResults* results) {
+    results->time_s = &results->rows[0].time_s;
+    results->N_numerical = &results->rows[0].N_numerical;
+    results->N_analytical = &results->rows[0].N_analytical;
+    results->error_absolute = &results->rows[0].error_absolute;
+    results->error_relative_percent = &results->rows[0].error_relative_percent;
+}
+
+// Ukuran dibulatkan ke atas ke kelipatan `alignment`
+static size_t round_up(size_t size, size_t alignment) {
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+void* simulation_block_alloc(size_t bytes, size_t* bytes_allocated) {
+    size_t alignment = RESULTS_CACHE_LINE;
+    size_t total_bytes = round_up(bytes, RESULTS_CACHE_LINE);
+    if (total_bytes >= RESULTS_HUGE_PAGE_THRESHOLD) {
+        alignment = RESULTS_HUGE_PAGE;
+        total_bytes = round_up(total_bytes, RESULTS_HUGE_PAGE);
+    }
+
+#ifdef _WIN32
+    void* block = _aligned_malloc(total_bytes, alignment);
+#else
+    void* block = NULL;
+    if (posix_memalign(&block, alignment, total_bytes) != 0) block = NULL;
+#endif
+    if (block == NULL) return NULL;
+
+#ifdef MADV_HUGEPAGE
+    // Anjuran transparent huge pages untuk blok besar (diabaikan jika tidak didukung)
+    if (alignment == RESULTS_HUGE_PAGE) {
+        madvise(block, total_bytes, MADV_HUGEPAGE);
+    }
+#endif
+
+    *bytes_allocated = total_bytes;
+    return block;
+}
+
+void simulation_block_free(void* block) {
+#ifdef _WIN32
+    _aligned_free(block);
+#else
+    free(block);
+#endif
+}
+
+int results_allocate(SimulationResults* results, int capacity) {
+    results->num_rows = 0;
+    results->capacity = 0;
+    if (capacity < 1) return 0;
+
+    // UKURAN BLOK TUNGGAL
+    // ===================
+    // AoS: capacity * 40 byte; SoA: lima kolom, masing-masing dibulatkan ke cache line
+    size_t column_bytes = round_up((size_t)capacity * sizeof(double), RESULTS_CACHE_LINE);
+    size_t total_bytes = (results->layout == RESULT_LAYOUT_AOS)
+                         ? (size_t)capacity * sizeof(SimulationStep)
+                         : SIMULATION_NUM_COLUMNS * column_bytes;
+
+    double start = stats_phase_begin();
+    void* block = simulation_block_alloc(total_bytes, &results->bytes_allocated);
+    stats_phase_end(STATS_PHASE_ALLOCATION, start);
+    if (block == NULL) return 0;
+    results->block = block;
+    results->allocation_count++;
+    stats_count(STATS_COUNTER_ALLOCATIONS, 1);
+    stats_count(STATS_COUNTER_BYTES_ALLOCATED, (long long)results->bytes_allocated);
+
+    if (results->layout == RESULT_LAYOUT_AOS) {
+        results->rows = (SimulationStep*)block;
+        results_bind_aos_columns(results);
+    } else {
+        char* base = (char*)block;
+        results->time_s = (double*)(base + 0 * column_bytes);
+        results->N_numerical = (double*)(base + 1 * column_bytes);
+        results->N_analytical = (double*)(base + 2 * column_bytes);
+        results->error_absolute = (double*)(base + 3 * column_bytes);
+        results->error_relative_percent = (double*)(base + 4 * column_bytes);
+    }
+
+    results->capacity = capacity;
+    return 1;
+}
+
+void results_free(SimulationResults* results) {
+    simulation_block_free(results->block);
+    *results = results_empty(results->layout);
+}
+
+SimulationStep results_row(const SimulationResults* results, int i) {
+    size_t k = (size_t)i * results->stride;
+    SimulationStep row;
+    row.time_s = results->time_s[k];
+    row.N_numerical = results->N_numerical[k];
+    row.N_analytical = results->N_analytical[k];
+    row.error_absolute = results->error_absolute[k];
+    row.error_relative_percent = results->error_relative_percent[k];
+    return row;
+}
+
+SimulationResults results_slice(const SimulationResults* results, int first_row, int num_rows) {
+    SimulationResults view = *results;
+    size_t k = (size_t)first_row * results->stride;
+    view.time_s += k;
+    view.N_numerical += k;
+    view.N_analytical += k;
+    view.error_absolute += k;
+    view.error_relative_percent += k;
+    view.rows = (results->rows != NULL) ? results->rows + first_row : NULL;
+    view.num_rows = num_rows;
+    view.capacity = num_rows;
+    view.block = NULL;
+    view.bytes_allocated = 0;
+    view.allocation_count = 0;
+    return view;
+}
+
+const char* results_layout_name(ResultLayout layout) {
+    return (layout == RESULT_LAYOUT_SOA) ? "soa" : "aos";
+}
+
+static const char* const evaluation_mode_names[EULER_MODE_COUNT] = {
+    "double", "direct", "indexed-time", "kahan", "double-double", "long-double", "float"
+};
+
+const char* evaluation_mode_name(EulerEvaluationMode mode) {
+    if ((int)mode < 0 || mode >= EULER_MODE_COUNT) mode = EULER_MODE_SEQUENTIAL;
+    return evaluation_mode_names[mode];
+}
+
+int evaluation_mode_from_name(const char* name, EulerEvaluationMode* mode) {
+    for (int m = 0; m < EULER_MODE_COUNT; m++) {
+        if (strcmp(name, evaluation_mode_names[m]) == 0) {
+            *mode = (EulerEvaluationMode)m;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+void simulation_method_label(IntegratorMethod method, EulerEvaluationMode mode,
+                             char* out, size_t size) {
+    if (mode == EULER_MODE_SEQUENTIAL) {
+        snprintf(out, size, "%s", integrator_info(method)->name);
+    } else {
+        snprintf(out, size, "%s-%s", integrator_info(method)->name, evaluation_mode_name(mode));
+    }
+}
+
+int euler_step_count(double t_initial, double t_final, double delta_t) {
+    if (delta_t <= 0) return 0;
+    double steps = ceil((t_final - t_initial) / delta_t - 0.5);
+    return (steps < 1.0) ? 1 : (int)steps;
+}
+
+/**
+ * PENGISIAN KOLOM ANALITIK DAN ERROR
+ * ==================================
+ *
+ * Solusi eksak N(t) = N₀ * e^(-λt), error absolut |N_numerik - N_analitik| dan
+ * error relatif (|error| / N_analitik) * 100% dihitung untuk seluruh baris
+ * dalam satu lintasan memakai kernel exp tervektorisasi (lihat vexp.h).
+ *
+ * Parameter:
+ * @param N0                  - Jumlah atom awal
+ * @param lambda              - Konstanta peluruhan (s⁻¹)
+ * @param results             - Kontainer hasil (time_s dan N_numerical sudah terisi)
+ * @param first_row           - Indeks baris pertama yang diisi
+ * @param end_row             - Indeks setelah baris terakhir yang diisi
+ */
+void fill_analytic_columns(double N0, double lambda, SimulationResults* results,
+                           int first_row, int end_row) {
+    if (end_row <= first_row) return;
+    double start = stats_phase_begin();
+    size_t k = (size_t)first_row * results->stride;
+    vexp_fill_analytic(N0, lambda,
+                       results->time_s + k, results->N_numerical + k,
+                       results->N_analytical + k, results->error_absolute + k,
+                       results->error_relative_percent + k,
+                       results->stride, (size_t)(end_row - first_row));
+    stats_phase_end(STATS_PHASE_ANALYTIC, start);
+    stats_count(STATS_COUNTER_EXP_CALLS, end_row - first_row);
+}
+
+/**
+ * ARITMETIKA DOUBLE-DOUBLE
+ * ========================
+ * Nilai x = hi + lo dengan |lo| <= ulp(hi)/2. two_sum dan two_prod
+ * menghasilkan jumlah/hasil kali eksak sebagai pasangan (Knuth, Dekker);
+ * two_prod memakai fma sehingga error hasil kali didapat tanpa pemisahan.
+ */
+typedef struct {
+    double hi;
+    double lo;
+} DoubleDouble;
+
+static inline DoubleDouble two_sum(double a, double b) {
+    double s = a + b;
+    double b_virtual = s - a;
+    double error = (a - (s - b_virtual)) + (b - b_virtual);
+    return (DoubleDouble){ s, error };
+}
+
+static inline DoubleDouble fast_two_sum(double a, double b) {
+    double s = a + b;
+    return (DoubleDouble){ s, b - (s - a) };
+}
+
+static inline DoubleDouble two_prod(double a, double b) {
+    double p = a * b;
+    return (DoubleDouble){ p, fma(a, b, -p) };
+}
+
+static inline DoubleDouble dd_mul(DoubleDouble x, DoubleDouble y) {
+    DoubleDouble p = two_prod(x.hi, y.hi);
+    p.lo += x.hi * y.lo + x.lo * y.hi;
+    return fast_two_sum(p.hi, p.lo);
+}
+
+/**
+ * STATE KERNEL ANTAR CHUNK
+ * ========================
+ * Selain (N, t), mode presisi membawa bagian rendah N (kompensasi Kahan atau
+ * lo double-double) dan N dalam tipe lebarnya, sehingga pemanggilan per
+ * chunk identik dengan satu pemanggilan penuh.
+ */
+typedef struct {
+    double N;
+    double N_low;                     // Kompensasi Kahan / bagian lo double-double
+    long double N_long;
+    float N_float;
+    double t;
+    double t_initial;
+    int row;                          // Indeks global baris berikutnya
+} DecayKernelState;
+
+static DecayKernelState decay_kernel_state(double N0, double t_initial) {
+    return (DecayKernelState){ N0, 0.0, (long double)N0, (float)N0, t_initial, t_initial, 0 };
+}
+
+// Faktor Euler 1 - λΔt dalam double-double (eksak dari λ dan Δt double)
+static DoubleDouble euler_factor(double lambda, double delta_t) {
+    DoubleDouble product = two_prod(lambda, delta_t);
+    DoubleDouble factor = two_sum(1.0, -product.hi);
+    return fast_two_sum(factor.hi, factor.lo - product.lo);
+}
+
+double euler_recurrence_exact(double N0, double lambda, double delta_t, int steps) {
+    DoubleDouble base = euler_factor(lambda, delta_t);
+    DoubleDouble result = { N0, 0.0 };
+    for (unsigned int e = (steps > 0) ? (unsigned int)steps : 0u; e > 0; e >>= 1) {
+        if (e & 1u) result = dd_mul(result, base);
+        base = dd_mul(base, base);
+    }
+    return result.hi + result.lo;
+}
+
+/**
+ * KERNEL KOMPUTASI INTEGRATOR (TANPA I/O)
+ * =======================================
+ *
+ * Kernel ini hanya mengisi kolom waktu dan N numerik: tidak ada printf di
+ * dalam loop, sehingga waktu eksekusi untuk jumlah step yang sangat besar
+ * dibatasi oleh aritmetika, bukan oleh output terminal. Kolom analitik dan
+ * error diisi sekaligus setelah loop oleh fill_analytic_columns().
+ *
+ * Metode Euler memakai loop khusus di bawah (rumus step ditulis langsung,
+ * satu loop per mode presisi); metode lain memanggil fungsi step dari tabel
+ * integrator (integrator.h) dengan kolom waktu yang dibentuk dengan cara
+ * yang sama.
+ *
+ * Jumlah baris sudah diketahui dan kontainer sudah berukuran tepat, sehingga
+ * loop tidak memiliki cabang realloc maupun pemeriksaan terminasi per step.
+ * State dibawa lewat DecayKernelState agar kernel dapat dipanggil per chunk
+ * pada mode streaming dengan hasil yang identik dengan satu panggilan penuh.
+ *
+ * Parameter:
+ * @param method              - Metode integrasi
+ * @param mode                - Mode presisi (EULER_MODE_SEQUENTIAL atau mode presisi)
+ * @param lambda              - Konstanta peluruhan (s⁻¹)
+ * @param delta_t             - Ukuran step waktu (s)
+ * @param state               - State pada baris pertama; diperbarui ke baris berikutnya
+ * @param results             - Kontainer hasil (kapasitas >= num_rows)
+ * @param num_rows            - Jumlah baris yang diisi mulai dari indeks 0
+ */
+static void decay_kernel(
+    IntegratorMethod method, EulerEvaluationMode mode, double lambda, double delta_t,
+    DecayKernelState* state, SimulationResults* results, int num_rows
+) {
+    // INISIALISASI VARIABEL SIMULASI
+    // ==============================
+    double current_N = state->N;          // Jumlah atom saat ini
+    double current_t = state->t;          // Waktu saat ini
+    double t_initial = state->t_initial;
+    int first_row = state->row;
+    size_t stride = results->stride;
+    double* time_s = results->time_s;
+    double* N_numerical = results->N_numerical;
+
+    // Kolom waktu terindeks untuk semua mode presisi
+    if (mode != EULER_MODE_SEQUENTIAL) {
+        for (int row = 0; row < num_rows; row++) {
+            time_s[(size_t)row * stride] = t_initial + (double)(first_row + row) * delta_t;
+        }
+        current_t = t_initial + (double)(first_row + num_rows) * delta_t;
+    }
+    state->row = first_row + num_rows;
+    results->num_rows = num_rows;
+
+    // METODE SELAIN EULER: STEP DARI TABEL INTEGRATOR
+    // ===============================================
+    if (method != INTEGRATOR_EULER) {
+        IntegratorStepFn step = integrator_info(method)->step;
+        if (mode != EULER_MODE_SEQUENTIAL) {
+            for (int row = 0; row < num_rows; row++) {
+                N_numerical[(size_t)row * stride] = current_N;
+                current_N = step(lambda, current_N, delta_t);
+            }
+        } else {
+            for (int row = 0; row < num_rows; row++) {
+                time_s[(size_t)row * stride] = current_t;
+                N_numerical[(size_t)row * stride] = current_N;
+                current_N = step(lambda, current_N, delta_t);
+                current_t = current_t + delta_t;
+            }
+        }
+
+        state->N = current_N;
+        state->t = current_t;
+        return;
+    }
+
+    switch (mode) {
+    case EULER_MODE_KAHAN: {
+        // N_{i+1} = N_i + δ_i dengan δ_i = Δt * (-λN_i); bagian δ yang hilang
+        // saat dijumlahkan ke N disimpan di kompensasi dan dikurangkan dari
+        // kenaikan berikutnya
+        double compensation = state->N_low;
+        for (int row = 0; row < num_rows; row++) {
+            N_numerical[(size_t)row * stride] = current_N;
+            double increment = delta_t * (-lambda * current_N) - compensation;
+            double sum = current_N + increment;
+            compensation = (sum - current_N) - increment;
+            current_N = sum;
+        }
+        state->N_low = compensation;
+        break;
+    }
+    case EULER_MODE_DOUBLE_DOUBLE: {
+        // N *= (1 - λΔt), faktor dibentuk eksak dari λ dan Δt dalam double-double
+        DoubleDouble factor = euler_factor(lambda, delta_t);
+        DoubleDouble N = { current_N, state->N_low };
+        for (int row = 0; row < num_rows; row++) {
+            N_numerical[(size_t)row * stride] = N.hi + N.lo;
+            N = dd_mul(N, factor);
+        }
+        current_N = N.hi;
+        state->N_low = N.lo;
+        break;
+    }
+    case EULER_MODE_LONG_DOUBLE: {
+        long double N = state->N_long;
+        long double lambda_long = lambda, delta_t_long = delta_t;
+        for (int row = 0; row < num_rows; row++) {
+            N_numerical[(size_t)row * stride] = (double)N;
+            N = N + delta_t_long * (-lambda_long * N);
+        }
+        state->N_long = N;
+        current_N = (double)N;
+        break;
+    }
+    case EULER_MODE_FLOAT: {
+        float N = state->N_float;
+        float lambda_float = (float)lambda, delta_t_float = (float)delta_t;
+        for (int row = 0; row < num_rows; row++) {
+            N_numerical[(size_t)row * stride] = (double)N;
+            N = N + delta_t_float * (-lambda_float * N);
+        }
+        state->N_float = N;
+        current_N = (double)N;
+        break;
+    }
+    case EULER_MODE_INDEXED_TIME:
+        for (int row = 0; row < num_rows; row++) {
+            N_numerical[(size_t)row * stride] = current_N;
+            current_N = current_N + delta_t * (-lambda * current_N);
+        }
+        break;
+    default:
+        // LOOP UTAMA SIMULASI METODE EULER
+        // =================================
+        for (int row = 0; row < num_rows; row++) {
+
+            // PENYIMPANAN HASIL step SAAT INI
+            // ==================================
+            time_s[(size_t)row * stride] = current_t;
+            N_numerical[(size_t)row * stride] = current_N;
+
+            // IMPLEMENTASI METODE EULER
+            // =========================
+            // Hitung turunan: dN/dt = -λN
+            double dN_dt = -lambda * current_N;
+
+            // Update nilai N menggunakan formula Euler: N_baru = N_lama + Δt * (dN/dt)
+            current_N = current_N + delta_t * dN_dt;
+
+            // Advance waktu: t_baru = t_lama + Δt
+            current_t = current_t + delta_t;
+        }
+        break;
+    }
+
+    state->N = current_N;
+    state->t = current_t;
+}
+
+/**
+ * KERNEL EVALUASI LANGSUNG (BENTUK TERTUTUP) REKURENSI INTEGRATOR
+ * ==============================================================
+ *
+ * Untuk dN/dt = -λN setiap metode eksplisit memenuhi N_{i+1} = N_i * R(z)
+ * dengan z = -λΔt (faktor amplifikasi, lihat integrator.h). Rekurensinya
+ * adalah barisan geometri, sehingga N_i = N₀ * r^i dengan r = R(z); untuk
+ * Euler r = 1 - λΔt. Baris dikelompokkan per blok berukuran
+ * EULER_DIRECT_BLOCK: anchor blok N₀ * r^(b*B) dihitung dengan pow(), lalu
+ * baris di dalam blok = anchor * r^j memakai tabel pangkat r^j. Setiap baris
+ * hanya bergantung pada tabel, sehingga rentang [first_row, end_row) dapat
+ * diisi paralel oleh beberapa pemanggil dan loop dalam dapat divektorisasi.
+ *
+ * Hasilnya tidak identik bit-per-bit dengan loop sekuensial (loop tersebut
+ * membulatkan di setiap step), tetapi deviasi relatifnya dibatasi oleh
+ * (EULER_DIRECT_TOL_PER_STEP * s * i + EULER_DIRECT_TOL_OFFSET) * DBL_EPSILON
+ * dengan s jumlah tahap metode.
+ *
+ * Baris global first_row ditulis ke indeks 0 kontainer; untuk mengisi bagian
+ * tengah array penuh, berikan results_slice() yang dimulai di first_row.
+ *
+ * Parameter:
+ * @param method              - Metode integrasi
+ * @param N0                  - Jumlah atom awal
+ * @param lambda              - Konstanta peluruhan (s⁻¹)
+ * @param t_initial           - Waktu awal simulasi (s)
+ * @param delta_t             - Ukuran step waktu (s)
+ * @param results             - Kontainer tujuan (kapasitas >= end_row - first_row)
+ * @param first_row           - Indeks global baris pertama yang diisi
+ * @param end_row             - Indeks global setelah baris terakhir yang diisi
+ */
+static void direct_kernel(
+    IntegratorMethod method, double N0, double lambda,
+    double t_initial, double delta_t,
+    SimulationResults* results, int first_row, int end_row
+) {
+    // Faktor pengali per step = satu step metode dari N = 1, dibentuk dengan
+    // operasi yang sama seperti loop (untuk Euler: 1 + Δt * (-λ))
+    double r = integrator_info(method)->step(lambda, 1.0, delta_t);
+    size_t stride = results->stride;
+
+    // TABEL PANGKAT r^j UNTUK SATU BLOK
+    // =================================
+    double r_pow[EULER_DIRECT_BLOCK];
+    for (int j = 0; j < EULER_DIRECT_BLOCK; j++) {
+        r_pow[j] = pow(r, (double)j);
+    }
+
+    int block = first_row / EULER_DIRECT_BLOCK;
+    int row = first_row;
+    while (row < end_row) {
+        int block_start = block * EULER_DIRECT_BLOCK;
+        int block_end = block_start + EULER_DIRECT_BLOCK;
+        if (block_end > end_row) block_end = end_row;
+
+        // Anchor blok: N₀ * r^(b*B), tanpa ketergantungan pada blok sebelumnya
+        double anchor = N0 * pow(r, (double)block_start);
+
+        for (int i = row; i < block_end; i++) {
+            size_t k = (size_t)(i - first_row) * stride;
+            results->time_s[k] = t_initial + (double)i * delta_t;
+            results->N_numerical[k] = anchor * r_pow[i - block_start];
+        }
+
+        row = block_end;
+        block++;
+    }
+}
+
+// Kernel evaluasi langsung + kolom analitik dan error
+void decay_direct_fill(
+    IntegratorMethod method, double N0, double lambda,
+    double t_initial, double delta_t,
+    SimulationResults* results, int first_row, int end_row
+) {
+    direct_kernel(method, N0, lambda, t_initial, delta_t, results, first_row, end_row);
+    fill_analytic_columns(N0, lambda, results, 0, end_row - first_row);
+}
+
+/**
+ * FUNGSI UTAMA UNTUK SIMULASI PELURUHAN RADIOAKTIF
+ * ================================================
+ *
+ * Metode Euler adalah metode numerik untuk menyelesaikan persamaan diferensial
+ * orde pertama dengan pendekatan:
+ *
+ * N(t+Δt) = N(t) + Δt * dN/dt
+ * N(t+Δt) = N(t) + Δt * (-λN(t))
+ * N(t+Δt) = N(t) * (1 - λΔt)
+ *
+ * Metode lain (Heun, RK4, RK45) mengganti rumus step dengan kombinasi
+ * beberapa evaluasi dN/dt per step (lihat integrator.c).
+ *
+ * Fungsi ini hanya melakukan validasi, alokasi memori, dan memanggil kernel
+ * komputasi; pelaporan ke konsol dan ekspor dilakukan oleh pemanggil.
+ *
+ * Jumlah step dihitung di depan oleh euler_step_count() sehingga kontainer
+ * dialokasikan sekali dengan ukuran tepat. Pada EULER_MODE_DIRECT seluruh
+ * baris diisi oleh kernel evaluasi langsung. decay_simulate() menambahkan
+ * kolom analitik dan error dengan fill_analytic_columns().
+ */
+int decay_integrate(
+    double N0, double lambda,
+    double t_initial, double t_final, double delta_t,
+    IntegratorMethod method, EulerEvaluationMode mode,
+    SimulationResults* results
+) {
+    // VALIDASI INPUT
+    // ==============
+    // Memastikan delta_t positif untuk menghindari error numerik
+    if (delta_t <= 0) {
+        printf("Error: delta_t harus positif.\n");
+        return 0;
+    }
+
+    // ALOKASI MEMORI TUNGGAL
+    // ======================
+    // Jumlah step dihitung eksak di depan: satu alokasi, tanpa realloc
+    int num_steps = euler_step_count(t_initial, t_final, delta_t);
+    if (!results_allocate(results, num_steps + 1)) {
+        printf("Error: Gagal mengalokasikan memori untuk hasil simulasi.\n");
+        return 0;
+    }
+
+    // JALANKAN KERNEL KOMPUTASI
+    // =========================
+    double start = stats_phase_begin();
+    if (mode == EULER_MODE_DIRECT) {
+        direct_kernel(method, N0, lambda, t_initial, delta_t, results, 0, num_steps + 1);
+        results->num_rows = num_steps + 1;
+    } else {
+        DecayKernelState state = decay_kernel_state(N0, t_initial);
+        decay_kernel(method, mode, lambda, delta_t, &state, results, num_steps + 1);
+    }
+    stats_phase_end(STATS_PHASE_INTEGRATION, start);
+    stats_count(STATS_COUNTER_STEPS, num_steps);
+
+    return num_steps;
+}
+
+int decay_simulate(
+    double N0, double lambda,
+    double t_initial, double t_final, double delta_t,
+    IntegratorMethod method, EulerEvaluationMode mode,
+    SimulationResults* results
+) {
+    int num_steps = decay_integrate(N0, lambda, t_initial, t_final, delta_t, method, mode, results);
+    if (num_steps > 0) fill_analytic_columns(N0, lambda, results, 0, results->num_rows);
+    return num_steps;
+}
+
+int euler_radioactive_decay(
+    double N0, double lambda,
+    double t_initial, double t_final, double delta_t,
+    SimulationResults* results, EulerEvaluationMode mode
+) {
+    return decay_simulate(N0, lambda, t_initial, t_final, delta_t, INTEGRATOR_EULER, mode, results);
+}
+
+/**
+ * MODE STREAMING: SIMULASI PER CHUNK TANPA ARRAY PENUH
+ * ====================================================
+ *
+ * Hanya satu kontainer berukuran STREAM_CHUNK_ROWS yang dialokasikan; setiap
+ * chunk diisi oleh kernel yang sama dengan mode biasa lalu diteruskan ke semua
+ * sink secara berurutan sebelum chunk berikutnya menimpanya. Memori puncak
+ * tetap konstan berapa pun jumlah step-nya, dan nilai setiap baris identik
+ * bit-per-bit dengan decay_simulate() untuk metode dan mode yang sama.
+ */
+int decay_simulate_stream(
+    double N0, double lambda,
+    double t_initial, double t_final, double delta_t,
+    IntegratorMethod method, EulerEvaluationMode mode, ResultLayout layout,
+    const ResultSink* sinks, int num_sinks
+) {
+    // VALIDASI INPUT
+    // ==============
+    if (delta_t <= 0) {
+        printf("Error: delta_t harus positif.\n");
+        return 0;
+    }
+
+    int num_steps = euler_step_count(t_initial, t_final, delta_t);
+    int total_rows = num_steps + 1;
+
+    // ALOKASI SATU CHUNK
+    // ==================
+    SimulationResults chunk = results_empty(layout);
+    int chunk_rows = (total_rows < STREAM_CHUNK_ROWS) ? total_rows : STREAM_CHUNK_ROWS;
+    if (!results_allocate(&chunk, chunk_rows)) {
+        printf("Error: Gagal mengalokasikan memori untuk chunk streaming.\n");
+        return 0;
+    }
+
+    // LOOP CHUNK
+    // ==========
+    DecayKernelState state = decay_kernel_state(N0, t_initial);
+    int ok = 1;
+    for (int first_row = 0; first_row < total_rows && ok; first_row += chunk_rows) {
+        int rows = total_rows - first_row;
+        if (rows > chunk_rows) rows = chunk_rows;
+
+        double start = stats_phase_begin();
+        if (mode == EULER_MODE_DIRECT) {
+            direct_kernel(method, N0, lambda, t_initial, delta_t, &chunk, first_row, first_row + rows);
+            chunk.num_rows = rows;
+        } else {
+            decay_kernel(method, mode, lambda, delta_t, &state, &chunk, rows);
+        }
+        stats_phase_end(STATS_PHASE_INTEGRATION, start);
+        fill_analytic_columns(N0, lambda, &chunk, 0, rows);
+
+        for (int s = 0; s < num_sinks && ok; s++) {
+            ok = sinks[s].consume(sinks[s].context, &chunk, first_row);
+        }
+    }
+
+    results_free(&chunk);
+    if (!ok) {
+        printf("Error: Sink streaming gagal memproses chunk.\n");
+        return 0;
+    }
+    stats_count(STATS_COUNTER_STEPS, num_steps);
+    return num_steps;
+}
+
+int euler_radioactive_decay_stream(
+    double N0, double lambda,
+    double t_initial, double t_final, double delta_t,
+    EulerEvaluationMode mode, ResultLayout layout,
+    const ResultSink* sinks, int num_sinks
+) {
+    return decay_simulate_stream(N0, lambda, t_initial, t_final, delta_t,
+                                 INTEGRATOR_EULER, mode, layout, sinks, num_sinks);
+}
+
+/**
+ * SIMULASI DENGAN STEP ADAPTIF
+ * ============================
+ *
+ * Kernel adaptif mengisi baris [0, max_rows) selama pengontrol masih
+ * melangkah: setiap baris adalah state sebelum step berikutnya, dan baris
+ * terakhir adalah state di t_final. State dibawa oleh AdaptiveStepper dan
+ * (N, t) sehingga kernel dapat dipanggil per chunk seperti decay_kernel.
+ *
+ * @return int - Jumlah baris yang diisi; *finished = 1 jika baris terakhir
+ *               berada di t_final (atau pengontrol gagal)
+ */
+static int adaptive_kernel(
+    AdaptiveStepper* stepper, double* current_N_ptr, double* current_t_ptr,
+    SimulationResults* results, int max_rows, int* finished
+) {
+    double current_N = *current_N_ptr;
+    double current_t = *current_t_ptr;
+    size_t stride = results->stride;
+    int rows = 0;
+
+    *finished = 0;
+    while (rows < max_rows) {
+        results->time_s[(size_t)rows * stride] = current_t;
+        results->N_numerical[(size_t)rows * stride] = current_N;
+        rows++;
+        if (!adaptive_stepper_advance(stepper, &current_N, &current_t)) {
+            *finished = 1;
+            break;
+        }
+    }
+
+    results->num_rows = rows;
+    *current_N_ptr = current_N;
+    *current_t_ptr = current_t;
+    return rows;
+}
+
+// Validasi parameter bersama ketiga fungsi adaptif
+static int adaptive_arguments_valid(double t_initial, double t_final, const AdaptiveControl* control) {
+    if (!(t_final > t_initial)) {
+        printf("Error: t_final harus lebih besar dari t_initial.\n");
+        return 0;
+    }
+    if (!(control->atol >= 0.0) || !(control->rtol >= 0.0) ||
+        (control->atol == 0.0 && control->rtol == 0.0)) {
+        printf("Error: Toleransi adaptif harus >= 0 dan tidak keduanya nol.\n");
+        return 0;
+    }
+    return 1;
+}
+
+// Pesan kegagalan pengontrol (step terlalu kecil atau terlalu banyak)
+static void report_adaptive_failure(const AdaptiveStepper* stepper, double t) {
+    if (stepper->stats.accepted_steps >= ADAPTIVE_MAX_STEPS) {
+        printf("Error: Integrasi adaptif melebihi %d step; longgarkan toleransi.\n", ADAPTIVE_MAX_STEPS);
+    } else {
+        printf("Error: Step adaptif menyusut di bawah resolusi waktu pada t = %.6e s.\n", t);
+    }
+}
+
+int decay_adaptive_step_count(
+    double N0, double lambda,
+    double t_initial, double t_final,
+    const AdaptiveControl* control, AdaptiveStats* stats
+) {
+    if (!adaptive_arguments_valid(t_initial, t_final, control)) return 0;
+
+    AdaptiveStepper stepper;
+    adaptive_stepper_init(&stepper, lambda, N0, t_initial, t_final, control);
+    double current_N = N0, current_t = t_initial;
+    while (adaptive_stepper_advance(&stepper, &current_N, &current_t)) {
+    }
+
+    if (stats != NULL) *stats = stepper.stats;
+    if (stepper.failed) {
+        report_adaptive_failure(&stepper, current_t);
+        return 0;
+    }
+    return stepper.stats.accepted_steps;
+}
+
+int decay_simulate_adaptive(
+    double N0, double lambda,
+    double t_initial, double t_final,
+    const AdaptiveControl* control,
+    SimulationResults* results, AdaptiveStats* stats
+) {
+    // HITUNG STEP, LALU ALOKASI TUNGGAL
+    // =================================
+    int num_steps = decay_adaptive_step_count(N0, lambda, t_initial, t_final, control, stats);
+    if (num_steps == 0) return 0;
+    if (!results_allocate(results, num_steps + 1)) {
+        printf("Error: Gagal mengalokasikan memori untuk hasil simulasi.\n");
+        return 0;
+    }
+
+    // JALANKAN ULANG PENGONTROL DAN SIMPAN GRID WAKTU
+    // ===============================================
+    AdaptiveStepper stepper;
+    adaptive_stepper_init(&stepper, lambda, N0, t_initial, t_final, control);
+    double current_N = N0, current_t = t_initial;
+    int finished;
+    adaptive_kernel(&stepper, &current_N, &current_t, results, num_steps + 1, &finished);
+    fill_analytic_columns(N0, lambda, results, 0, results->num_rows);
+
+    return num_steps;
+}
+
+int decay_simulate_adaptive_stream(
+    double N0, double lambda,
+    double t_initial, double t_final,
+    const AdaptiveControl* control, ResultLayout layout,
+    const ResultSink* sinks, int num_sinks, AdaptiveStats* stats
+) {
+    if (!adaptive_arguments_valid(t_initial, t_final, control)) return 0;
+
+    SimulationResults chunk = results_empty(layout);
+    if (!results_allocate(&chunk, STREAM_CHUNK_ROWS)) {
+        printf("Error: Gagal mengalokasikan memori untuk chunk streaming.\n");
+        return 0;
+    }
+
+    AdaptiveStepper stepper;
+    adaptive_stepper_init(&stepper, lambda, N0, t_initial, t_final, control);
+    double current_N = N0, current_t = t_initial;
+    int finished = 0;
+    int ok = 1;
+    for (int first_row = 0; !finished && ok; first_row += chunk.num_rows) {
+        adaptive_kernel(&stepper, &current_N, &current_t, &chunk, STREAM_CHUNK_ROWS, &finished);
+        fill_analytic_columns(N0, lambda, &chunk, 0, chunk.num_rows);
+        for (int s = 0; s < num_sinks && ok; s++) {
+            ok = sinks[s].consume(sinks[s].context, &chunk, first_row);
+        }
+    }
+
+    results_free(&chunk);
+    if (stats != NULL) *stats = stepper.stats;
+    if (stepper.failed) {
+        report_adaptive_failure(&stepper, current_t);
+        return 0;
+    }
+    if (!ok) {
+        printf("Error: Sink streaming gagal memproses chunk.\n");
+        return 0;
+    }
+    return stepper.stats.accepted_steps;
+}
+
+/**
+ * REDUKTOR ERROR ONLINE
+ * =====================
+ */
+void error_reducer_init(ErrorReducer* reducer) {
+    reducer->num_rows = 0;
+    reducer->max_error_absolute = 0.0;
+    reducer->max_error_relative_percent = 0.0;
+    reducer->sum_error_relative_percent = 0.0;
+    reducer->last_row.time_s = 0.0;
+    reducer->last_row.N_numerical = 0.0;
+    reducer->last_row.N_analytical = 0.0;
+    reducer->last_row.error_absolute = 0.0;
+    reducer->last_row.error_relative_percent = 0.0;
+}
+
+int error_reducer_consume(void* context, const SimulationResults* chunk, int first_row) {
+    ErrorReducer* reducer = (ErrorReducer*)context;
+    size_t stride = chunk->stride;
+    (void)first_row;
+
+    for (int i = 0; i < chunk->num_rows; i++) {
+        double abs_error = chunk->error_absolute[(size_t)i * stride];
+        double rel_error = chunk->error_relative_percent[(size_t)i * stride];
+        if (abs_error > reducer->max_error_absolute) reducer->max_error_absolute = abs_error;
+        if (rel_error > reducer->max_error_relative_percent) reducer->max_error_relative_percent = rel_error;
+        reducer->sum_error_relative_percent += rel_error;
+    }
+
+    if (chunk->num_rows > 0) {
+        reducer->last_row = results_row(chunk, chunk->num_rows - 1);
+        reducer->num_rows += chunk->num_rows;
+    }
+    return 1;
+}
@@ -0,0 +1,406 @@
+/**
+ * ========================================================================
+ * MODUL SIMULASI PELURUHAN RADIOAKTIF: STRUKTUR HASIL DAN KERNEL INTEGRASI
+ * ========================================================================
+ *
+ * Modul ini berisi struktur penyimpanan hasil simulasi dan kernel komputasi
+ * untuk persamaan dN/dt = -λN dengan metode Euler atau metode lain dari
+ * integrator.h. Tidak ada I/O konsol di dalam kernel; pelaporan dan ekspor
+ * dilakukan oleh pemanggil.
+ */
+
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include <stddef.h>
+
+#include "integrator.h"
+
+/**
+ * STRUKTUR DATA UNTUK MENYIMPAN HASIL SIMULASI
+ * ============================================
+ *
+ * Struktur ini menyimpan data hasil simulasi untuk setiap step waktu,
+ * termasuk perbandingan antara hasil numerik dan analitik serta analisis error.
+ */
+typedef struct {
+    double time_s;                    // Waktu dalam detik
+    double N_numerical;               // Jumlah atom hasil metode Euler
+    double N_analytical;              // Jumlah atom hasil solusi analitik
+    double error_absolute;            // Error absolut = |N_numerik - N_analitik|
+    double error_relative_percent;    // Error relatif dalam persen
+} SimulationStep;
+
+// Jumlah kolom double dalam satu SimulationStep
+#define SIMULATION_NUM_COLUMNS (sizeof(SimulationStep) / sizeof(double))
+
+/**
+ * TATA LETAK PENYIMPANAN HASIL
+ * ============================
+ *
+ * RESULT_LAYOUT_AOS : array-of-structs, satu SimulationStep per baris
+ *                     (kolom berjarak 40 byte)
+ * RESULT_LAYOUT_SOA : structure-of-arrays, lima array double kontigu
+ *                     (pemindaian satu kolom hanya membaca kolom tersebut)
+ */
+typedef enum {
+    RESULT_LAYOUT_AOS = 0,
+    RESULT_LAYOUT_SOA = 1
+} ResultLayout;
+
+/**
+ * KONTAINER HASIL SIMULASI
+ * ========================
+ *
+ * Kedua tata letak diakses dengan cara yang sama: elemen kolom pada baris i
+ * berada di column[i * stride]. Untuk AoS, pointer kolom menunjuk ke field
+ * pada baris pertama dan stride = SIMULATION_NUM_COLUMNS; untuk SoA, pointer
+ * kolom menunjuk ke array masing-masing dan stride = 1.
+ *
+ * Seluruh kolom berada dalam SATU blok memori teralokasi-rata: jumlah baris
+ * dihitung eksak sebelum simulasi sehingga tidak ada realloc di dalam loop.
+ * Untuk SoA, setiap kolom dimulai pada batas cache line.
+ */
+typedef struct {
+    ResultLayout layout;
+    int num_rows;                     // Jumlah baris yang terisi
+    int capacity;                     // Jumlah baris yang dialokasikan
+    size_t stride;                    // Jarak antar baris dalam satuan double
+
+    void* block;                      // Blok memori tunggal untuk seluruh kolom
+    size_t bytes_allocated;           // Ukuran blok (byte)
+    int allocation_count;             // Jumlah alokasi yang dilakukan untuk run ini
+
+    double* time_s;
+    double* N_numerical;
+    double* N_analytical;
+    double* error_absolute;
+    double* error_relative_percent;
+
+    SimulationStep* rows;             // Penyimpanan AoS (NULL untuk SoA)
+} SimulationResults;
+
+// Perataan blok hasil: cache line untuk blok kecil, huge page (2 MiB) untuk
+// blok besar agar kernel dapat memetakannya dengan transparent huge pages
+#define RESULTS_CACHE_LINE 64
+#define RESULTS_HUGE_PAGE (2u * 1024u * 1024u)
+#define RESULTS_HUGE_PAGE_THRESHOLD (8u * 1024u * 1024u)
+
+/**
+ * MODE EVALUASI REKURENSI
+ * =======================
+ *
+ * EULER_MODE_SEQUENTIAL : loop step demi step, mis. N_{i+1} = N_i + Δt * (-λN_i)
+ * EULER_MODE_DIRECT     : evaluasi langsung N_i = N₀ * r^i dengan r = R(-λΔt)
+ *                         (r = 1 - λΔt untuk Euler), setiap baris dihitung
+ *                         tanpa ketergantungan serial
+ *
+ * Nama EULER_* dipertahankan; kedua mode berlaku untuk semua metode di
+ * integrator.h.
+ *
+ * Mode presisi loop sekuensial (--precision). Dengan λΔt kecil dan 10^8+
+ * step, pembulatan menumpuk di N (sekitar ε/2 per step, karena N + Δt·dN/dt
+ * dibulatkan ke ulp N sementara kenaikannya λΔt kali lebih kecil) dan di
+ * t = t + Δt (drift waktu sebanding dengan i² ε Δt):
+ *
+ * EULER_MODE_INDEXED_TIME : t_i = t_initial + i Δt (satu pembulatan per baris),
+ *                           N seperti loop biasa; berlaku untuk semua metode
+ * EULER_MODE_KAHAN        : + penjumlahan terkompensasi Kahan untuk N_i + δ_i
+ *                           (error pembulatan penjumlahan dibawa ke step berikutnya)
+ * EULER_MODE_DOUBLE_DOUBLE: + N sebagai pasangan double (hi, lo), N *= (1 - λΔt)
+ *                           dalam aritmetika double-double (~106 bit)
+ * EULER_MODE_LONG_DOUBLE  : + N dalam long double (64 bit mantisa pada x87;
+ *                           sama dengan double pada kompiler yang tidak mendukung)
+ * EULER_MODE_FLOAT        : + N dalam float (cepat, error ~ i ε_float)
+ *
+ * Mode N terkompensasi/diperluas hanya dimiliki loop khusus Euler; metode
+ * lain memakai fungsi step double dari tabel integrator, sehingga untuk
+ * metode tersebut keempat mode itu sama dengan EULER_MODE_INDEXED_TIME.
+ * Jumlah step tidak dipengaruhi drift waktu karena selalu dihitung di
+ * depan oleh euler_step_count().
+ */
+typedef enum {
+    EULER_MODE_SEQUENTIAL = 0,
+    EULER_MODE_DIRECT = 1,
+    EULER_MODE_INDEXED_TIME = 2,
+    EULER_MODE_KAHAN = 3,
+    EULER_MODE_DOUBLE_DOUBLE = 4,
+    EULER_MODE_LONG_DOUBLE = 5,
+    EULER_MODE_FLOAT = 6
+} EulerEvaluationMode;
+
+#define EULER_MODE_COUNT 7
+
+/**
+ * Nama mode untuk opsi --precision dan label ("double", "direct",
+ * "indexed-time", "kahan", "double-double", "long-double", "float").
+ */
+const char* evaluation_mode_name(EulerEvaluationMode mode);
+
+/**
+ * @return int - 1 jika nama dikenal, 0 jika tidak
+ */
+int evaluation_mode_from_name(const char* name, EulerEvaluationMode* mode);
+
+// Ukuran blok untuk evaluasi langsung: satu pow() per blok untuk anchor,
+// baris di dalam blok = anchor * r^j dari tabel pangkat
+#define EULER_DIRECT_BLOCK 64
+
+// Batas deviasi relatif mode langsung terhadap loop sekuensial pada baris ke-i
+// untuk metode dengan s tahap:
+// |N_langsung - N_sekuensial| / N_sekuensial <= (A * s * i + B) * DBL_EPSILON
+#define EULER_DIRECT_TOL_PER_STEP 1.0
+#define EULER_DIRECT_TOL_OFFSET 4.0
+
+/**
+ * Label metode + mode untuk header biner dan nama file, mis. "rk4",
+ * "euler-direct", atau "euler-kahan".
+ */
+void simulation_method_label(IntegratorMethod method, EulerEvaluationMode mode,
+                             char* out, size_t size);
+
+/**
+ * Mengalokasikan satu blok teralokasi-rata minimal `bytes` byte: rata cache
+ * line, atau rata huge page (dengan anjuran transparent huge pages) jika
+ * ukurannya >= RESULTS_HUGE_PAGE_THRESHOLD. Dipakai oleh semua kontainer
+ * hasil; dibebaskan dengan simulation_block_free().
+ *
+ * @param bytes_allocated     - Keluaran: ukuran blok setelah pembulatan (byte)
+ *
+ * @return void* - Blok, atau NULL jika alokasi gagal
+ */
+void* simulation_block_alloc(size_t bytes, size_t* bytes_allocated);
+void simulation_block_free(void* block);
+
+/**
+ * Membuat kontainer kosong (belum dialokasikan) dengan tata letak tertentu.
+ */
+SimulationResults results_empty(ResultLayout layout);
+
+/**
+ * Mengalokasikan kontainer untuk tepat `capacity` baris dalam satu blok
+ * teralokasi-rata (lihat RESULTS_HUGE_PAGE_THRESHOLD).
+ *
+ * @return int - 1 jika berhasil, 0 jika alokasi gagal
+ */
+int results_allocate(SimulationResults* results, int capacity);
+
+/**
+ * Membebaskan seluruh memori kontainer dan mengosongkannya.
+ */
+void results_free(SimulationResults* results);
+
+/**
+ * Mengambil satu baris sebagai SimulationStep (untuk kedua tata letak).
+ */
+SimulationStep results_row(const SimulationResults* results, int i);
+
+/**
+ * Membuat tampilan (tanpa kepemilikan memori) atas baris
+ * [first_row, first_row + num_rows) dari kontainer yang sudah ada.
+ * Tampilan tidak boleh dibebaskan dengan results_free().
+ */
+SimulationResults results_slice(const SimulationResults* results, int first_row, int num_rows);
+
+/**
+ * Nama tata letak untuk ditampilkan ("aos" / "soa").
+ */
+const char* results_layout_name(ResultLayout layout);
+
+/**
+ * JUMLAH STEP EKSAK
+ * =================
+ *
+ * Step terakhir adalah step pertama (k >= 1) dengan t_k >= t_final - Δt/2,
+ * sehingga jumlah step = max(1, ceil((t_final - t_initial) / Δt - 1/2)) dan
+ * jumlah baris hasil = jumlah step + 1 (termasuk baris t_initial).
+ *
+ * @return int - Jumlah step, atau 0 jika delta_t tidak positif
+ */
+int euler_step_count(double t_initial, double t_final, double delta_t);
+
+/**
+ * NILAI EKSAK REKURENSI EULER
+ * ===========================
+ *
+ * N0 (1 - λΔt)^steps tanpa pembulatan per step (λ dan Δt sebagai double),
+ * dihitung dengan pemangkatan biner dalam double-double (error relatif
+ * ~10^-30). Referensi untuk mengukur error pembulatan mode presisi, bukan
+ * error diskretisasi.
+ */
+double euler_recurrence_exact(double N0, double lambda, double delta_t, int steps);
+
+/**
+ * Mengisi kolom analitik dan error untuk baris [first_row, end_row) dalam
+ * satu lintasan dengan kernel exp tervektorisasi (lihat vexp.h).
+ */
+void fill_analytic_columns(double N0, double lambda, SimulationResults* results,
+                           int first_row, int end_row);
+
+/**
+ * Mengisi baris global [first_row, end_row) dengan evaluasi langsung N₀ * r^i
+ * ke indeks 0.. kontainer tujuan (lihat dokumentasi di simulation.c).
+ */
+void decay_direct_fill(
+    IntegratorMethod method, double N0, double lambda,
+    double t_initial, double delta_t,
+    SimulationResults* results, int first_row, int end_row
+);
+
+/**
+ * FUNGSI UTAMA UNTUK SIMULASI PELURUHAN RADIOAKTIF
+ * ================================================
+ *
+ * Mengalokasikan kontainer results (tata letak mengikuti results->layout)
+ * tepat sebesar euler_step_count() + 1 baris dan mengisinya dengan hasil
+ * simulasi. Baris yang terisi adalah indeks 0 hingga nilai kembali
+ * (inklusif), tercatat juga di results->num_rows.
+ *
+ * @param N0                  - Jumlah atom awal
+ * @param lambda              - Konstanta peluruhan (s⁻¹)
+ * @param t_initial           - Waktu awal simulasi (s)
+ * @param t_final             - Waktu akhir simulasi (s)
+ * @param delta_t             - Ukuran step waktu (s)
+ * @param method              - Metode integrasi (lihat integrator.h)
+ * @param mode                - Mode evaluasi (sekuensial atau langsung)
+ * @param results             - Kontainer hasil (dibuat dengan results_empty)
+ *
+ * @return int - Jumlah step simulasi yang berhasil dilakukan
+ */
+int decay_simulate(
+    double N0, double lambda,
+    double t_initial, double t_final, double delta_t,
+    IntegratorMethod method, EulerEvaluationMode mode,
+    SimulationResults* results
+);
+
+/**
+ * Bagian integrasi dari decay_simulate(): kontainer dialokasikan dan hanya
+ * kolom waktu dan N numerik yang diisi; kolom analitik dan error belum
+ * terisi (lihat fill_analytic_columns()). Dipakai untuk mengukur kernel
+ * terpisah dari evaluasi solusi analitik.
+ *
+ * @return int - Jumlah step simulasi yang berhasil dilakukan
+ */
+int decay_integrate(
+    double N0, double lambda,
+    double t_initial, double t_final, double delta_t,
+    IntegratorMethod method, EulerEvaluationMode mode,
+    SimulationResults* results
+);
+
+/**
+ * decay_simulate() dengan metode Euler.
+ */
+int euler_radioactive_decay(
+    double N0, double lambda,
+    double t_initial, double t_final, double delta_t,
+    SimulationResults* results, EulerEvaluationMode mode
+);
+
+/**
+ * SINK UNTUK MODE STREAMING
+ * =========================
+ *
+ * Fungsi consume dipanggil sekali per chunk dengan kontainer berisi
+ * chunk->num_rows baris; first_row adalah indeks global baris pertama chunk.
+ * Isi chunk hanya valid selama pemanggilan (chunk berikutnya menimpanya).
+ *
+ * @return int - 1 jika berhasil, 0 untuk menghentikan simulasi
+ */
+typedef int (*ResultSinkFn)(void* context, const SimulationResults* chunk, int first_row);
+
+typedef struct {
+    ResultSinkFn consume;
+    void* context;
+} ResultSink;
+
+// Jumlah baris per chunk streaming (4096 * 40 byte = 160 KiB, muat di cache L2).
+// Kelipatan lebar vektor vexp (8) agar pembagian lane sama dengan mode penuh.
+#define STREAM_CHUNK_ROWS 4096
+
+/**
+ * Mode streaming dari decay_simulate: hasil tidak pernah disimpan penuh,
+ * melainkan dikirim per chunk ke sinks[0..num_sinks-1] secara berurutan.
+ *
+ * @return int - Jumlah step simulasi, atau 0 jika gagal
+ */
+int decay_simulate_stream(
+    double N0, double lambda,
+    double t_initial, double t_final, double delta_t,
+    IntegratorMethod method, EulerEvaluationMode mode, ResultLayout layout,
+    const ResultSink* sinks, int num_sinks
+);
+
+/**
+ * decay_simulate_stream() dengan metode Euler.
+ */
+int euler_radioactive_decay_stream(
+    double N0, double lambda,
+    double t_initial, double t_final, double delta_t,
+    EulerEvaluationMode mode, ResultLayout layout,
+    const ResultSink* sinks, int num_sinks
+);
+
+/**
+ * SIMULASI DENGAN STEP ADAPTIF
+ * ============================
+ *
+ * Integrasi Dormand-Prince 5(4) dengan kontrol step (lihat AdaptiveControl di
+ * integrator.h) dari t_initial tepat hingga t_final. Kolom time_s berisi grid
+ * waktu variabel hasil pengontrol; kolom analitik dan error dihitung pada
+ * waktu tersebut seperti mode step tetap.
+ *
+ * Jumlah step tidak diketahui di depan, sehingga decay_adaptive_step_count()
+ * menjalankan pengontrol sekali tanpa menyimpan baris (hanya skalar), lalu
+ * kontainer dialokasikan tepat dan pengontrol dijalankan ulang secara
+ * deterministik. Mode streaming tidak memerlukan hitungan awal.
+ *
+ * @param stats               - Keluaran statistik pengontrol (boleh NULL)
+ *
+ * @return int - Jumlah step yang diterima, atau 0 jika gagal
+ */
+int decay_adaptive_step_count(
+    double N0, double lambda,
+    double t_initial, double t_final,
+    const AdaptiveControl* control, AdaptiveStats* stats
+);
+
+int decay_simulate_adaptive(
+    double N0, double lambda,
+    double t_initial, double t_final,
+    const AdaptiveControl* control,
+    SimulationResults* results, AdaptiveStats* stats
+);
+
+int decay_simulate_adaptive_stream(
+    double N0, double lambda,
+    double t_initial, double t_final,
+    const AdaptiveControl* control, ResultLayout layout,
+    const ResultSink* sinks, int num_sinks, AdaptiveStats* stats
+);
+
+/**
+ * REDUKTOR ERROR ONLINE
+ * =====================
+ *
+ * Sink yang menghitung statistik error tanpa menyimpan baris: baris terakhir
+ * (error akhir), error absolut/relatif maksimum, dan jumlah error relatif
+ * (untuk rata-rata).
+ */
+typedef struct {
+    int num_rows;
+    SimulationStep last_row;
+    double max_error_absolute;
+    double max_error_relative_percent;
+    double sum_error_relative_percent;
+} ErrorReducer;
+
+void error_reducer_init(ErrorReducer* reducer);
+
+/**
+ * Fungsi sink untuk ErrorReducer (context = ErrorReducer*).
+ */
+int error_reducer_consume(void* context, const SimulationResults* chunk, int first_row);
+
+#endif // SIMULATION_H
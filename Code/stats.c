@@ -0,0 +1,97 @@
+/**
+ * ========================================================================
+ * IMPLEMENTASI INSTRUMENTASI RUN
+ * ========================================================================
+ *
+ * Lihat stats.h untuk deskripsi fase dan counter.
+ */
+
+#include "stats.h"
+
+#include <stdio.h>
+#include <time.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+_Thread_local RunStats* stats_active_run = NULL;
+
+static const char* const phase_names[STATS_PHASE_COUNT] = {
+    "allocation", "integration", "analytic", "report", "csv", "binary"
+};
+
+static const char* const counter_names[STATS_COUNTER_COUNT] = {
+    "steps", "allocations", "bytes_allocated", "reallocations", "bytes_written", "exp_calls"
+};
+
+double stats_now(void) {
+#ifdef _WIN32
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+#endif
+}
+
+void run_stats_init(RunStats* stats) {
+    *stats = (RunStats){ 0 };
+}
+
+RunStats* stats_attach(RunStats* stats) {
+    RunStats* previous = stats_active_run;
+    stats_active_run = stats;
+    return previous;
+}
+
+void run_stats_merge(RunStats* total, const RunStats* stats) {
+    total->wall_seconds += stats->wall_seconds;
+    for (int p = 0; p < STATS_PHASE_COUNT; p++) {
+        total->phase_seconds[p] += stats->phase_seconds[p];
+        total->phase_calls[p] += stats->phase_calls[p];
+    }
+    for (int c = 0; c < STATS_COUNTER_COUNT; c++) {
+        total->counters[c] += stats->counters[c];
+    }
+}
+
+const char* stats_phase_name(StatsPhase phase) {
+    return (phase >= 0 && phase < STATS_PHASE_COUNT) ? phase_names[phase] : "unknown";
+}
+
+const char* stats_counter_name(StatsCounter counter) {
+    return (counter >= 0 && counter < STATS_COUNTER_COUNT) ? counter_names[counter] : "unknown";
+}
+
+double run_stats_other_seconds(const RunStats* stats) {
+    double other = stats->wall_seconds;
+    for (int p = 0; p < STATS_PHASE_COUNT; p++) other -= stats->phase_seconds[p];
+    return (other > 0.0) ? other : 0.0;
+}
+
+int run_stats_write_json(const char* filename, const char* method, double delta_t,
+                         const RunStats* stats) {
+    FILE* fp = fopen(filename, "w");
+    if (fp == NULL) return 0;
+
+    // Nama metode berasal dari tabel integrator (tanpa karakter yang perlu escape)
+    fprintf(fp, "{\n  \"method\": \"%s\",\n  \"delta_t_s\": %.17g,\n  \"wall_seconds\": %.9e,\n",
+            method, delta_t, stats->wall_seconds);
+    fprintf(fp, "  \"phases\": {\n");
+    for (int p = 0; p < STATS_PHASE_COUNT; p++) {
+        fprintf(fp, "    \"%s\": {\"seconds\": %.9e, \"calls\": %lld},\n",
+                stats_phase_name((StatsPhase)p), stats->phase_seconds[p], stats->phase_calls[p]);
+    }
+    fprintf(fp, "    \"other\": {\"seconds\": %.9e}\n  },\n", run_stats_other_seconds(stats));
+    fprintf(fp, "  \"counters\": {\n");
+    for (int c = 0; c < STATS_COUNTER_COUNT; c++) {
+        fprintf(fp, "    \"%s\": %lld%s\n", stats_counter_name((StatsCounter)c), stats->counters[c],
+                (c + 1 < STATS_COUNTER_COUNT) ? "," : "");
+    }
+    fprintf(fp, "  }\n}\n");
+    return fclose(fp) == 0;
+}
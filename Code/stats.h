@@ -0,0 +1,128 @@
+/**
+ * ========================================================================
+ * MODUL INSTRUMENTASI RUN: TIMER FASE DAN COUNTER
+ * ========================================================================
+ *
+ * Untuk melihat ke mana waktu satu kasus habis tanpa profiler eksternal,
+ * kernel dan penulis keluaran mencatat waktu fase (jam monotonik) dan
+ * counter ke RunStats milik thread yang sedang menjalankan kasus:
+ *
+ *   - fase: alokasi kontainer, integrasi (loop step), evaluasi analitik dan
+ *     error, pelaporan konsol, ekspor CSV, dan ekspor biner;
+ *   - counter: step, alokasi kontainer dan byte-nya, realloc buffer, byte
+ *     yang ditulis ke file, dan evaluasi exp solusi analitik.
+ *
+ * Pencatatan dilakukan per pemanggilan kernel atau per chunk (bukan per
+ * step), sehingga overhead-nya dua pembacaan jam per chunk saat aktif dan
+ * satu pemeriksaan pointer saat tidak aktif. RunStats dipasang per thread
+ * (stats_attach), sehingga kasus sweep yang berjalan paralel tidak saling
+ * menimpa counter dan tidak memerlukan atomik.
+ */
+
+#ifndef STATS_H
+#define STATS_H
+
+#include <stddef.h>
+
+typedef enum {
+    STATS_PHASE_ALLOCATION = 0,       // Alokasi kontainer hasil
+    STATS_PHASE_INTEGRATION,          // Loop step (kolom waktu dan N numerik)
+    STATS_PHASE_ANALYTIC,             // Solusi analitik dan kolom error
+    STATS_PHASE_REPORT,               // Tabel dan statistik konsol
+    STATS_PHASE_CSV,                  // Ekspor CSV
+    STATS_PHASE_BINARY,               // Ekspor biner kolumnar
+    STATS_PHASE_COUNT
+} StatsPhase;
+
+typedef enum {
+    STATS_COUNTER_STEPS = 0,          // Step simulasi
+    STATS_COUNTER_ALLOCATIONS,        // Blok kontainer hasil yang dialokasikan
+    STATS_COUNTER_BYTES_ALLOCATED,    // Byte blok kontainer hasil
+    STATS_COUNTER_REALLOCATIONS,      // Pertumbuhan buffer dengan realloc
+    STATS_COUNTER_BYTES_WRITTEN,      // Byte yang ditulis ke file CSV dan biner
+    STATS_COUNTER_EXP_CALLS,          // Evaluasi exp untuk solusi analitik
+    STATS_COUNTER_COUNT
+} StatsCounter;
+
+/**
+ * STATISTIK SATU RUN
+ * ==================
+ */
+typedef struct {
+    double wall_seconds;                          // Waktu total kasus (diisi pemanggil)
+    double phase_seconds[STATS_PHASE_COUNT];
+    long long phase_calls[STATS_PHASE_COUNT];
+    long long counters[STATS_COUNTER_COUNT];
+} RunStats;
+
+// RunStats aktif untuk thread ini (NULL = instrumentasi mati)
+extern _Thread_local RunStats* stats_active_run;
+
+/**
+ * Waktu monotonik dalam detik (titik nol sembarang).
+ */
+double stats_now(void);
+
+void run_stats_init(RunStats* stats);
+
+/**
+ * Memasang stats sebagai tujuan pencatatan thread ini (NULL untuk melepas).
+ *
+ * @return RunStats* - RunStats yang sebelumnya terpasang
+ */
+RunStats* stats_attach(RunStats* stats);
+
+/**
+ * Menambahkan seluruh waktu dan counter `stats` ke `total`.
+ */
+void run_stats_merge(RunStats* total, const RunStats* stats);
+
+/**
+ * Nama fase dan counter untuk JSON ("allocation", "exp_calls", ...).
+ */
+const char* stats_phase_name(StatsPhase phase);
+const char* stats_counter_name(StatsCounter counter);
+
+/**
+ * Waktu fase yang tidak tercakup fase mana pun (wall - jumlah fase, >= 0).
+ */
+double run_stats_other_seconds(const RunStats* stats);
+
+/**
+ * Menulis statistik satu kasus ke file JSON:
+ * { "method", "delta_t_s", "wall_seconds", "phases": { nama: { "seconds",
+ * "calls" } }, "counters": { nama: nilai } }
+ *
+ * @return int - 1 jika berhasil, 0 jika file gagal ditulis
+ */
+int run_stats_write_json(const char* filename, const char* method, double delta_t,
+                         const RunStats* stats);
+
+/**
+ * PENCATATAN DI JALUR PANAS
+ * =========================
+ *
+ *   double start = stats_phase_begin();
+ *   ... kerja ...
+ *   stats_phase_end(STATS_PHASE_INTEGRATION, start);
+ *
+ * Fase tidak boleh bersarang (waktunya akan terhitung dua kali).
+ */
+static inline double stats_phase_begin(void) {
+    return (stats_active_run != NULL) ? stats_now() : 0.0;
+}
+
+static inline void stats_phase_end(StatsPhase phase, double start) {
+    RunStats* stats = stats_active_run;
+    if (stats != NULL) {
+        stats->phase_seconds[phase] += stats_now() - start;
+        stats->phase_calls[phase]++;
+    }
+}
+
+static inline void stats_count(StatsCounter counter, long long amount) {
+    RunStats* stats = stats_active_run;
+    if (stats != NULL) stats->counters[counter] += amount;
+}
+
+#endif // STATS_H
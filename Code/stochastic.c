@@ -0,0 +1,340 @@
+/**
+ * ========================================================================
+ * IMPLEMENTASI SIMULASI PELURUHAN STOKASTIK
+ * ========================================================================
+ *
+ * Lihat stochastic.h untuk model, sampler, dan skema reproduktibilitas.
+ */
+
+#include "stochastic.h"
+#include "simulation.h"
+#include "task_pool.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * PHILOX4x32-10
+ * =============
+ * Satu ronde: dua perkalian 32x32 -> 64 bit, lalu XOR bagian atas dengan
+ * word counter lain dan key. Key ditambah konstanta Weyl di antara ronde.
+ */
+#define PHILOX_M0 0xD2511F53u
+#define PHILOX_M1 0xCD9E8D57u
+#define PHILOX_W0 0x9E3779B9u
+#define PHILOX_W1 0xBB67AE85u
+
+static inline void philox_round(uint32_t counter[4], const uint32_t key[2]) {
+    uint64_t product0 = (uint64_t)PHILOX_M0 * counter[0];
+    uint64_t product1 = (uint64_t)PHILOX_M1 * counter[2];
+    uint32_t next[4] = {
+        (uint32_t)(product1 >> 32) ^ counter[1] ^ key[0],
+        (uint32_t)product1,
+        (uint32_t)(product0 >> 32) ^ counter[3] ^ key[1],
+        (uint32_t)product0
+    };
+    memcpy(counter, next, sizeof(next));
+}
+
+void philox4x32_10(const uint32_t counter[4], const uint32_t key[2], uint32_t output[4]) {
+    uint32_t state[4] = { counter[0], counter[1], counter[2], counter[3] };
+    uint32_t round_key[2] = { key[0], key[1] };
+    for (int round = 0; round < 10; round++) {
+        if (round > 0) {
+            round_key[0] += PHILOX_W0;
+            round_key[1] += PHILOX_W1;
+        }
+        philox_round(state, round_key);
+    }
+    memcpy(output, state, sizeof(state));
+}
+
+void rng_stream_init(RngStream* stream, uint64_t seed, uint64_t stream_id) {
+    stream->key[0] = (uint32_t)seed;
+    stream->key[1] = (uint32_t)(seed >> 32);
+    stream->counter[0] = 0;
+    stream->counter[1] = 0;
+    stream->counter[2] = (uint32_t)stream_id;
+    stream->counter[3] = (uint32_t)(stream_id >> 32);
+    stream->available = 0;
+}
+
+static inline uint32_t rng_next_word(RngStream* stream) {
+    if (stream->available == 0) {
+        philox4x32_10(stream->counter, stream->key, stream->buffer);
+        // Indeks blok 64-bit di counter[0..1]
+        if (++stream->counter[0] == 0) stream->counter[1]++;
+        stream->available = 4;
+    }
+    return stream->buffer[4 - stream->available--];
+}
+
+double rng_uniform(RngStream* stream) {
+    uint32_t high = rng_next_word(stream) >> 5;   // 27 bit
+    uint32_t low = rng_next_word(stream) >> 6;    // 26 bit
+    return ((double)high * 67108864.0 + (double)low + 0.5) * (1.0 / 9007199254740992.0);
+}
+
+double rng_normal(RngStream* stream) {
+    double radius = sqrt(-2.0 * log(rng_uniform(stream)));
+    return radius * cos(6.283185307179586 * rng_uniform(stream));
+}
+
+/**
+ * SAMPLER BINOMIAL
+ * ================
+ */
+
+// Koreksi Stirling: lgamma(k + 1) - [(k + 1/2) ln(k + 1) - (k + 1) + ln(2π)/2]
+static double stirling_tail(double k) {
+    static const double table[10] = {
+        0.08106146679532733, 0.041340695955409457, 0.027677925684997717,
+        0.020790672103765839, 0.016644691189821259, 0.013876128823072875,
+        0.011896709945893313, 0.010411265261973668, 0.0092554621827094508,
+        0.0083305634333594725
+    };
+    if (k <= 9.0) return table[(int)k];
+    double inverse_square = 1.0 / ((k + 1.0) * (k + 1.0));
+    return (1.0 / 12.0 - (1.0 / 360.0 - (1.0 / 1260.0) * inverse_square) * inverse_square) / (k + 1.0);
+}
+
+// Inversi untuk np < 10: P(0) = q^n, P(k+1) = P(k) (n - k) / (k + 1) * p / q
+static double binomial_inversion(RngStream* stream, double n, double p) {
+    double q = 1.0 - p;
+    double ratio = p / q;
+    double p_zero = exp(n * log1p(-p));
+    for (;;) {
+        double u = rng_uniform(stream);
+        double probability = p_zero;
+        double k = 0.0;
+        while (u > probability && k < n) {
+            u -= probability;
+            probability *= (n - k) / (k + 1.0) * ratio;
+            k += 1.0;
+        }
+        // Sisa pembulatan di ekor: ulangi dengan u baru
+        if (u <= probability) return k;
+    }
+}
+
+/**
+ * BTRS (Hörmann 1993, "The generation of binomial random variates"):
+ * transformed rejection dengan squeeze, rata-rata ~1.15 iterasi. Uji terima
+ * ln f(k)/f(m) ditulis dalam bentuk selisih Stirling dengan log1p agar
+ * tetap akurat untuk n ~ 10^15 (lgamma(n) ~ 3·10^16 akan kehilangan seluruh
+ * digit pecahan pada pengurangan langsung).
+ */
+static double binomial_btrs(RngStream* stream, double n, double p) {
+    double q = 1.0 - p;
+    double spq = sqrt(n * p * q);
+    double b = 1.15 + 2.53 * spq;
+    double a = -0.0873 + 0.0248 * b + 0.01 * p;
+    double c = n * p + 0.5;
+    double v_r = 0.92 - 4.2 / b;
+    double alpha = (2.83 + 5.1 / b) * spq;
+    double m = floor((n + 1.0) * p);
+    double tail_m = stirling_tail(m) + stirling_tail(n - m);
+
+    for (;;) {
+        double u = rng_uniform(stream) - 0.5;
+        double v = rng_uniform(stream);
+        double us = 0.5 - fabs(u);
+        double k = floor((2.0 * a / us + b) * u + c);
+        if (k < 0.0 || k > n) continue;
+        if (us >= 0.07 && v <= v_r) return k;
+
+        v = log(v * alpha / (a / (us * us) + b));
+        double log_ratio = (m + 0.5) * log1p((m - k) / (k + 1.0))
+                         + (n - m + 0.5) * log1p((k - m) / (n - k + 1.0))
+                         + (k - m) * log(((n - k + 1.0) * p) / ((k + 1.0) * q))
+                         + tail_m - stirling_tail(k) - stirling_tail(n - k);
+        if (v <= log_ratio) return k;
+    }
+}
+
+double rng_binomial(RngStream* stream, double n, double p) {
+    if (n <= 0.0 || p <= 0.0) return 0.0;
+    if (p >= 1.0) return n;
+    if (p > 0.5) return n - rng_binomial(stream, n, 1.0 - p);
+    if (n * p < 10.0) return binomial_inversion(stream, n, p);
+    return binomial_btrs(stream, n, p);
+}
+
+/**
+ * ENSEMBLE PARALEL
+ * ================
+ */
+
+// Batas blok trajektori dan memori jumlah parsial (2 double per baris per blok)
+#define STOCHASTIC_MIN_BLOCK 256
+#define STOCHASTIC_MAX_BLOCKS 1024
+#define STOCHASTIC_MAX_PARTIAL_BYTES ((size_t)256 << 20)
+
+typedef struct {
+    const StochasticConfig* config;
+    double N0;
+    double p;                         // Peluang meluruh per step, 1 - e^{-λΔt}
+    double h;
+    int num_rows;
+    long long block_size;
+    const double* expected;           // E[N] per baris
+    double* partial;                  // [blok][Σd (num_rows), Σd² (num_rows)]
+    double* N_sample;                 // Diisi oleh trajektori 0
+} EnsembleContext;
+
+// Satu step Gillespie: peluruhan satu per satu selama h (waktu tunggu Exp(λN))
+static double gillespie_advance(RngStream* stream, double N, double lambda, double h) {
+    double elapsed = 0.0;
+    while (N > 0.0) {
+        elapsed += -log(rng_uniform(stream)) / (lambda * N);
+        if (elapsed > h) break;
+        N -= 1.0;
+    }
+    return N;
+}
+
+static void ensemble_block(void* context, int block) {
+    EnsembleContext* ensemble = (EnsembleContext*)context;
+    const StochasticConfig* config = ensemble->config;
+    int rows = ensemble->num_rows;
+    double* sum = ensemble->partial + (size_t)block * 2 * (size_t)rows;
+    double* sum_squares = sum + rows;
+    memset(sum, 0, 2 * (size_t)rows * sizeof(double));
+
+    long long first = (long long)block * ensemble->block_size;
+    long long last = first + ensemble->block_size;
+    if (last > config->num_trajectories) last = config->num_trajectories;
+
+    for (long long trajectory = first; trajectory < last; trajectory++) {
+        RngStream stream;
+        rng_stream_init(&stream, config->seed, (uint64_t)trajectory);
+        double N = ensemble->N0;
+
+        for (int row = 0; row < rows; row++) {
+            double deviation = N - ensemble->expected[row];
+            sum[row] += deviation;
+            sum_squares[row] += deviation * deviation;
+            if (trajectory == 0) ensemble->N_sample[row] = N;
+            if (row + 1 == rows) break;
+
+            if (config->sampler == STOCHASTIC_GILLESPIE) {
+                N = gillespie_advance(&stream, N, config->lambda, ensemble->h);
+            } else {
+                N -= rng_binomial(&stream, N, ensemble->p);
+            }
+        }
+    }
+}
+
+void stochastic_results_free(StochasticResults* results) {
+    simulation_block_free(results->block);
+    memset(results, 0, sizeof(*results));
+}
+
+static int stochastic_results_allocate(StochasticResults* results, int num_rows) {
+    memset(results, 0, sizeof(*results));
+    size_t column_bytes = ((size_t)num_rows * sizeof(double) + RESULTS_CACHE_LINE - 1)
+                          / RESULTS_CACHE_LINE * RESULTS_CACHE_LINE;
+    char* base = (char*)simulation_block_alloc(6 * column_bytes, &results->bytes_allocated);
+    if (base == NULL) return 0;
+
+    results->block = base;
+    results->time_s = (double*)(base + 0 * column_bytes);
+    results->N_mean = (double*)(base + 1 * column_bytes);
+    results->N_variance = (double*)(base + 2 * column_bytes);
+    results->N_analytical = (double*)(base + 3 * column_bytes);
+    results->variance_analytical = (double*)(base + 4 * column_bytes);
+    results->N_sample = (double*)(base + 5 * column_bytes);
+    results->num_rows = num_rows;
+    return 1;
+}
+
+int stochastic_simulate(const StochasticConfig* config, StochasticResults* results) {
+    double N0 = floor(config->N0 + 0.5);
+    if (config->delta_t <= 0.0 || !(config->lambda > 0.0) || config->num_trajectories < 1) {
+        printf("Error: Konfigurasi stokastik tidak valid (delta_t, lambda, dan jumlah trajektori harus positif).\n");
+        return 0;
+    }
+    if (!(N0 >= 0.0 && N0 <= STOCHASTIC_MAX_N0)) {
+        printf("Error: N0 stokastik harus di 0..%.0f.\n", STOCHASTIC_MAX_N0);
+        return 0;
+    }
+    if (config->sampler == STOCHASTIC_GILLESPIE && N0 > STOCHASTIC_GILLESPIE_MAX_N0) {
+        printf("Error: Sampler Gillespie hanya untuk N0 <= %.0e (biaya sebanding dengan jumlah peluruhan).\n",
+               STOCHASTIC_GILLESPIE_MAX_N0);
+        return 0;
+    }
+
+    int num_steps = euler_step_count(config->t_initial, config->t_final, config->delta_t);
+    int rows = num_steps + 1;
+    if (!stochastic_results_allocate(results, rows)) {
+        printf("Error: Gagal mengalokasikan memori untuk hasil stokastik.\n");
+        return 0;
+    }
+    results->num_trajectories = config->num_trajectories;
+
+    // Grid waktu dan momen analitik
+    double current_t = config->t_initial;
+    for (int row = 0; row < rows; row++) {
+        double tau = current_t - config->t_initial;
+        double survival = exp(-config->lambda * tau);
+        results->time_s[row] = current_t;
+        results->N_analytical[row] = N0 * survival;
+        results->variance_analytical[row] = N0 * survival * -expm1(-config->lambda * tau);
+        current_t = current_t + config->delta_t;
+    }
+
+    // Ukuran blok hanya bergantung pada M dan jumlah baris (bukan jumlah
+    // thread) agar urutan penjumlahan, dan karenanya hasilnya, tetap
+    long long M = config->num_trajectories;
+    long long max_blocks = (long long)(STOCHASTIC_MAX_PARTIAL_BYTES / (2 * (size_t)rows * sizeof(double)));
+    if (max_blocks > STOCHASTIC_MAX_BLOCKS) max_blocks = STOCHASTIC_MAX_BLOCKS;
+    if (max_blocks < 1) max_blocks = 1;
+    long long block_size = (M + max_blocks - 1) / max_blocks;
+    if (block_size < STOCHASTIC_MIN_BLOCK) block_size = STOCHASTIC_MIN_BLOCK;
+    int num_blocks = (int)((M + block_size - 1) / block_size);
+
+    EnsembleContext ensemble = {
+        config, N0, -expm1(-config->lambda * config->delta_t), config->delta_t, rows, block_size,
+        results->N_analytical, NULL, results->N_sample
+    };
+    ensemble.partial = (double*)malloc((size_t)num_blocks * 2 * (size_t)rows * sizeof(double));
+    if (ensemble.partial == NULL) {
+        printf("Error: Gagal mengalokasikan memori untuk jumlah parsial ensemble.\n");
+        stochastic_results_free(results);
+        return 0;
+    }
+
+    TaskPool pool;
+    int parallel = 0;
+    if (config->num_threads > 1 && num_blocks > 1) {
+        parallel = task_pool_start(&pool, num_blocks, config->num_threads, ensemble_block, &ensemble);
+        // Tidak ada pekerja yang berjalan: blok dijalankan di thread utama
+        if (!parallel) task_pool_finish(&pool);
+    }
+    if (parallel) {
+        task_pool_finish(&pool);
+    } else {
+        for (int block = 0; block < num_blocks; block++) ensemble_block(&ensemble, block);
+    }
+
+    // Reduksi blok dalam urutan indeks
+    for (int row = 0; row < rows; row++) {
+        double sum = 0.0, sum_squares = 0.0;
+        for (int block = 0; block < num_blocks; block++) {
+            const double* partial = ensemble.partial + (size_t)block * 2 * (size_t)rows;
+            sum += partial[row];
+            sum_squares += partial[rows + row];
+        }
+        double mean_deviation = sum / (double)M;
+        results->N_mean[row] = results->N_analytical[row] + mean_deviation;
+        results->N_variance[row] = (M > 1)
+            ? fmax(0.0, (sum_squares - sum * mean_deviation) / (double)(M - 1))
+            : 0.0;
+    }
+
+    free(ensemble.partial);
+    return num_steps;
+}
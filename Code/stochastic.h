@@ -0,0 +1,145 @@
+/**
+ * ========================================================================
+ * MODUL SIMULASI PELURUHAN STOKASTIK (MONTE CARLO)
+ * ========================================================================
+ *
+ * Model deterministik dN/dt = -λN hanya memberi nilai harapan. Pada jumlah
+ * atom kecil, fluktuasi statistik cacahan menjadi dominan: setiap atom
+ * meluruh independen dengan peluang p = 1 - e^{-λΔt} per step, sehingga
+ *
+ *   N_{i+1} = N_i - K_i,   K_i ~ Binomial(N_i, p)
+ *
+ * dengan E[N(t)] = N0 e^{-λt} dan Var[N(t)] = N0 e^{-λt} (1 - e^{-λt})
+ * untuk Δt berapa pun (tidak ada error diskretisasi). Dua sampler:
+ *
+ *   binomial  : satu sampel binomial per step (BTRS, Hörmann 1993, untuk
+ *               Np >= 10; inversi untuk Np kecil), biaya O(1) per step
+ *   gillespie : simulasi event-per-event (waktu tunggu Exp(λN) hingga
+ *               peluruhan berikutnya), eksak dan biayanya O(N0) per
+ *               trajektori; hanya untuk N0 kecil
+ *
+ * Ensemble banyak trajektori dijalankan paralel dengan pool thread. Setiap
+ * trajektori memakai aliran bilangan acak sendiri dari generator
+ * counter-based Philox4x32-10 (Salmon dkk., SC'11): keluaran adalah fungsi
+ * murni dari (seed, id trajektori, indeks draw), sehingga hasil ensemble
+ * identik bit-per-bit berapa pun jumlah thread dan urutan eksekusinya.
+ */
+
+#ifndef STOCHASTIC_H
+#define STOCHASTIC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Batas N0 untuk sampler Gillespie (biaya sebanding dengan jumlah peluruhan)
+#define STOCHASTIC_GILLESPIE_MAX_N0 1.0e6
+
+// Batas N0 (bilangan bulat harus eksak dalam double)
+#define STOCHASTIC_MAX_N0 9007199254740992.0
+
+// Seed default (--seed)
+#define STOCHASTIC_DEFAULT_SEED 1ULL
+
+/**
+ * GENERATOR PHILOX4x32-10
+ * =======================
+ *
+ * Satu pemanggilan memetakan counter 128-bit dan key 64-bit ke empat
+ * bilangan 32-bit (10 ronde). Nilai uji dari Random123 diperiksa oleh
+ * program uji test.c (ctest verify).
+ */
+void philox4x32_10(const uint32_t counter[4], const uint32_t key[2], uint32_t output[4]);
+
+/**
+ * ALIRAN BILANGAN ACAK SATU TRAJEKTORI
+ *
+ * key = seed, counter = (indeks blok 64-bit, id aliran 64-bit).
+ */
+typedef struct {
+    uint32_t key[2];
+    uint32_t counter[4];
+    uint32_t buffer[4];
+    int available;                    // Jumlah word di buffer yang belum dipakai
+} RngStream;
+
+void rng_stream_init(RngStream* stream, uint64_t seed, uint64_t stream_id);
+
+/**
+ * Bilangan uniform di (0, 1) dengan resolusi 2^-53 (dua word 32-bit).
+ */
+double rng_uniform(RngStream* stream);
+
+/**
+ * Sampel normal baku (Box-Muller, dua bilangan uniform per sampel).
+ */
+double rng_normal(RngStream* stream);
+
+/**
+ * Sampel Binomial(n, p). n harus bilangan bulat 0..STOCHASTIC_MAX_N0
+ * (disimpan sebagai double agar N0 = 10^15 muat), 0 <= p <= 1.
+ */
+double rng_binomial(RngStream* stream, double n, double p);
+
+/**
+ * SAMPLER DAN KONFIGURASI ENSEMBLE
+ */
+typedef enum {
+    STOCHASTIC_BINOMIAL = 0,
+    STOCHASTIC_GILLESPIE = 1
+} StochasticSampler;
+
+typedef struct {
+    double N0;                        // Dibulatkan ke bilangan bulat terdekat
+    double lambda;
+    double t_initial;
+    double t_final;
+    double delta_t;
+    long long num_trajectories;
+    uint64_t seed;
+    StochasticSampler sampler;
+    int num_threads;
+} StochasticConfig;
+
+/**
+ * HASIL ENSEMBLE (SoA, satu blok teralokasi)
+ * ==========================================
+ *
+ * Per baris waktu: mean dan variansi sampel (pembagi M - 1) dari M
+ * trajektori, nilai harapan dan variansi analitik, serta trajektori ke-0
+ * sebagai contoh satu realisasi.
+ */
+typedef struct {
+    int num_rows;
+    long long num_trajectories;
+
+    void* block;
+    size_t bytes_allocated;
+
+    double* time_s;
+    double* N_mean;
+    double* N_variance;
+    double* N_analytical;
+    double* variance_analytical;
+    double* N_sample;
+} StochasticResults;
+
+void stochastic_results_free(StochasticResults* results);
+
+/**
+ * MENJALANKAN ENSEMBLE
+ * ====================
+ *
+ * Trajektori dibagi ke blok dengan ukuran yang tidak bergantung pada jumlah
+ * thread; setiap blok menjumlahkan d = N - E[N] dan d² per baris, lalu blok
+ * dijumlahkan dalam urutan indeks. Memakai simpangan terhadap nilai harapan
+ * (orde √N) menghindari pembatalan Σ N² - (Σ N)² / M pada N ~ 10^15.
+ *
+ * Grid waktu sama dengan simulasi deterministik (euler_step_count dan
+ * t + Δt berulang).
+ *
+ * @return int - Jumlah step, atau 0 jika konfigurasi tidak valid atau
+ *               alokasi gagal
+ */
+int stochastic_simulate(const StochasticConfig* config, StochasticResults* results);
+
+#endif // STOCHASTIC_H
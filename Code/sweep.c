@@ -0,0 +1,257 @@
+/**
+ * ========================================================================
+ * IMPLEMENTASI SPESIFIKASI SWEEP DELTA_T DAN TABEL RINGKASAN
+ * ========================================================================
+ *
+ * Lihat sweep.h untuk sintaks spesifikasi.
+ */
+
+#include "sweep.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+
+void sweep_values_init(SweepValues* sweep) {
+    sweep->values = NULL;
+    sweep->count = 0;
+    sweep->capacity = 0;
+}
+
+void sweep_values_free(SweepValues* sweep) {
+    free(sweep->values);
+    sweep_values_init(sweep);
+}
+
+// Menambah kapasitas agar muat `additional` nilai lagi
+static int sweep_reserve(SweepValues* sweep, int additional) {
+    if (additional > SWEEP_MAX_CASES - sweep->count) {
+        printf("Error: Sweep melebihi %d kasus.\n", SWEEP_MAX_CASES);
+        return 0;
+    }
+    int needed = sweep->count + additional;
+    if (needed <= sweep->capacity) return 1;
+
+    int capacity = sweep->capacity ? sweep->capacity : 16;
+    while (capacity < needed) capacity = (capacity > SWEEP_MAX_CASES / 2) ? SWEEP_MAX_CASES : capacity * 2;
+    double* values = (double*)realloc(sweep->values, (size_t)capacity * sizeof(double));
+    if (values == NULL) {
+        printf("Error: Gagal mengalokasikan memori untuk sweep.\n");
+        return 0;
+    }
+    sweep->values = values;
+    sweep->capacity = capacity;
+    return 1;
+}
+
+/**
+ * PARSING TOKEN
+ * =============
+ */
+
+// Membuang spasi di awal dan akhir (in-place)
+static char* trim(char* text) {
+    while (isspace((unsigned char)*text)) text++;
+    char* end = text + strlen(text);
+    while (end > text && isspace((unsigned char)end[-1])) *--end = '\0';
+    return text;
+}
+
+// Angka desimal penuh (seluruh token harus terpakai)
+static int parse_number(const char* text, double* value) {
+    char* end;
+    *value = strtod(text, &end);
+    return end != text && *end == '\0';
+}
+
+// Nilai delta_t: detik, T, T/x, atau T*x; harus positif dan berhingga
+static int parse_time_value(char* token, double T_half, double* value) {
+    char* text = trim(token);
+    int ok;
+
+    if (text[0] == 'T') {
+        char* operand = trim(text + 1);
+        double factor;
+        if (*operand == '\0') {
+            *value = T_half;
+            ok = 1;
+        } else if (*operand == '/' && parse_number(trim(operand + 1), &factor)) {
+            *value = T_half / factor;
+            ok = 1;
+        } else if (*operand == '*' && parse_number(trim(operand + 1), &factor)) {
+            *value = T_half * factor;
+            ok = 1;
+        } else {
+            ok = 0;
+        }
+    } else {
+        ok = parse_number(text, value);
+    }
+
+    if (!ok || !isfinite(*value) || *value <= 0.0) {
+        printf("Error: Nilai waktu tidak valid: '%s' (harus > 0 detik, T/x, atau T*x).\n", text);
+        return 0;
+    }
+    return 1;
+}
+
+// Memecah range "AWAL:AKHIR:JUMLAH"
+static int parse_range(char* fields, double T_half, double* start, double* stop, int* count) {
+    char* first_colon = strchr(fields, ':');
+    char* second_colon = first_colon ? strchr(first_colon + 1, ':') : NULL;
+    if (second_colon == NULL || strchr(second_colon + 1, ':') != NULL) {
+        printf("Error: Range sweep harus berbentuk AWAL:AKHIR:JUMLAH.\n");
+        return 0;
+    }
+    *first_colon = '\0';
+    *second_colon = '\0';
+
+    if (!parse_time_value(fields, T_half, start) ||
+        !parse_time_value(first_colon + 1, T_half, stop)) {
+        return 0;
+    }
+
+    char* count_text = trim(second_colon + 1);
+    char* end;
+    long parsed = strtol(count_text, &end, 10);
+    if (end == count_text || *end != '\0' || parsed < 1 || parsed > SWEEP_MAX_CASES) {
+        printf("Error: Jumlah kasus sweep tidak valid: '%s' (1..%d).\n", count_text, SWEEP_MAX_CASES);
+        return 0;
+    }
+    *count = (int)parsed;
+    return 1;
+}
+
+// Satu spesifikasi tanpa ';' (teks dapat diubah)
+static int parse_single_spec(char* spec, double T_half, SweepValues* sweep) {
+    char* text = trim(spec);
+    if (*text == '\0') return 1;
+
+    char* colon = strchr(text, ':');
+    if (colon == NULL) {
+        printf("Error: Spesifikasi sweep tanpa jenis: '%s' (gunakan lin:, geom:, atau list:).\n", text);
+        return 0;
+    }
+    *colon = '\0';
+    char* kind = trim(text);
+    char* body = colon + 1;
+
+    if (strcmp(kind, "list") == 0) {
+        for (char* token = body; token != NULL; ) {
+            char* comma = strchr(token, ',');
+            if (comma != NULL) *comma = '\0';
+            double value;
+            if (!parse_time_value(token, T_half, &value) || !sweep_reserve(sweep, 1)) return 0;
+            sweep->values[sweep->count++] = value;
+            token = comma ? comma + 1 : NULL;
+        }
+        return 1;
+    }
+
+    int linear = strcmp(kind, "lin") == 0;
+    if (!linear && strcmp(kind, "geom") != 0) {
+        printf("Error: Jenis sweep tidak dikenal: '%s' (gunakan lin, geom, atau list).\n", kind);
+        return 0;
+    }
+
+    double start, stop;
+    int count;
+    if (!parse_range(body, T_half, &start, &stop, &count) || !sweep_reserve(sweep, count)) return 0;
+
+    // Nilai ujung selalu tepat AWAL dan AKHIR; nilai tengah dihitung dari
+    // indeks (bukan penjumlahan berulang) agar tidak ada akumulasi galat
+    double* out = sweep->values + sweep->count;
+    for (int i = 0; i < count; i++) {
+        double fraction = (count > 1) ? (double)i / (double)(count - 1) : 0.0;
+        out[i] = linear ? start + (stop - start) * fraction
+                        : start * pow(stop / start, fraction);
+    }
+    if (count > 1) out[count - 1] = stop;
+    sweep->count += count;
+    return 1;
+}
+
+int sweep_parse_spec(const char* spec, double T_half, SweepValues* sweep) {
+    size_t length = strlen(spec);
+    char* copy = (char*)malloc(length + 1);
+    if (copy == NULL) {
+        printf("Error: Gagal mengalokasikan memori untuk spesifikasi sweep.\n");
+        return 0;
+    }
+    memcpy(copy, spec, length + 1);
+
+    int ok = 1;
+    for (char* part = copy; part != NULL && ok; ) {
+        char* separator = strchr(part, ';');
+        if (separator != NULL) *separator = '\0';
+        ok = parse_single_spec(part, T_half, sweep);
+        part = separator ? separator + 1 : NULL;
+    }
+
+    free(copy);
+    return ok;
+}
+
+int sweep_load_file(const char* filename, double T_half, SweepValues* sweep) {
+    FILE* fp = fopen(filename, "r");
+    if (fp == NULL) {
+        printf("Error: Gagal membuka file sweep %s.\n", filename);
+        return 0;
+    }
+
+    char line[4096];
+    int line_number = 0;
+    int ok = 1;
+    while (ok && fgets(line, sizeof(line), fp) != NULL) {
+        line_number++;
+        size_t length = strlen(line);
+        if (length == sizeof(line) - 1 && line[length - 1] != '\n' && !feof(fp)) {
+            printf("Error: Baris %d di %s terlalu panjang (maks. %d karakter).\n",
+                   line_number, filename, (int)sizeof(line) - 2);
+            ok = 0;
+            break;
+        }
+
+        char* comment = strchr(line, '#');
+        if (comment != NULL) *comment = '\0';
+        ok = sweep_parse_spec(line, T_half, sweep);
+        if (!ok) printf("  (di %s baris %d)\n", filename, line_number);
+    }
+
+    fclose(fp);
+    return ok;
+}
+
+int sweep_parse_time(const char* text, double T_half, double* value) {
+    char token[256];
+    if (strlen(text) >= sizeof(token)) {
+        printf("Error: Nilai waktu terlalu panjang: '%.32s...'.\n", text);
+        return 0;
+    }
+    strcpy(token, text);
+    return parse_time_value(token, T_half, value);
+}
+
+/**
+ * TABEL RINGKASAN
+ * ===============
+ */
+int sweep_write_summary_csv(const char* filename, const SweepCaseSummary* summaries, int num_cases) {
+    FILE* fp = fopen(filename, "w");
+    if (fp == NULL) return 0;
+
+    int ok = fprintf(fp, "Delta_t_s,Steps,Final_Error_Absolute,"
+                         "Final_Error_Relative_Percent,Max_Error_Relative_Percent\n") > 0;
+    for (int i = 0; i < num_cases && ok; i++) {
+        const SweepCaseSummary* summary = &summaries[i];
+        // delta_t dengan 17 digit signifikan agar nilai double terbaca kembali eksak
+        ok = fprintf(fp, "%.17g,%d,%.10e,%.10e,%.10e\n",
+                     summary->delta_t, summary->steps,
+                     summary->final_error_absolute,
+                     summary->final_error_relative_percent,
+                     summary->max_error_relative_percent) > 0;
+    }
+    return (fclose(fp) == 0) && ok;
+}
@@ -0,0 +1,92 @@
+/**
+ * ========================================================================
+ * MODUL SPESIFIKASI SWEEP DELTA_T DAN TABEL RINGKASAN
+ * ========================================================================
+ *
+ * Daftar nilai delta_t untuk studi konvergensi dibangkitkan dari spesifikasi
+ * teks, sehingga sweep dapat diubah tanpa kompilasi ulang:
+ *
+ *   lin:AWAL:AKHIR:JUMLAH    JUMLAH nilai berjarak sama dari AWAL ke AKHIR
+ *   geom:AWAL:AKHIR:JUMLAH   JUMLAH nilai dengan rasio tetap dari AWAL ke AKHIR
+ *   list:A,B,C,...           daftar eksplisit
+ *
+ * Setiap nilai dalam detik, atau relatif terhadap waktu paruh dengan bentuk
+ * T/x (T_half dibagi x) atau T*x. Contoh default program:
+ *
+ *   list:T/10,T/20,T/50,T/100,T/200
+ *
+ * Beberapa spesifikasi dapat digabung dengan ';' atau ditulis satu per baris
+ * dalam file (baris kosong dan teks setelah '#' diabaikan).
+ */
+
+#ifndef SWEEP_H
+#define SWEEP_H
+
+#include <stddef.h>
+
+// Batas jumlah nilai per spesifikasi lin/geom (melindungi dari salah ketik)
+#define SWEEP_MAX_CASES 10000000
+
+/**
+ * DAFTAR NILAI DELTA_T
+ */
+typedef struct {
+    double* values;
+    int count;
+    int capacity;
+} SweepValues;
+
+void sweep_values_init(SweepValues* sweep);
+void sweep_values_free(SweepValues* sweep);
+
+/**
+ * Mem-parse satu atau lebih spesifikasi (dipisah ';') dan menambahkan
+ * nilainya ke sweep. Pesan error dicetak ke stdout.
+ *
+ * @param spec                - Teks spesifikasi
+ * @param T_half              - Waktu paruh (s) untuk nilai berbentuk T/x dan T*x
+ * @param sweep               - Daftar tujuan (nilai ditambahkan di akhir)
+ *
+ * @return int - 1 jika berhasil, 0 jika spesifikasi tidak valid
+ */
+int sweep_parse_spec(const char* spec, double T_half, SweepValues* sweep);
+
+/**
+ * Membaca spesifikasi dari file (satu atau lebih per baris).
+ *
+ * @return int - 1 jika berhasil, 0 jika file tidak dapat dibaca atau tidak valid
+ */
+int sweep_load_file(const char* filename, double T_half, SweepValues* sweep);
+
+/**
+ * Mem-parse satu nilai waktu dengan sintaks yang sama (detik, T, T/x, T*x),
+ * misalnya horizon simulasi. Pesan error dicetak ke stdout.
+ *
+ * @return int - 1 jika berhasil (nilai > 0 dan berhingga), 0 jika tidak valid
+ */
+int sweep_parse_time(const char* text, double T_half, double* value);
+
+/**
+ * RINGKASAN SATU KASUS SWEEP
+ * ==========================
+ */
+typedef struct {
+    double delta_t;
+    int steps;                        // 0 jika kasus gagal
+    double final_error_absolute;
+    double final_error_relative_percent;
+    double max_error_relative_percent;
+    double final_time_s;              // Waktu baris terakhir (bisa berbeda dari t_end)
+    double final_N_numerical;         // Untuk ekstrapolasi Richardson
+    double final_N_analytical;
+} SweepCaseSummary;
+
+/**
+ * Menulis tabel ringkasan seluruh kasus ke file CSV:
+ * Delta_t_s,Steps,Final_Error_Absolute,Final_Error_Relative_Percent,Max_Error_Relative_Percent
+ *
+ * @return int - 1 jika berhasil, 0 jika penulisan gagal
+ */
+int sweep_write_summary_csv(const char* filename, const SweepCaseSummary* summaries, int num_cases);
+
+#endif // SWEEP_H
@@ -0,0 +1,179 @@
+/**
+ * ========================================================================
+ * IMPLEMENTASI POOL THREAD DENGAN WORK-STEALING
+ * ========================================================================
+ *
+ * Lihat task_pool.h untuk deskripsi antarmuka.
+ */
+
+#include "task_pool.h"
+
+#include <stdlib.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+int task_pool_default_threads(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (info.dwNumberOfProcessors > 0) ? (int)info.dwNumberOfProcessors : 1;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return (count > 0) ? (int)count : 1;
+#endif
+}
+
+/**
+ * PENGAMBILAN TUGAS
+ * =================
+ */
+
+// Pemilik mengambil tugas terdepan dari antreannya sendiri
+static int queue_pop_front(TaskQueue* queue) {
+    int task = -1;
+    pthread_mutex_lock(&queue->lock);
+    if (queue->begin < queue->end) task = queue->begin++;
+    pthread_mutex_unlock(&queue->lock);
+    return task;
+}
+
+// Pencuri mengambil tugas paling belakang (paling jauh dari posisi pemilik)
+static int queue_steal_back(TaskQueue* queue) {
+    int task = -1;
+    pthread_mutex_lock(&queue->lock);
+    if (queue->begin < queue->end) task = --queue->end;
+    pthread_mutex_unlock(&queue->lock);
+    return task;
+}
+
+// Mencuri dari antrean dengan sisa tugas terbanyak; -1 jika semua kosong
+static int steal_task(TaskPool* pool, int thief) {
+    for (;;) {
+        int victim = -1, most_remaining = 0;
+        for (int w = 0; w < pool->num_threads; w++) {
+            if (w == thief) continue;
+            TaskQueue* queue = &pool->queues[w];
+            pthread_mutex_lock(&queue->lock);
+            int remaining = queue->end - queue->begin;
+            pthread_mutex_unlock(&queue->lock);
+            if (remaining > most_remaining) {
+                most_remaining = remaining;
+                victim = w;
+            }
+        }
+        if (victim < 0) return -1;
+
+        // Antrean bisa kosong di antara pengecekan dan pencurian; ulangi
+        int task = queue_steal_back(&pool->queues[victim]);
+        if (task >= 0) return task;
+    }
+}
+
+static void mark_done(TaskPool* pool, int task_index, int stolen) {
+    pthread_mutex_lock(&pool->done_lock);
+    pool->done[task_index] = 1;
+    pool->steals += stolen;
+    pthread_cond_broadcast(&pool->done_cond);
+    pthread_mutex_unlock(&pool->done_lock);
+}
+
+static void* worker_main(void* argument) {
+    TaskWorker* worker = (TaskWorker*)argument;
+    TaskPool* pool = worker->pool;
+
+    for (;;) {
+        int stolen = 0;
+        int task = queue_pop_front(&pool->queues[worker->worker_index]);
+        if (task < 0) {
+            task = steal_task(pool, worker->worker_index);
+            stolen = 1;
+        }
+        if (task < 0) break;
+
+        pool->fn(pool->context, task);
+        mark_done(pool, task, stolen);
+    }
+    return NULL;
+}
+
+/**
+ * SIKLUS HIDUP POOL
+ * =================
+ */
+int task_pool_start(TaskPool* pool, int num_tasks, int num_threads, TaskFn fn, void* context) {
+    if (num_threads > num_tasks) num_threads = num_tasks;
+    if (num_threads < 1) num_threads = 1;
+
+    pool->fn = fn;
+    pool->context = context;
+    pool->num_tasks = num_tasks;
+    pool->num_threads = num_threads;
+    pool->threads_started = 0;
+    pool->steals = 0;
+
+    pool->queues = (TaskQueue*)malloc((size_t)num_threads * sizeof(TaskQueue));
+    pool->workers = (TaskWorker*)malloc((size_t)num_threads * sizeof(TaskWorker));
+    pool->threads = (pthread_t*)malloc((size_t)num_threads * sizeof(pthread_t));
+    pool->done = (unsigned char*)calloc((size_t)(num_tasks > 0 ? num_tasks : 1), 1);
+    pthread_mutex_init(&pool->done_lock, NULL);
+    pthread_cond_init(&pool->done_cond, NULL);
+
+    if (pool->queues == NULL || pool->workers == NULL || pool->threads == NULL || pool->done == NULL) {
+        free(pool->queues);
+        pool->queues = NULL;
+        return 0;
+    }
+
+    // Pembagian awal: rentang kontigu berukuran hampir sama per pekerja
+    for (int w = 0; w < num_threads; w++) {
+        pthread_mutex_init(&pool->queues[w].lock, NULL);
+        pool->queues[w].begin = (int)((long long)num_tasks * w / num_threads);
+        pool->queues[w].end = (int)((long long)num_tasks * (w + 1) / num_threads);
+    }
+
+    for (int w = 0; w < num_threads; w++) {
+        pool->workers[w].pool = pool;
+        pool->workers[w].worker_index = w;
+        if (pthread_create(&pool->threads[w], NULL, worker_main, &pool->workers[w]) != 0) {
+            // Tugas milik pekerja yang gagal dibuat akan dicuri pekerja lain
+            break;
+        }
+        pool->threads_started = w + 1;
+    }
+    return pool->threads_started > 0;
+}
+
+void task_pool_wait(TaskPool* pool, int task_index) {
+    pthread_mutex_lock(&pool->done_lock);
+    while (!pool->done[task_index]) {
+        pthread_cond_wait(&pool->done_cond, &pool->done_lock);
+    }
+    pthread_mutex_unlock(&pool->done_lock);
+}
+
+void task_pool_finish(TaskPool* pool) {
+    for (int w = 0; w < pool->threads_started; w++) {
+        pthread_join(pool->threads[w], NULL);
+    }
+    if (pool->queues != NULL) {
+        for (int w = 0; w < pool->num_threads; w++) {
+            pthread_mutex_destroy(&pool->queues[w].lock);
+        }
+    }
+    pthread_mutex_destroy(&pool->done_lock);
+    pthread_cond_destroy(&pool->done_cond);
+
+    free(pool->queues);
+    free(pool->workers);
+    free(pool->threads);
+    free(pool->done);
+    pool->queues = NULL;
+    pool->workers = NULL;
+    pool->threads = NULL;
+    pool->done = NULL;
+    pool->threads_started = 0;
+}
@@ -0,0 +1,91 @@
+/**
+ * ========================================================================
+ * MODUL POOL THREAD DENGAN WORK-STEALING
+ * ========================================================================
+ *
+ * Menjalankan sejumlah tugas independen (indeks 0..num_tasks-1) pada
+ * beberapa thread pekerja. Setiap pekerja memiliki antrean sendiri berisi
+ * rentang indeks kontigu: pemilik mengambil dari depan (urutan naik), dan
+ * pekerja yang antreannya habis mencuri dari belakang antrean pekerja lain.
+ * Dengan begitu kasus yang ukurannya tidak seimbang (Δt kecil = banyak step)
+ * tidak membuat thread lain menganggur.
+ *
+ * Pemanggil dapat menunggu tugas tertentu selesai (task_pool_wait) sehingga
+ * hasil dapat diproses dalam urutan indeks yang deterministik, sementara
+ * tugas-tugas berikutnya masih berjalan.
+ */
+
+#ifndef TASK_POOL_H
+#define TASK_POOL_H
+
+#include <pthread.h>
+
+/**
+ * Fungsi tugas: dipanggil sekali untuk setiap indeks tugas.
+ */
+typedef void (*TaskFn)(void* context, int task_index);
+
+/**
+ * ANTREAN TUGAS SATU PEKERJA
+ *
+ * Rentang [begin, end) dari indeks tugas yang belum diambil.
+ */
+typedef struct {
+    pthread_mutex_t lock;
+    int begin;
+    int end;
+} TaskQueue;
+
+typedef struct TaskPool TaskPool;
+
+typedef struct {
+    TaskPool* pool;
+    int worker_index;
+} TaskWorker;
+
+struct TaskPool {
+    TaskFn fn;
+    void* context;
+    int num_tasks;
+    int num_threads;
+
+    TaskQueue* queues;                // Satu antrean per pekerja
+    TaskWorker* workers;
+    pthread_t* threads;
+    int threads_started;
+
+    pthread_mutex_t done_lock;
+    pthread_cond_t done_cond;
+    unsigned char* done;              // done[i] = 1 setelah tugas i selesai
+    int steals;                       // Jumlah tugas yang dicuri (statistik)
+};
+
+/**
+ * Jumlah prosesor yang tersedia (minimal 1).
+ */
+int task_pool_default_threads(void);
+
+/**
+ * Membagi tugas ke antrean pekerja dan memulai num_threads thread.
+ * num_threads dibatasi ke [1, num_tasks].
+ *
+ * Jika hanya sebagian thread berhasil dibuat, tugas pekerja yang gagal
+ * dicuri oleh pekerja yang berjalan. task_pool_finish harus dipanggil
+ * setelahnya dalam kedua kasus.
+ *
+ * @return int - 1 jika minimal satu pekerja berjalan, 0 jika tidak ada
+ *               (tidak ada tugas yang dijalankan)
+ */
+int task_pool_start(TaskPool* pool, int num_tasks, int num_threads, TaskFn fn, void* context);
+
+/**
+ * Menunggu hingga tugas task_index selesai.
+ */
+void task_pool_wait(TaskPool* pool, int task_index);
+
+/**
+ * Menunggu semua thread selesai dan membebaskan sumber daya pool.
+ */
+void task_pool_finish(TaskPool* pool);
+
+#endif // TASK_POOL_H
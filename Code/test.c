@@ -0,0 +1,1619 @@
+/**
+ * ========================================================================
+ * PROGRAM UJI MANDIRI SIMULASI PELURUHAN
+ * ========================================================================
+ * 
+ * Memeriksa setiap modul pustaka decay terhadap referensi independen (solusi
+ * analitik, rekurensi eksak, libm, snprintf, pemindaian brute force) dan
+ * keluar dengan status non-nol jika ada pemeriksaan yang gagal. Dijalankan
+ * oleh ctest; menerima opsi yang sama dengan main (lihat cli.h), sehingga
+ * parameter fisik dan sweep yang diuji dapat diganti, mis.
+ * ./test --half-life 1600y --sweep list:T/100.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include <limits.h>
+#include <math.h>
+
+#include "chain.h"
+#include "cli.h"
+#include "convergence.h"
+#include "ensemble.h"
+#include "integrator.h"
+#include "network.h"
+#include "nuclide.h"
+#include "output.h"
+#include "simulation.h"
+#include "stats.h"
+#include "stochastic.h"
+#include "sweep.h"
+#include "task_pool.h"
+#include "vexp.h"
+
+/**
+ * KASUS UJI SATU NUKLIDA
+ * ======================
+ * 
+ * Satu run streaming dengan reduktor error sebagai satu-satunya sink, tanpa
+ * tabel konsol maupun file (setara kasus --summary-only di main).
+ */
+typedef struct {
+    double N0;
+    double lambda;
+    double t_start;
+    double t_end;
+    IntegratorMethod method;
+    EulerEvaluationMode evaluation_mode;
+    ResultLayout result_layout;
+} TestCase;
+
+static void test_case_summary(SweepCaseSummary* summary, const TestCase* config, double delta_t) {
+    ErrorReducer reducer;
+    error_reducer_init(&reducer);
+    ResultSink sink = { error_reducer_consume, &reducer };
+
+    int actual_steps = decay_simulate_stream(
+        config->N0, config->lambda, config->t_start, config->t_end, delta_t,
+        config->method, config->evaluation_mode, config->result_layout, &sink, 1
+    );
+    *summary = (SweepCaseSummary){
+        delta_t, (reducer.num_rows > 0) ? actual_steps : 0, reducer.last_row.error_absolute,
+        reducer.last_row.error_relative_percent, reducer.max_error_relative_percent,
+        reducer.last_row.time_s, reducer.last_row.N_numerical, reducer.last_row.N_analytical
+    };
+}
+
+// Fungsi evaluasi pencarian target: error relatif akhir dengan `steps` step seragam
+static double test_case_error(void* context, int steps) {
+    const TestCase* config = (const TestCase*)context;
+    SweepCaseSummary summary;
+    test_case_summary(&summary, config, (config->t_end - config->t_start) / (double)steps);
+    return (summary.steps > 0) ? summary.final_error_relative_percent / 100.0 : INFINITY;
+}
+
+/**
+ * VERIFIKASI MODE EVALUASI LANGSUNG TERHADAP LOOP SEKUENSIAL
+ * ==========================================================
+ * 
+ * Menjalankan kedua mode untuk setiap metode dan delta_t, lalu memeriksa
+ * bahwa jumlah step sama serta deviasi relatif N_numerik pada setiap baris
+ * berada di dalam batas
+ * (EULER_DIRECT_TOL_PER_STEP * s * i + EULER_DIRECT_TOL_OFFSET) * DBL_EPSILON
+ * dengan s = jumlah tahap metode.
+ * 
+ * Return:
+ * @return int - 0 jika seluruh pemeriksaan lolos, 1 jika ada yang gagal
+ */
+static int verify_direct_mode(
+    double N0, double lambda,
+    double t_initial, double t_final,
+    const double* delta_t_values, int num_cases
+) {
+    int failures = 0;
+
+    printf("Verifikasi mode langsung terhadap loop sekuensial:\n");
+    for (int m = 0; m < INTEGRATOR_COUNT; m++) {
+        const IntegratorInfo* info = integrator_info((IntegratorMethod)m);
+        for (int c = 0; c < num_cases; c++) {
+            SimulationResults sequential = results_empty(RESULT_LAYOUT_SOA);
+            SimulationResults direct = results_empty(RESULT_LAYOUT_SOA);
+            int seq_steps = decay_simulate(N0, lambda, t_initial, t_final, delta_t_values[c],
+                                           info->method, EULER_MODE_SEQUENTIAL, &sequential);
+            int dir_steps = decay_simulate(N0, lambda, t_initial, t_final, delta_t_values[c],
+                                           info->method, EULER_MODE_DIRECT, &direct);
+
+            int ok = (sequential.num_rows > 0 && seq_steps == dir_steps &&
+                      sequential.num_rows == direct.num_rows);
+            double worst_ratio = 0.0;   // deviasi terbesar relatif terhadap batas
+            if (ok) {
+                for (int i = 0; i < sequential.num_rows; i++) {
+                    double deviation = fabs(direct.N_numerical[i] - sequential.N_numerical[i]) /
+                                       sequential.N_numerical[i];
+                    double bound = (EULER_DIRECT_TOL_PER_STEP * info->stages * i +
+                                    EULER_DIRECT_TOL_OFFSET) * DBL_EPSILON;
+                    if (deviation / bound > worst_ratio) worst_ratio = deviation / bound;
+                }
+                if (worst_ratio > 1.0) ok = 0;
+            }
+
+            printf("  %-14s delta_t = %10.2f s: step %d / %d, deviasi maks = %.3f x batas -> %s\n",
+                   info->name, delta_t_values[c], seq_steps, dir_steps, worst_ratio,
+                   ok ? "LOLOS" : "GAGAL");
+            if (!ok) failures++;
+
+            results_free(&sequential);
+            results_free(&direct);
+        }
+    }
+
+    return failures > 0 ? 1 : 0;
+}
+
+/**
+ * VERIFIKASI INTEGRATOR
+ * =====================
+ * 
+ * Untuk setiap metode: (1) satu step dari N = 1 harus sama dengan faktor
+ * amplifikasi R(z) hingga beberapa ulp, (2) orde konvergensi teramati
+ * log2(error(Δt) / error(Δt/2)) pada t_final harus mendekati orde nominal
+ * (Euler eksponensial eksak untuk persamaan linear: error relatif harus
+ * setingkat pembulatan), dan (3) batas stabilitas: metode dengan
+ * stability_limit = 0 harus memenuhi |R(-λΔt)| <= 1 hingga λΔt = 10^6,
+ * metode eksplisit harus stabil tepat di bawah batasnya dan tidak stabil
+ * tepat di atasnya.
+ * 
+ * Return:
+ * @return int - 0 jika lolos, 1 jika tidak
+ */
+static int verify_integrators(double N0, double lambda, double t_initial, double t_final, double delta_t) {
+    int failures = 0;
+
+    printf("Verifikasi integrator (R(z), orde konvergensi dengan delta_t = %.2f s, stabilitas):\n",
+           delta_t);
+    for (int m = 0; m < INTEGRATOR_COUNT; m++) {
+        const IntegratorInfo* info = integrator_info((IntegratorMethod)m);
+
+        // Step tunggal terhadap R(z) untuk beberapa z di daerah stabil
+        double worst_step = 0.0;
+        for (int k = 1; k <= 200; k++) {
+            double h = (double)k * 0.01 / lambda;
+            double expected = integrator_amplification(info->method, -lambda * h);
+            double deviation = fabs(info->step(lambda, 1.0, h) - expected) / fabs(expected);
+            if (deviation > worst_step) worst_step = deviation;
+        }
+        int step_ok = worst_step <= 64.0 * DBL_EPSILON;
+
+        // Orde teramati dari error akhir dengan Δt dan Δt/2
+        double final_error[2], final_relative[2];
+        for (int r = 0; r < 2; r++) {
+            SweepCaseSummary summary;
+            TestCase config = { N0, lambda, t_initial, t_final, info->method,
+                                  EULER_MODE_SEQUENTIAL, RESULT_LAYOUT_SOA };
+            test_case_summary(&summary, &config, delta_t / (double)(1 << r));
+            final_error[r] = summary.final_error_absolute;
+            final_relative[r] = summary.final_error_relative_percent / 100.0;
+        }
+        double observed_order = log2(final_error[0] / final_error[1]);
+        int exact = info->method == INTEGRATOR_EXPONENTIAL_EULER || info->method == INTEGRATOR_CRAM;
+        int order_ok = exact ? (final_relative[0] <= 1e-12 && final_relative[1] <= 1e-12)
+                             : fabs(observed_order - (double)info->order) < 0.1;
+
+        // Stabilitas pada sumbu real negatif
+        int stable_ok;
+        if (info->stability_limit == 0.0) {
+            stable_ok = 1;
+            for (double x = 0.01; x <= 1e6 && stable_ok; x *= 1.5) {
+                stable_ok = fabs(info->step(lambda, 1.0, x / lambda)) <= 1.0;
+            }
+        } else {
+            double limit = info->stability_limit;
+            stable_ok = fabs(info->step(lambda, 1.0, 0.999 * limit / lambda)) <= 1.0 &&
+                        fabs(info->step(lambda, 1.0, 1.001 * limit / lambda)) > 1.0;
+        }
+
+        char stability[32];
+        if (info->stability_limit == 0.0) {
+            snprintf(stability, sizeof(stability), "semua delta_t");
+        } else {
+            snprintf(stability, sizeof(stability), "lambda*delta_t <= %.4f", info->stability_limit);
+        }
+        if (exact) {
+            printf("  %-14s orde %d: |step - R(z)| maks = %.2e, eksak (error relatif %.1e), stabil %s -> %s\n",
+                   info->name, info->order, worst_step, final_relative[1], stability,
+                   (step_ok && order_ok && stable_ok) ? "LOLOS" : "GAGAL");
+        } else {
+            printf("  %-14s orde %d: |step - R(z)| maks = %.2e, orde teramati = %.3f, stabil %s -> %s\n",
+                   info->name, info->order, worst_step, observed_order, stability,
+                   (step_ok && order_ok && stable_ok) ? "LOLOS" : "GAGAL");
+        }
+        if (!step_ok || !order_ok || !stable_ok) failures++;
+    }
+
+    return failures > 0 ? 1 : 0;
+}
+
+/**
+ * VERIFIKASI ANALISIS KONVERGENSI DAN EKSTRAPOLASI RICHARDSON
+ * ===========================================================
+ *
+ * Untuk setiap metode non-eksak, sweep Δt = delta_t / 2^k (k = 0..4):
+ * (1) orde hasil regresi kuadrat terkecil harus dalam 0.1 dari orde
+ * nominal dengan R² > 0.999 (titik setingkat pembulatan dilewati), dan
+ * (2) ekstrapolasi Richardson dua pasangan berurutan (Δt_k, Δt_k/2) harus
+ * jauh lebih akurat daripada run halusnya dan menunjukkan orde teramati
+ * minimal p + 0.8.
+ *
+ * @return int - 0 jika lolos, 1 jika tidak
+ */
+static int verify_convergence(double N0, double lambda, double t_initial, double t_final, double delta_t) {
+    enum { NUM_LEVELS = 5 };
+    int failures = 0;
+
+    printf("Verifikasi analisis konvergensi (regresi orde, Richardson) dengan delta_t = %.2f s / 2^k:\n",
+           delta_t);
+    for (int m = 0; m < INTEGRATOR_COUNT; m++) {
+        const IntegratorInfo* info = integrator_info((IntegratorMethod)m);
+        if (info->method == INTEGRATOR_EXPONENTIAL_EULER || info->method == INTEGRATOR_CRAM) continue;
+
+        SweepCaseSummary summaries[NUM_LEVELS];
+        double level_delta_t[NUM_LEVELS], level_error[NUM_LEVELS];
+        for (int k = 0; k < NUM_LEVELS; k++) {
+            TestCase config = { N0, lambda, t_initial, t_final, info->method,
+                                  EULER_MODE_SEQUENTIAL, RESULT_LAYOUT_SOA };
+            test_case_summary(&summaries[k], &config, delta_t / (double)(1 << k));
+            level_delta_t[k] = summaries[k].delta_t;
+            level_error[k] = summaries[k].final_error_relative_percent / 100.0;
+        }
+        ConvergenceFit fit;
+        int fit_ok = convergence_fit_order(level_delta_t, level_error, NUM_LEVELS, &fit) &&
+                     fit.num_points >= 3 &&
+                     fabs(fit.order - (double)info->order) < 0.1 && fit.r_squared > 0.999;
+
+        // Tiga level berurutan sehalus mungkin (daerah asimtotik) selama error
+        // run terhalus masih jauh di atas pembulatan
+        int first = NUM_LEVELS - 3;
+        while (first > 0 && level_error[first + 2] < 1e-9) first--;
+        double richardson_error[2];
+        for (int k = 0; k < 2; k++) {
+            const SweepCaseSummary* coarse = &summaries[first + k];
+            double N_extrapolated = convergence_richardson(coarse->final_N_numerical,
+                                                           coarse[1].final_N_numerical,
+                                                           2.0, (double)info->order);
+            richardson_error[k] = fabs(N_extrapolated - coarse[1].final_N_analytical) /
+                                  coarse[1].final_N_analytical;
+        }
+        double gain = level_error[first + 2] / richardson_error[1];
+        double richardson_order = log2(richardson_error[0] / richardson_error[1]);
+        int richardson_ok = gain > 10.0 && richardson_order >= (double)info->order + 0.8;
+
+        printf("  %-14s orde regresi = %.4f +/- %.4f (R^2 = %.6f), Richardson: error %.2e vs %.2e "
+               "(x%.0f), orde %.3f -> %s\n",
+               info->name, fit.order, fit.order_stderr, fit.r_squared, richardson_error[1],
+               level_error[first + 2],
+               gain, richardson_order, (fit_ok && richardson_ok) ? "LOLOS" : "GAGAL");
+        if (!fit_ok || !richardson_ok) failures++;
+    }
+
+    return failures > 0 ? 1 : 0;
+}
+
+/**
+ * VERIFIKASI PENCARIAN TARGET AKURASI
+ * ===================================
+ *
+ * Hasil convergence_search_steps dibandingkan dengan pemindaian linear
+ * n = 1, 2, ... : jumlah step yang ditemukan harus lolos target, dan kasus
+ * gagal terakhir dari pemindaian harus berada dalam toleransi pencarian di
+ * bawahnya. Pencarian juga harus melaporkan target yang tidak tercapai
+ * (error di bawah batas pembulatan).
+ *
+ * @return int - 0 jika lolos, 1 jika tidak
+ */
+static int verify_target_search(double N0, double lambda, double t_initial, double t_final) {
+    static const struct { IntegratorMethod method; double target; } cases[] = {
+        { INTEGRATOR_EULER, 1e-3 }, { INTEGRATOR_HEUN, 1e-6 },
+        { INTEGRATOR_RK4, 1e-8 }, { INTEGRATOR_CRANK_NICOLSON, 1e-6 }
+    };
+    int failures = 0;
+    double time_span = t_final - t_initial;
+
+    printf("Verifikasi pencarian target akurasi terhadap pemindaian linear jumlah step:\n");
+    for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+        TestCase config = { N0, lambda, t_initial, t_final, cases[c].method,
+                              EULER_MODE_SEQUENTIAL, RESULT_LAYOUT_SOA };
+        ConvergenceSearch search;
+        int reached = convergence_search_steps(test_case_error, &config, time_span, cases[c].target,
+                                               TARGET_DEFAULT_MAX_STEPS, &search);
+        int last_fail = 0;
+        for (int n = 1; reached && n < search.steps; n++) {
+            if (!(test_case_error(&config, n) <= cases[c].target)) last_fail = n;
+        }
+        int ok = reached && search.error <= cases[c].target &&
+                 (double)(search.steps - last_fail) <= fmax(1.0, CONVERGENCE_SEARCH_STEP_TOLERANCE * search.steps);
+        printf("  %-14s target %.0e: %d step dalam %d run (pemindaian: gagal terakhir %d) -> %s\n",
+               integrator_info(cases[c].method)->name, cases[c].target, search.steps, search.evaluations,
+               last_fail, ok ? "LOLOS" : "GAGAL");
+        if (!ok) failures++;
+    }
+
+    // Target di bawah pembulatan: harus berhenti tanpa menghabiskan batas step
+    TestCase config = { N0, lambda, t_initial, t_final, INTEGRATOR_RK4,
+                          EULER_MODE_SEQUENTIAL, RESULT_LAYOUT_SOA };
+    ConvergenceSearch search;
+    int reached = convergence_search_steps(test_case_error, &config, time_span, 1e-17,
+                                           TARGET_DEFAULT_MAX_STEPS, &search);
+    int floor_ok = !reached && search.total_steps < TARGET_DEFAULT_MAX_STEPS;
+    printf("  %-14s target 1e-17: tidak tercapai setelah %lld step total -> %s\n",
+           "rk4", search.total_steps, floor_ok ? "LOLOS" : "GAGAL");
+    if (!floor_ok) failures++;
+
+    return failures > 0 ? 1 : 0;
+}
+
+// Sink pembanding: setiap chunk streaming harus identik dengan baris yang sama
+// dari hasil array penuh
+typedef struct {
+    const SimulationResults* reference;
+    int mismatches;
+} RowComparator;
+
+static int row_comparator_consume(void* context, const SimulationResults* chunk, int first_row) {
+    RowComparator* comparator = (RowComparator*)context;
+    for (int i = 0; i < chunk->num_rows; i++) {
+        int global_row = first_row + i;
+        SimulationStep row = results_row(chunk, i);
+        if (global_row >= comparator->reference->num_rows) {
+            comparator->mismatches++;
+            continue;
+        }
+        SimulationStep expected = results_row(comparator->reference, global_row);
+        if (memcmp(&row, &expected, sizeof(row)) != 0) comparator->mismatches++;
+    }
+    return 1;
+}
+
+/**
+ * VERIFIKASI MODE PRESISI
+ * =======================
+ *
+ * Euler dengan 10^6 step: N akhir setiap mode dibandingkan dengan nilai
+ * eksak rekurensi (euler_recurrence_exact), dengan batas error pembulatan
+ * masing-masing mode: double i ε, Kahan dan double-double beberapa ε,
+ * long double i ε_long + ε, float i ε_float. Mode waktu terindeks harus
+ * memberi N identik dengan loop biasa dan t_i = t_initial + i Δt tepat.
+ * Untuk setiap mode, hasil streaming harus identik dengan array penuh
+ * (state presisi dibawa antar chunk).
+ *
+ * @return int - 0 jika lolos, 1 jika tidak
+ */
+static int verify_precision_modes(double N0, double lambda, double t_initial, double t_final) {
+    const int steps = 1000000;
+    double delta_t = (t_final - t_initial) / (double)steps;
+    double exact = euler_recurrence_exact(N0, lambda, delta_t, steps);
+    double n = (double)steps;
+    int failures = 0;
+
+    SimulationResults reference = results_empty(RESULT_LAYOUT_SOA);
+    decay_simulate(N0, lambda, t_initial, t_final, delta_t, INTEGRATOR_EULER, EULER_MODE_SEQUENTIAL, &reference);
+
+    printf("Verifikasi mode presisi Euler (%d step, lambda*delta_t = %.3e) terhadap rekurensi eksak:\n",
+           steps, lambda * delta_t);
+    for (int m = 0; m < EULER_MODE_COUNT; m++) {
+        EulerEvaluationMode mode = (EulerEvaluationMode)m;
+        if (mode == EULER_MODE_DIRECT) continue;
+
+        SimulationResults results = results_empty(RESULT_LAYOUT_SOA);
+        int full_steps = decay_simulate(N0, lambda, t_initial, t_final, delta_t, INTEGRATOR_EULER, mode, &results);
+        RowComparator comparator = { &results, 0 };
+        ResultSink sink = { row_comparator_consume, &comparator };
+        int stream_steps = decay_simulate_stream(N0, lambda, t_initial, t_final, delta_t, INTEGRATOR_EULER,
+                                                 mode, RESULT_LAYOUT_AOS, &sink, 1);
+        int ok = full_steps == steps && stream_steps == steps && comparator.mismatches == 0;
+
+        double deviation = NAN, time_drift = 0.0;
+        if (ok) {
+            deviation = fabs(results.N_numerical[steps] - exact) / exact;
+            for (int i = 0; i <= steps; i++) {
+                double drift = fabs(results.time_s[i] - (t_initial + (double)i * delta_t));
+                if (drift > time_drift) time_drift = drift;
+            }
+        }
+
+        double bound;
+        switch (mode) {
+        case EULER_MODE_KAHAN:         bound = 4.0 * DBL_EPSILON + n * lambda * delta_t * DBL_EPSILON; break;
+        case EULER_MODE_DOUBLE_DOUBLE: bound = DBL_EPSILON; break;
+        case EULER_MODE_LONG_DOUBLE:   bound = n * LDBL_EPSILON + DBL_EPSILON; break;
+        case EULER_MODE_FLOAT:         bound = n * FLT_EPSILON; break;
+        default:                       bound = n * DBL_EPSILON; break;
+        }
+        if (ok) ok = deviation <= bound;
+        if (ok && mode != EULER_MODE_SEQUENTIAL) ok = time_drift == 0.0;
+        if (ok && mode == EULER_MODE_INDEXED_TIME) {
+            ok = memcmp(results.N_numerical, reference.N_numerical, (size_t)(steps + 1) * sizeof(double)) == 0;
+        }
+
+        printf("  %-14s error relatif N akhir = %.3e (batas %.1e), drift waktu maks = %.3e s -> %s\n",
+               evaluation_mode_name(mode), deviation, bound, time_drift, ok ? "LOLOS" : "GAGAL");
+        if (!ok) failures++;
+        results_free(&results);
+    }
+    results_free(&reference);
+
+    return failures > 0 ? 1 : 0;
+}
+
+/**
+ * VERIFIKASI STEP ADAPTIF
+ * =======================
+ * 
+ * (1) Estimasi error tertanam y5 - y4 harus mendekati error lokal y4 yang
+ *     sebenarnya (N e^(-λh) - y4); selisih relatifnya adalah error y5 yang
+ *     satu orde lebih tinggi, sehingga dibatasi 0.5 * λh untuk λh <= 0.2.
+ * (2) Untuk setiap rtol (atol = 0): baris terakhir tepat di t_final, error
+ *     relatif global <= 10 * rtol, dan hasil streaming identik dengan array
+ *     penuh bit-per-bit.
+ * (3) Dengan penolakan, evaluasi f tepat 1 + 6 per percobaan step (FSAL).
+ * 
+ * Return:
+ * @return int - 0 jika lolos, 1 jika tidak
+ */
+static int verify_adaptive(double N0, double lambda, double t_initial, double t_final) {
+    int failures = 0;
+
+    printf("Verifikasi step adaptif Dormand-Prince 5(4):\n");
+    double worst_ratio = 0.0;   // deviasi terbesar relatif terhadap batas
+    for (int k = 1; k <= 20; k++) {
+        double z = (double)k * 0.01;
+        double h = z / lambda;
+        double error_estimate;
+        double y5 = integrator_dp45_embedded_step(lambda, N0, h, &error_estimate);
+        double y4 = y5 - error_estimate;
+        double true_error = N0 * exp(-z) - y4;
+        double deviation = fabs(error_estimate / true_error - 1.0);
+        if (deviation / (0.5 * z) > worst_ratio) worst_ratio = deviation / (0.5 * z);
+    }
+    int estimate_ok = worst_ratio <= 1.0;
+    printf("  estimasi error tertanam vs error lokal y4: deviasi maks = %.3f x batas -> %s\n",
+           worst_ratio, estimate_ok ? "LOLOS" : "GAGAL");
+    if (!estimate_ok) failures++;
+
+    const double rtols[4] = { 1e-4, 1e-6, 1e-8, 1e-10 };
+    for (int r = 0; r < 4; r++) {
+        AdaptiveControl control = { 0.0, rtols[r], 0.0, 0.0 };
+        AdaptiveStats stats;
+        SimulationResults results = results_empty(RESULT_LAYOUT_SOA);
+        int steps = decay_simulate_adaptive(N0, lambda, t_initial, t_final, &control, &results, &stats);
+
+        RowComparator comparator = { &results, 0 };
+        ResultSink sink = { row_comparator_consume, &comparator };
+        int stream_steps = decay_simulate_adaptive_stream(N0, lambda, t_initial, t_final, &control,
+                                                          RESULT_LAYOUT_AOS, &sink, 1, NULL);
+
+        int ok = steps > 0 && stream_steps == steps && comparator.mismatches == 0;
+        double final_error = 0.0;
+        if (ok) {
+            SimulationStep last = results_row(&results, results.num_rows - 1);
+            final_error = last.error_relative_percent / 100.0;
+            ok = last.time_s == t_final && final_error <= 10.0 * rtols[r];
+        }
+
+        printf("  rtol = %.0e: %d step (%d ditolak), error relatif akhir = %.3e -> %s\n",
+               rtols[r], steps, stats.rejected_steps, final_error, ok ? "LOLOS" : "GAGAL");
+        if (!ok) failures++;
+        results_free(&results);
+    }
+
+    // FSAL: step percobaan pertama seluas horizon pasti ditolak; setiap
+    // percobaan (termasuk ulangan setelah penolakan) hanya membayar 6
+    // evaluasi f di luar f(N0) pertama
+    AdaptiveControl control = { 0.0, 1e-8, t_final - t_initial, 0.0 };
+    AdaptiveStepper stepper;
+    adaptive_stepper_init(&stepper, lambda, N0, t_initial, t_final, &control);
+    double N = N0, t = t_initial;
+    while (adaptive_stepper_advance(&stepper, &N, &t)) {}
+    const AdaptiveStats* stats = &stepper.stats;
+    long long attempts = (long long)stats->accepted_steps + stats->rejected_steps;
+    int fsal_ok = !stepper.failed && t == t_final && stats->rejected_steps > 0 &&
+                  stats->function_evaluations == 1 + 6 * attempts;
+    printf("  FSAL: %d step + %d ditolak, %lld evaluasi f (1 + 6 per percobaan) -> %s\n",
+           stats->accepted_steps, stats->rejected_steps, stats->function_evaluations,
+           fsal_ok ? "LOLOS" : "GAGAL");
+    if (!fsal_ok) failures++;
+
+    return failures > 0 ? 1 : 0;
+}
+
+// Sink pembanding untuk rantai: setiap chunk streaming harus identik dengan
+// baris yang sama dari chain_simulate
+typedef struct {
+    const ChainResults* reference;
+    int mismatches;
+} ChainRowComparator;
+
+static int chain_row_comparator_consume(void* context, const ChainResults* chunk, int first_row) {
+    ChainRowComparator* comparator = (ChainRowComparator*)context;
+    const ChainResults* reference = comparator->reference;
+    for (int i = 0; i < chunk->num_rows; i++) {
+        int global_row = first_row + i;
+        if (global_row >= reference->num_rows || chunk->time_s[i] != reference->time_s[global_row]) {
+            comparator->mismatches++;
+            continue;
+        }
+        // Dibandingkan bit-per-bit: metode eksplisit pada rantai kaku dapat
+        // menghasilkan inf/NaN yang juga harus identik
+        for (int s = 0; s < chunk->num_species; s++) {
+            if (memcmp(&chunk->N_numerical[s][i], &reference->N_numerical[s][global_row], sizeof(double)) != 0 ||
+                memcmp(&chunk->error_relative_percent[s][i],
+                       &reference->error_relative_percent[s][global_row], sizeof(double)) != 0) {
+                comparator->mismatches++;
+            }
+        }
+    }
+    return 1;
+}
+
+// Error relatif akhir terbesar atas spesies [first_species, num_species)
+static double chain_final_relative_error(const DecayChain* chain, double t_initial, double t_final,
+                                         double delta_t, IntegratorMethod method, int first_species) {
+    ChainResults results;
+    if (chain_simulate(chain, t_initial, t_final, delta_t, method, &results) == 0) return INFINITY;
+    double worst = 0.0;
+    int last = results.num_rows - 1;
+    for (int s = first_species; s < results.num_species; s++) {
+        double relative = results.error_relative_percent[s][last] / 100.0;
+        if (relative > worst) worst = relative;
+    }
+    chain_results_free(&results);
+    return worst;
+}
+
+/**
+ * VERIFIKASI RANTAI PELURUHAN
+ * ===========================
+ * 
+ * (1) Rantai satu spesies harus sama dengan decay_simulate untuk setiap
+ *     metode: R(hA) dievaluasi dengan Horner sedangkan step skalar memakai
+ *     bentuk tahap, sehingga deviasi baris ke-i dibatasi (tahap * i + 4) eps.
+ * (2) Orde konvergensi metode stabil pada rantai Rn-222 lengkap (Δt = T/200
+ *     dan T/400, jauh di atas batas stabilitas eksplisit anak berumur
+ *     pendek); untuk exp-euler Rn-222 eksak sehingga hanya anak yang diukur.
+ * (3) Orde metode eksplisit pada rantai tidak kaku Rn-222 -> Pb-210.
+ * (4) Hasil streaming identik dengan chain_simulate untuk setiap metode.
+ * CRAM tidak memiliki orde step; sebagai ganti (2), error setiap spesies
+ * harus setingkat pembulatan untuk Δt = T/200, T/400, dan satu step penuh.
+ * 
+ * Return:
+ * @return int - 0 jika lolos, 1 jika tidak
+ */
+static int verify_chain(double N0, double T_half, double t_initial, double t_final) {
+    int failures = 0;
+    DecayChain radon;
+    chain_radon222(&radon, N0, T_half);
+
+    DecayChain single = radon;
+    single.num_species = 1;
+
+    DecayChain non_stiff = radon;
+    non_stiff.num_species = 2;
+    non_stiff.species[1] = radon.species[5];
+    non_stiff.species[0].branching = 1.0;
+
+    printf("Verifikasi rantai peluruhan (Bateman):\n");
+    for (int m = 0; m < INTEGRATOR_COUNT; m++) {
+        const IntegratorInfo* info = integrator_info((IntegratorMethod)m);
+
+        // (1) Satu spesies vs simulasi skalar
+        double delta_t = T_half / 10.0;
+        double lambda = radon.species[0].lambda;
+        SimulationResults scalar = results_empty(RESULT_LAYOUT_SOA);
+        ChainResults chained;
+        int scalar_steps = decay_simulate(N0, lambda, t_initial, t_final, delta_t, info->method,
+                                          EULER_MODE_SEQUENTIAL, &scalar);
+        int chain_steps = chain_simulate(&single, t_initial, t_final, delta_t, info->method, &chained);
+        int single_ok = scalar_steps > 0 && chain_steps == scalar_steps;
+        double worst_ratio = 0.0;
+        // CRAM: urutan evaluasi pecahan parsial berbeda, dan pembatalan antar
+        // suku (Σ 2|α_j|/|θ_j| ≈ 136) memperbesar pembulatan per step
+        double per_step = (info->method == INTEGRATOR_CRAM) ? 256.0 : (double)info->stages;
+        for (int i = 0; single_ok && i < chained.num_rows; i++) {
+            SimulationStep row = results_row(&scalar, i);
+            double bound = (per_step * i + 4.0) * DBL_EPSILON * fabs(row.N_numerical);
+            double deviation = fabs(chained.N_numerical[0][i] - row.N_numerical);
+            if (row.time_s != chained.time_s[i]) single_ok = 0;
+            if (bound > 0.0 && deviation / bound > worst_ratio) worst_ratio = deviation / bound;
+        }
+        single_ok = single_ok && worst_ratio <= 1.0;
+        results_free(&scalar);
+
+        // (4) Streaming vs array penuh (rantai lengkap)
+        ChainResults full;
+        int full_steps = chain_simulate(&radon, t_initial, t_final, T_half / 200.0, info->method, &full);
+        ChainRowComparator comparator = { &full, 0 };
+        ChainSink sink = { chain_row_comparator_consume, &comparator };
+        int stream_steps = chain_simulate_stream(&radon, t_initial, t_final, T_half / 200.0,
+                                                 info->method, &sink, 1);
+        int stream_ok = full_steps > 0 && stream_steps == full_steps && comparator.mismatches == 0;
+        if (full_steps > 0) chain_results_free(&full);
+        if (chain_steps > 0) chain_results_free(&chained);
+
+        // (2)/(3) Orde teramati dari error relatif akhir terbesar
+        int stiff_stable = info->stability_limit == 0.0;
+        const DecayChain* order_chain = stiff_stable ? &radon : &non_stiff;
+        double order_delta_t = stiff_stable ? T_half / 200.0 : T_half / 10.0;
+        int first_species = (info->method == INTEGRATOR_EXPONENTIAL_EULER) ? 1 : 0;
+        double error_coarse = chain_final_relative_error(order_chain, t_initial, t_final, order_delta_t,
+                                                         info->method, first_species);
+        double error_fine = chain_final_relative_error(order_chain, t_initial, t_final, order_delta_t / 2.0,
+                                                       info->method, first_species);
+        double observed_order = log2(error_coarse / error_fine);
+
+        if (info->method == INTEGRATOR_CRAM) {
+            // CRAM tidak memiliki orde step: error setiap spesies harus setingkat
+            // pembulatan, juga untuk satu step yang mencakup seluruh simulasi
+            double error_single = chain_final_relative_error(&radon, t_initial, t_final, t_final - t_initial,
+                                                             info->method, 0);
+            int exact_ok = error_coarse <= 1e-11 && error_fine <= 1e-11 && error_single <= 1e-12;
+            int ok = single_ok && stream_ok && exact_ok;
+            printf("  %-14s 1 spesies vs skalar: deviasi maks = %.3f x batas, rantai Rn-222 eksak "
+                   "(error relatif %.1e, satu step %.1e), streaming %s -> %s\n",
+                   info->name, worst_ratio, error_fine, error_single,
+                   stream_ok ? "identik" : "BERBEDA", ok ? "LOLOS" : "GAGAL");
+            if (!ok) failures++;
+            continue;
+        }
+
+        int order_ok = fabs(observed_order - (double)info->order) < 0.15;
+        int ok = single_ok && stream_ok && order_ok;
+        printf("  %-14s 1 spesies vs skalar: deviasi maks = %.3f x batas, orde teramati (%s) = %.3f, "
+               "streaming %s -> %s\n",
+               info->name, worst_ratio, stiff_stable ? "rantai Rn-222" : "Rn-222 -> Pb-210",
+               observed_order, stream_ok ? "identik" : "BERBEDA", ok ? "LOLOS" : "GAGAL");
+        if (!ok) failures++;
+    }
+
+    return failures > 0 ? 1 : 0;
+}
+
+/**
+ * VERIFIKASI JARINGAN PELURUHAN SPARSE (CRAM)
+ * ===========================================
+ * 
+ * (1) Rantai Rn-222 sebagai jaringan: satu step CRAM dari t_initial ke
+ *     t_final harus sama dengan solusi Bateman (error relatif per spesies
+ *     <= 1e-12) dan dengan step cram dari chain_simulate (<= 1e-12; urutan
+ *     pembulatan berbeda).
+ * (2) Jaringan sintetis 4096 nuklida (1-3 anak per induk, waktu paruh 1 µs
+ *     hingga 10^16 s, urutan penambahan diacak sehingga urutan topologis
+ *     tidak trivial, 16 nuklida terakhir stabil): jumlah atom harus kekal dan
+ *     exp(AΔt) N harus sama dengan dua step Δt/2, keduanya relatif terhadap
+ *     Σ N0 <= 1e-12.
+ * 
+ * Return:
+ * @return int - 0 jika lolos, 1 jika tidak
+ */
+static int verify_network(double N0, double T_half, double t_initial, double t_final) {
+    int failures = 0;
+    printf("Verifikasi jaringan peluruhan sparse (CRAM):\n");
+
+    // (1) Rantai Rn-222
+    DecayChain radon;
+    chain_radon222(&radon, N0, T_half);
+    DecayNetwork chain_network;
+    ChainResults reference;
+    int ok = network_from_chain(&radon, &chain_network);
+    int reference_steps = ok ? chain_simulate(&radon, t_initial, t_final, t_final - t_initial,
+                                              INTEGRATOR_CRAM, &reference) : 0;
+    if (ok && reference_steps == 1) {
+        NetworkSolver solver;
+        double N[CHAIN_MAX_SPECIES];
+        for (int s = 0; s < radon.num_species; s++) N[s] = radon.species[s].N0;
+        ok = network_solver_init(&solver, &chain_network);
+        if (ok) network_solver_step(&solver, t_final - t_initial, N, N);
+        network_solver_free(&solver);
+
+        double worst_bateman = 0.0, worst_chain = 0.0;
+        for (int s = 0; s < radon.num_species && ok; s++) {
+            double analytical = reference.N_analytical[s][1];
+            double bateman = fabs(N[s] - analytical) / analytical;
+            double chained = fabs(N[s] - reference.N_numerical[s][1]) / analytical;
+            if (bateman > worst_bateman) worst_bateman = bateman;
+            if (chained > worst_chain) worst_chain = chained;
+        }
+        ok = ok && worst_bateman <= 1e-12 && worst_chain <= 1e-12;
+        printf("  rantai Rn-222, satu step %.0f s: error relatif vs Bateman = %.2e, vs chain_simulate = %.2e -> %s\n",
+               t_final - t_initial, worst_bateman, worst_chain, ok ? "LOLOS" : "GAGAL");
+    } else {
+        ok = 0;
+        printf("  rantai Rn-222: gagal membangun jaringan atau referensi -> GAGAL\n");
+    }
+    if (reference_steps > 0) chain_results_free(&reference);
+    network_free(&chain_network);
+    if (!ok) failures++;
+
+    // (2) Jaringan sintetis besar; LCG deterministik
+    enum { NUM_NUCLIDES = 4096, NUM_STABLE = 16, MAX_REACH = 64 };
+    DecayNetwork network;
+    network_init(&network);
+    double* N_full = (double*)malloc(NUM_NUCLIDES * sizeof(double));
+    double* N_half = (double*)malloc(NUM_NUCLIDES * sizeof(double));
+    ok = N_full != NULL && N_half != NULL;
+
+    unsigned long long state = 0x9E3779B97F4A7C15ULL;
+    #define NETWORK_LCG_UNIFORM() \
+        ((double)((state = state * 6364136223846793005ULL + 1442695040888963407ULL) >> 11) / 9007199254740992.0)
+    // Posisi rantai i <-> indeks jaringan: dibalik per blok 64 (involusi), agar
+    // urutan penambahan berbeda dari urutan topologis
+    #define NETWORK_SHUFFLE(i) (((i) / 64) * 64 + 63 - (i) % 64)
+
+    for (int k = 0; k < NUM_NUCLIDES && ok; k++) {
+        int i = NETWORK_SHUFFLE(k);
+        char name[NETWORK_NAME_BYTES];
+        snprintf(name, sizeof(name), "X-%d", i);
+        double half_life = (i >= NUM_NUCLIDES - NUM_STABLE) ? INFINITY
+                                                           : 1e-6 * pow(1e22, NETWORK_LCG_UNIFORM());
+        ok = network_add_nuclide(&network, name, half_life) == k;
+    }
+    for (int i = 0; i < NUM_NUCLIDES - NUM_STABLE && ok; i++) {
+        int num_daughters = 1 + (int)(3.0 * NETWORK_LCG_UNIFORM());
+        int reach = NUM_NUCLIDES - 1 - i;
+        if (reach > MAX_REACH) reach = MAX_REACH;
+        for (int d = 0; d < num_daughters && ok; d++) {
+            int daughter = i + 1 + (int)(reach * NETWORK_LCG_UNIFORM());
+            ok = network_add_transition(&network, NETWORK_SHUFFLE(i), NETWORK_SHUFFLE(daughter),
+                                        1.0 / num_daughters);
+        }
+    }
+    #undef NETWORK_LCG_UNIFORM
+    #undef NETWORK_SHUFFLE
+    ok = ok && network_finalize(&network);
+
+    if (ok) {
+        NetworkSolver solver;
+        ok = network_solver_init(&solver, &network);
+        double total_initial = 0.0;
+        for (int k = 0; k < NUM_NUCLIDES; k++) {
+            N_full[k] = (k % 7 == 0) ? N0 * (double)(k % 13 + 1) / 13.0 : 0.0;
+            N_half[k] = N_full[k];
+            total_initial += N_full[k];
+        }
+
+        double delta_t = t_final - t_initial;
+        if (ok) {
+            network_solver_step(&solver, delta_t, N_full, N_full);
+            network_solver_step(&solver, 0.5 * delta_t, N_half, N_half);
+            network_solver_step(&solver, 0.5 * delta_t, N_half, N_half);
+        }
+        network_solver_free(&solver);
+
+        double total_final = 0.0, semigroup = 0.0;
+        for (int k = 0; k < NUM_NUCLIDES; k++) {
+            total_final += N_full[k];
+            double difference = fabs(N_full[k] - N_half[k]);
+            if (difference > semigroup) semigroup = difference;
+        }
+        double conservation = fabs(total_final - total_initial) / total_initial;
+        semigroup /= total_initial;
+        ok = ok && conservation <= 1e-12 && semigroup <= 1e-12;
+
+        double dense_bytes = (double)NUM_NUCLIDES * NUM_NUCLIDES * sizeof(double);
+        printf("  jaringan %d nuklida, %d transisi: memori %.1f KiB (matriks padat %.1f MiB), "
+               "kekekalan atom %.2e, exp(A dt) vs 2 step dt/2 %.2e -> %s\n",
+               network.num_nuclides, network.num_nonzeros, network_bytes(&network) / 1024.0,
+               dense_bytes / (1024.0 * 1024.0), conservation, semigroup, ok ? "LOLOS" : "GAGAL");
+    } else {
+        printf("  jaringan sintetis: gagal dibangun -> GAGAL\n");
+    }
+    if (!ok) failures++;
+
+    network_free(&network);
+    free(N_full);
+    free(N_half);
+    return failures > 0 ? 1 : 0;
+}
+
+/**
+ * UJI CHI-KUADRAT SAMPLER BINOMIAL
+ * ================================
+ * Histogram num_samples sampel Binomial(n, p) dibandingkan dengan pmf eksak
+ * (rekurensi P(k+1) = P(k) (n-k)/(k+1) p/q). Sel dengan harapan < 5
+ * digabung ke sel ekor. Batas kritis: pendekatan Wilson-Hilferty pada
+ * z = 5 (peluang positif palsu ~3e-7).
+ *
+ * @return int - 1 jika lolos, 0 jika tidak
+ */
+static int binomial_chi_square(uint64_t seed, int n, double p, int num_samples,
+                               double* statistic, int* degrees) {
+    enum { MAX_N = 128 };
+    double pmf[MAX_N + 1];
+    long long observed[MAX_N + 1];
+    *statistic = 0.0;
+    *degrees = 0;
+    pmf[0] = pow(1.0 - p, n);
+    for (int k = 0; k < n; k++) pmf[k + 1] = pmf[k] * (double)(n - k) / (double)(k + 1) * p / (1.0 - p);
+    memset(observed, 0, sizeof(observed));
+
+    RngStream stream;
+    rng_stream_init(&stream, seed, 0);
+    for (int i = 0; i < num_samples; i++) {
+        double k = rng_binomial(&stream, (double)n, p);
+        if (k < 0.0 || k > (double)n || k != floor(k)) return 0;
+        observed[(int)k]++;
+    }
+
+    // Sel [lo, hi] dengan harapan >= 5; ekor kiri/kanan digabung ke ujungnya
+    int lo = 0, hi = n;
+    while (lo < n && pmf[lo] * num_samples < 5.0) lo++;
+    while (hi > lo && pmf[hi] * num_samples < 5.0) hi--;
+    double chi_square = 0.0;
+    int cells = 0;
+    for (int k = lo; k <= hi; k++) {
+        double expected = pmf[k] * num_samples;
+        double count = (double)observed[k];
+        if (k == lo) for (int j = 0; j < lo; j++) { expected += pmf[j] * num_samples; count += (double)observed[j]; }
+        if (k == hi) for (int j = hi + 1; j <= n; j++) { expected += pmf[j] * num_samples; count += (double)observed[j]; }
+        chi_square += (count - expected) * (count - expected) / expected;
+        cells++;
+    }
+    int df = cells - 1;
+    double a = 2.0 / (9.0 * df);
+    double critical = df * pow(1.0 - a + 5.0 * sqrt(a), 3.0);
+    *statistic = chi_square;
+    *degrees = df;
+    return chi_square <= critical;
+}
+
+/**
+ * VERIFIKASI MODE STOKASTIK
+ * =========================
+ * 
+ * (1) Philox4x32-10 terhadap tiga vektor uji Random123 (kat_vectors).
+ * (2) Sampler binomial: chi-kuadrat terhadap pmf eksak untuk jalur BTRS
+ *     (n = 100, p = 0.3) dan inversi (n = 40, p = 0.1), serta momen pada
+ *     n = 10^15 (|z| mean <= 5, rasio variansi dalam 5 √(2/M)).
+ * (3) Ensemble binomial dan Gillespie (N0 = 1000, Δt = t_final/10): |z| mean
+ *     terhadap N0 e^{-λt} <= 5 di setiap baris dan rasio variansi akhir
+ *     terhadap N0 e^{-λt}(1 - e^{-λt}) dalam 5 √(2/M).
+ * (4) Reproduktibilitas: ensemble dengan 1 thread dan jumlah thread default
+ *     harus identik bit-per-bit.
+ * 
+ * Return:
+ * @return int - 0 jika lolos, 1 jika tidak
+ */
+static int verify_stochastic(double lambda, double t_initial, double t_final) {
+    int failures = 0;
+    printf("Verifikasi mode stokastik (Philox4x32-10, sampler binomial, ensemble):\n");
+
+    // (1) Vektor uji Known Answer Test Random123
+    static const uint32_t kat_vectors[3][10] = {
+        { 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+          0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u },
+        { 0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu,
+          0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu },
+        { 0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u, 0xa4093822u, 0x299f31d0u,
+          0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u }
+    };
+    int kat_passed = 0;
+    for (int v = 0; v < 3; v++) {
+        uint32_t output[4];
+        philox4x32_10(kat_vectors[v], kat_vectors[v] + 4, output);
+        if (memcmp(output, kat_vectors[v] + 6, sizeof(output)) == 0) kat_passed++;
+    }
+    printf("  Philox4x32-10: %d/3 vektor uji Random123 cocok -> %s\n",
+           kat_passed, kat_passed == 3 ? "LOLOS" : "GAGAL");
+    if (kat_passed != 3) failures++;
+
+    // (2) Distribusi sampler binomial
+    static const struct { int n; double p; const char* path; } chi_cases[2] = {
+        { 100, 0.3, "BTRS" }, { 40, 0.1, "inversi" }
+    };
+    for (int c = 0; c < 2; c++) {
+        double statistic;
+        int degrees;
+        int ok = binomial_chi_square(STOCHASTIC_DEFAULT_SEED + (uint64_t)c, chi_cases[c].n, chi_cases[c].p,
+                                     1000000, &statistic, &degrees);
+        printf("  Binomial(%d, %.1f) [%s], 10^6 sampel: chi-kuadrat = %.1f (df %d) -> %s\n",
+               chi_cases[c].n, chi_cases[c].p, chi_cases[c].path, statistic, degrees, ok ? "LOLOS" : "GAGAL");
+        if (!ok) failures++;
+    }
+    {
+        const int num_samples = 1000000;
+        const double n = 1.0e15, p = 0.0693;
+        RngStream stream;
+        rng_stream_init(&stream, STOCHASTIC_DEFAULT_SEED, 7);
+        double mean = n * p, variance = n * p * (1.0 - p);
+        double sum = 0.0, sum_squares = 0.0;
+        int integral = 1;
+        for (int i = 0; i < num_samples; i++) {
+            double k = rng_binomial(&stream, n, p);
+            if (k != floor(k) || k < 0.0 || k > n) integral = 0;
+            double deviation = k - mean;
+            sum += deviation;
+            sum_squares += deviation * deviation;
+        }
+        double z = (sum / num_samples) / sqrt(variance / num_samples);
+        double ratio = (sum_squares - sum * sum / num_samples) / (num_samples - 1) / variance;
+        int ok = integral && fabs(z) <= 5.0 && fabs(ratio - 1.0) <= 5.0 * sqrt(2.0 / num_samples);
+        printf("  Binomial(10^15, %.4f), 10^6 sampel: z mean = %.2f, rasio variansi = %.4f -> %s\n",
+               p, z, ratio, ok ? "LOLOS" : "GAGAL");
+        if (!ok) failures++;
+    }
+
+    // (3) Ensemble terhadap nilai harapan dan variansi analitik
+    static const struct { StochasticSampler sampler; long long trajectories; const char* name; } ensembles[2] = {
+        { STOCHASTIC_BINOMIAL, 100000, "binomial" }, { STOCHASTIC_GILLESPIE, 20000, "gillespie" }
+    };
+    for (int e = 0; e < 2; e++) {
+        StochasticConfig config = { 1000.0, lambda, t_initial, t_final, (t_final - t_initial) / 10.0,
+                                    ensembles[e].trajectories, STOCHASTIC_DEFAULT_SEED, ensembles[e].sampler, 0 };
+        StochasticResults results;
+        int steps = stochastic_simulate(&config, &results);
+        if (steps == 0) {
+            printf("  ensemble %s: simulasi gagal -> GAGAL\n", ensembles[e].name);
+            failures++;
+            continue;
+        }
+        double M = (double)config.num_trajectories;
+        double max_abs_z = 0.0;
+        for (int row = 1; row < results.num_rows; row++) {
+            double z = (results.N_mean[row] - results.N_analytical[row]) /
+                       sqrt(results.variance_analytical[row] / M);
+            if (fabs(z) > max_abs_z) max_abs_z = fabs(z);
+        }
+        int last = results.num_rows - 1;
+        double ratio = results.N_variance[last] / results.variance_analytical[last];
+        int ok = results.N_mean[0] == config.N0 && results.N_variance[0] == 0.0 &&
+                 max_abs_z <= 5.0 && fabs(ratio - 1.0) <= 5.0 * sqrt(2.0 / M);
+        printf("  ensemble %s, N0 = 1000, %lld trajektori, %d step: |z| maksimum = %.2f, "
+               "rasio variansi akhir = %.4f -> %s\n",
+               ensembles[e].name, config.num_trajectories, steps, max_abs_z, ratio, ok ? "LOLOS" : "GAGAL");
+        if (!ok) failures++;
+
+        // (4) Reproduktibilitas terhadap jumlah thread
+        if (e == 0) {
+            StochasticConfig serial = config;
+            serial.num_threads = 1;
+            StochasticResults serial_results;
+            int serial_steps = stochastic_simulate(&serial, &serial_results);
+            size_t bytes = (size_t)results.num_rows * sizeof(double);
+            int identical = serial_steps == steps &&
+                            memcmp(serial_results.N_mean, results.N_mean, bytes) == 0 &&
+                            memcmp(serial_results.N_variance, results.N_variance, bytes) == 0 &&
+                            memcmp(serial_results.N_sample, results.N_sample, bytes) == 0;
+            printf("  ensemble 1 thread vs thread default: %s -> %s\n",
+                   identical ? "identik bit-per-bit" : "BERBEDA", identical ? "LOLOS" : "GAGAL");
+            if (serial_steps > 0) stochastic_results_free(&serial_results);
+            if (!identical) failures++;
+        }
+        stochastic_results_free(&results);
+    }
+
+    return failures > 0 ? 1 : 0;
+}
+
+/**
+ * VERIFIKASI ENSEMBLE PARAMETER
+ * =============================
+ * 
+ * (1) Ensemble homogen (semua anggota bernilai nominal, 140000 anggota
+ *     sehingga jalur pengurungan kuantil dengan nilai kembar ikut diuji):
+ *     untuk setiap metode, mean dan setiap kuantil per baris harus sama
+ *     dengan decay_simulate sekuensial dalam batas mode langsung
+ *     (s i + 4) ε (+ 64 ε untuk mean), simpangan baku <= 1e-13 mean.
+ * (2) Ensemble terperturbasi 150001 anggota (bukan kelipatan chunk/lane)
+ *     dengan rk4 terhadap referensi brute force (setiap anggota dimajukan
+ *     satu per satu, setiap baris diurutkan dengan qsort): kuantil
+ *     0, 2.5, 50, 97.5, 100% identik bit-per-bit, mean dan mean analitik
+ *     (exp() libm) <= 1e-12 relatif, simpangan baku <= 1e-10 relatif.
+ * (3) Reproduktibilitas: ensemble (2) dengan 1 dan 4 thread identik
+ *     bit-per-bit.
+ * 
+ * Return:
+ * @return int - 0 jika lolos, 1 jika tidak
+ */
+static int compare_double_ascending(const void* a, const void* b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static int verify_ensemble(double N0, double lambda, double t_initial, double t_final) {
+    int failures = 0;
+    double delta_t = (t_final - t_initial) / 40.0;
+    static const double quantiles[5] = { 0.0, 0.025, 0.5, 0.975, 1.0 };
+    printf("Verifikasi ensemble parameter (lockstep SoA):\n");
+
+    // (1) Ensemble homogen terhadap decay_simulate
+    EnsembleMembers homogeneous;
+    if (!ensemble_members_allocate(&homogeneous, 140000)) {
+        printf("  gagal mengalokasikan anggota -> GAGAL\n");
+        return 1;
+    }
+    ensemble_members_perturb(&homogeneous, N0, lambda, 0.0, 0.0, STOCHASTIC_DEFAULT_SEED, 0);
+    for (int m = 0; m < INTEGRATOR_COUNT; m++) {
+        const IntegratorInfo* info = integrator_info((IntegratorMethod)m);
+        EnsembleConfig config = { &homogeneous, t_initial, t_final, delta_t, info->method, quantiles, 5, 0 };
+        EnsembleResults ensemble;
+        SimulationResults scalar = results_empty(RESULT_LAYOUT_SOA);
+        int ensemble_steps = ensemble_simulate(&config, &ensemble);
+        int scalar_steps = decay_simulate(N0, lambda, t_initial, t_final, delta_t, info->method,
+                                          EULER_MODE_SEQUENTIAL, &scalar);
+        int ok = ensemble_steps > 0 && ensemble_steps == scalar_steps;
+        double worst_ratio = 0.0, worst_spread = 0.0;
+        for (int i = 0; ok && i < ensemble.num_rows; i++) {
+            double reference = scalar.N_numerical[i];
+            double bound = (EULER_DIRECT_TOL_PER_STEP * info->stages * i + EULER_DIRECT_TOL_OFFSET) * DBL_EPSILON;
+            double ratio = fabs(ensemble.N_mean[i] - reference) / reference / (bound + 64.0 * DBL_EPSILON);
+            for (int q = 0; q < 5; q++) {
+                double quantile_ratio = fabs(ensemble.quantile[q][i] - reference) / reference / bound;
+                if (quantile_ratio > ratio) ratio = quantile_ratio;
+            }
+            if (ratio > worst_ratio) worst_ratio = ratio;
+            if (ensemble.N_stddev[i] / reference > worst_spread) worst_spread = ensemble.N_stddev[i] / reference;
+        }
+        ok = ok && worst_ratio <= 1.0 && worst_spread <= 1e-13;
+        printf("  homogen %-14s: deviasi maks mean/kuantil = %.3f x batas, simp. baku relatif = %.1e -> %s\n",
+               info->name, worst_ratio, worst_spread, ok ? "LOLOS" : "GAGAL");
+        if (!ok) failures++;
+        if (ensemble_steps > 0) ensemble_results_free(&ensemble);
+        results_free(&scalar);
+    }
+    ensemble_members_free(&homogeneous);
+
+    // (2) Ensemble terperturbasi terhadap referensi brute force
+    const long long M = 150001;
+    EnsembleMembers members;
+    double* N = (double*)malloc((size_t)M * sizeof(double));
+    double* factor = (double*)malloc((size_t)M * sizeof(double));
+    double* sorted = (double*)malloc((size_t)M * sizeof(double));
+    if (N == NULL || factor == NULL || sorted == NULL || !ensemble_members_allocate(&members, M)) {
+        printf("  gagal mengalokasikan referensi -> GAGAL\n");
+        free(N);
+        free(factor);
+        free(sorted);
+        return 1;
+    }
+    ensemble_members_perturb(&members, N0, lambda, 0.05, 0.02, STOCHASTIC_DEFAULT_SEED, 0);
+    EnsembleConfig config = { &members, t_initial, t_final, delta_t, INTEGRATOR_RK4, quantiles, 5, 1 };
+    EnsembleResults serial, threaded;
+    int serial_steps = ensemble_simulate(&config, &serial);
+    config.num_threads = 4;
+    int threaded_steps = ensemble_simulate(&config, &threaded);
+
+    int ok = serial_steps > 0;
+    double worst_mean = 0.0, worst_stddev = 0.0, worst_analytical = 0.0;
+    int quantile_mismatches = 0;
+    for (long long j = 0; j < M; j++) {
+        N[j] = members.N0[j];
+        factor[j] = integrator_amplification(INTEGRATOR_RK4, -members.lambda[j] * delta_t);
+    }
+    for (int i = 0; ok && i < serial.num_rows; i++) {
+        double tau = serial.time_s[i] - t_initial;
+        double sum = 0.0, analytical_sum = 0.0;
+        for (long long j = 0; j < M; j++) {
+            if (i > 0) N[j] *= factor[j];
+            sorted[j] = N[j];
+            sum += N[j];
+            analytical_sum += members.N0[j] * exp(-members.lambda[j] * tau);
+        }
+        double mean = sum / (double)M;
+        double m2 = 0.0;
+        for (long long j = 0; j < M; j++) m2 += (N[j] - mean) * (N[j] - mean);
+        double stddev = sqrt(m2 / (double)(M - 1));
+        double analytical_mean = analytical_sum / (double)M;
+
+        qsort(sorted, (size_t)M, sizeof(double), compare_double_ascending);
+        for (int q = 0; q < 5; q++) {
+            double h = (double)(M - 1) * quantiles[q];
+            long long k = (long long)floor(h);
+            double fraction = h - (double)k;
+            double expected = (fraction > 0.0) ? sorted[k] + fraction * (sorted[k + 1] - sorted[k]) : sorted[k];
+            if (serial.quantile[q][i] != expected) quantile_mismatches++;
+        }
+        double mean_error = fabs(serial.N_mean[i] - mean) / mean;
+        double stddev_error = fabs(serial.N_stddev[i] - stddev) / stddev;
+        double analytical_error = fabs(serial.N_analytical_mean[i] - analytical_mean) / analytical_mean;
+        if (mean_error > worst_mean) worst_mean = mean_error;
+        if (stddev_error > worst_stddev) worst_stddev = stddev_error;
+        if (analytical_error > worst_analytical) worst_analytical = analytical_error;
+    }
+    ok = ok && quantile_mismatches == 0 && worst_mean <= 1e-12 && worst_stddev <= 1e-10 &&
+         worst_analytical <= 1e-12;
+    printf("  terperturbasi %lld anggota (rk4) vs brute force: kuantil berbeda = %d, error mean = %.1e, "
+           "simp. baku = %.1e, mean analitik = %.1e -> %s\n",
+           M, quantile_mismatches, worst_mean, worst_stddev, worst_analytical, ok ? "LOLOS" : "GAGAL");
+    if (!ok) failures++;
+
+    // (3) 1 thread vs 4 thread
+    int identical = serial_steps > 0 && threaded_steps == serial_steps;
+    if (identical) {
+        size_t bytes = (size_t)serial.num_rows * sizeof(double);
+        identical = memcmp(serial.N_mean, threaded.N_mean, bytes) == 0 &&
+                    memcmp(serial.N_stddev, threaded.N_stddev, bytes) == 0 &&
+                    memcmp(serial.N_analytical_mean, threaded.N_analytical_mean, bytes) == 0;
+        for (int q = 0; q < 5; q++) {
+            identical = identical && memcmp(serial.quantile[q], threaded.quantile[q], bytes) == 0;
+        }
+    }
+    printf("  ensemble 1 thread vs 4 thread: %s -> %s\n",
+           identical ? "identik bit-per-bit" : "BERBEDA", identical ? "LOLOS" : "GAGAL");
+    if (!identical) failures++;
+
+    if (serial_steps > 0) ensemble_results_free(&serial);
+    if (threaded_steps > 0) ensemble_results_free(&threaded);
+    ensemble_members_free(&members);
+    free(N);
+    free(factor);
+    free(sorted);
+    return failures > 0 ? 1 : 0;
+}
+
+/**
+ * JARAK ULP ANTARA DUA DOUBLE
+ * ===========================
+ * Representasi bit dipetakan ke integer berurutan sehingga selisihnya adalah
+ * jumlah double yang dapat direpresentasikan di antara kedua nilai.
+ */
+static double ulp_distance(double a, double b) {
+    long long ia, ib;
+    memcpy(&ia, &a, sizeof(ia));
+    memcpy(&ib, &b, sizeof(ib));
+    if (ia < 0) ia = LLONG_MIN - ia;
+    if (ib < 0) ib = LLONG_MIN - ib;
+    return (ia > ib) ? (double)(ia - ib) : (double)(ib - ia);
+}
+
+/**
+ * VERIFIKASI BATAS ULP KERNEL EXP TERVEKTORISASI
+ * ==============================================
+ * 
+ * Membandingkan vexp terhadap exp() libm pada grid padat di rentang yang
+ * dipakai simulasi (-λt di [-5, 0]) dan di seluruh rentang normal [-745, 709],
+ * untuk setiap jalur ISA yang didukung CPU.
+ * 
+ * Return:
+ * @return int - 0 jika error maksimum <= VEXP_MAX_ULP, 1 jika tidak
+ */
+static int verify_vexp_ulp(void) {
+    const int num_points = 1 << 20;
+    const double ranges[][2] = { { -5.0, 0.0 }, { -745.0, 709.0 } };
+    int failures = 0;
+
+    double* x = (double*)malloc(num_points * sizeof(double));
+    double* y = (double*)malloc(num_points * sizeof(double));
+    if (x == NULL || y == NULL) {
+        printf("Error: Gagal mengalokasikan memori untuk verifikasi exp.\n");
+        free(x);
+        free(y);
+        return 1;
+    }
+
+    printf("Verifikasi kernel exp tervektorisasi terhadap libm (batas %.1f ULP):\n", VEXP_MAX_ULP);
+    for (int isa = VEXP_ISA_SCALAR; isa <= (int)vexp_detect_isa(); isa++) {
+        for (size_t r = 0; r < sizeof(ranges) / sizeof(ranges[0]); r++) {
+            double lo = ranges[r][0], hi = ranges[r][1];
+            for (int i = 0; i < num_points; i++) {
+                x[i] = lo + (hi - lo) * ((double)i / (num_points - 1));
+            }
+            vexp_array_isa((VexpIsa)isa, x, y, num_points);
+
+            double max_ulp = 0.0;
+            for (int i = 0; i < num_points; i++) {
+                double d = ulp_distance(y[i], exp(x[i]));
+                if (d > max_ulp) max_ulp = d;
+            }
+
+            int ok = max_ulp <= VEXP_MAX_ULP;
+            printf("  %-6s x di [%7.1f, %5.1f]: error maks = %.0f ULP -> %s\n",
+                   vexp_isa_name((VexpIsa)isa), lo, hi, max_ulp, ok ? "LOLOS" : "GAGAL");
+            if (!ok) failures++;
+        }
+    }
+
+    free(x);
+    free(y);
+    return failures > 0 ? 1 : 0;
+}
+
+// Jumlah konversi CSV (%.4f, %.6f, %.6e) yang hasilnya berbeda dari snprintf
+static int csv_format_mismatches(double value) {
+    char expected[FORMAT_MAX_BYTES], actual[FORMAT_MAX_BYTES];
+    int mismatches = 0;
+    size_t n;
+
+    n = format_fixed(actual, value, 4);
+    mismatches += n != (size_t)snprintf(expected, sizeof(expected), "%.4f", value) ||
+                  memcmp(expected, actual, n) != 0;
+    n = format_fixed(actual, value, 6);
+    mismatches += n != (size_t)snprintf(expected, sizeof(expected), "%.6f", value) ||
+                  memcmp(expected, actual, n) != 0;
+    n = format_exponent(actual, value, 6);
+    mismatches += n != (size_t)snprintf(expected, sizeof(expected), "%.6e", value) ||
+                  memcmp(expected, actual, n) != 0;
+    return mismatches;
+}
+
+/**
+ * VERIFIKASI FORMATTER CSV TERHADAP snprintf
+ * ==========================================
+ * 
+ * Membandingkan format_fixed / format_exponent dengan snprintf untuk ketiga
+ * konversi yang dipakai CSV (%.4f, %.6f, %.6e) pada pola bit acak, nilai
+ * tepat-setengah (kasus pembulatan ke genap), dan nilai hasil simulasi.
+ * 
+ * Return:
+ * @return int - 0 jika semua keluaran identik byte-per-byte, 1 jika tidak
+ */
+static int verify_csv_format(double N0, double lambda, double t0, double tf, double delta_t) {
+    const int num_random = 1 << 20;
+    long long mismatches = 0;
+
+    // Pola bit acak (xorshift64), mencakup subnormal, NaN, dan tak hingga
+    unsigned long long state = 0x9E3779B97F4A7C15ull;
+    for (int i = 0; i < num_random; i++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        double x;
+        memcpy(&x, &state, sizeof(x));
+        mismatches += csv_format_mismatches(x);
+    }
+
+    // Nilai dengan magnitudo yang realistis dan tepat-setengah pada digit terakhir
+    for (int i = 0; i < num_random; i++) {
+        double x = (double)i * 0.00005;
+        mismatches += csv_format_mismatches(x);
+        mismatches += csv_format_mismatches(-x);
+        mismatches += csv_format_mismatches((double)i + 0.5);
+        mismatches += csv_format_mismatches(ldexp((double)(i | 1), -(i % 40)));
+    }
+
+    // Seluruh baris satu simulasi (nilai persis seperti yang masuk ke CSV)
+    SimulationResults results = results_empty(RESULT_LAYOUT_AOS);
+    euler_radioactive_decay(N0, lambda, t0, tf, delta_t, &results, EULER_MODE_SEQUENTIAL);
+    for (int i = 0; i < results.num_rows; i++) {
+        SimulationStep row = results_row(&results, i);
+        mismatches += csv_format_mismatches(row.time_s);
+        mismatches += csv_format_mismatches(row.N_numerical);
+        mismatches += csv_format_mismatches(row.N_analytical);
+        mismatches += csv_format_mismatches(row.error_absolute);
+        mismatches += csv_format_mismatches(row.error_relative_percent);
+    }
+    long long checked = 3LL * (5LL * num_random + 5LL * results.num_rows);
+    results_free(&results);
+
+    printf("Verifikasi formatter CSV terhadap snprintf: %lld konversi, %lld berbeda -> %s\n",
+           checked, mismatches, mismatches == 0 ? "LOLOS" : "GAGAL");
+    return mismatches > 0 ? 1 : 0;
+}
+
+// Membaca integer / double little-endian dari file biner
+static unsigned long long read_u64_le(const unsigned char* in) {
+    unsigned long long value = 0;
+    for (int b = 0; b < 8; b++) value |= (unsigned long long)in[b] << (8 * b);
+    return value;
+}
+
+static double read_f64_le(const unsigned char* in) {
+    unsigned long long bits = read_u64_le(in);
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/**
+ * VERIFIKASI FORMAT BINER KOLUMNAR
+ * ================================
+ * 
+ * Menulis satu kasus ke file biner dua kali: dari array penuh (AoS) dan dari
+ * mode streaming (SoA, banyak chunk). Kedua file harus identik byte-per-byte,
+ * header harus berisi metadata run, dan setiap kolom yang dibaca kembali harus
+ * sama persis dengan kontainer hasil.
+ * 
+ * Return:
+ * @return int - 0 jika lolos, 1 jika tidak
+ */
+static int verify_binary_output(double N0, double lambda, double t0, double tf, double delta_t) {
+    const char* filenames[2] = { "verify_materialized.bin", "verify_stream.bin" };
+    char method_label[BINARY_NAME_BYTES];
+    simulation_method_label(INTEGRATOR_EULER, EULER_MODE_SEQUENTIAL, method_label, sizeof(method_label));
+    OutputMetadata metadata = { N0, lambda, t0, delta_t, method_label };
+    int ok;
+
+    SimulationResults results = results_empty(RESULT_LAYOUT_AOS);
+    euler_radioactive_decay(N0, lambda, t0, tf, delta_t, &results, EULER_MODE_SEQUENTIAL);
+
+    BinaryWriter writer;
+    ok = binary_writer_open(&writer, filenames[0], &metadata, results.num_rows);
+    if (ok) {
+        int written = binary_writer_write_rows(&writer, &results, 0);
+        ok = binary_writer_close(&writer) && written;
+    }
+
+    BinaryWriter stream_writer;
+    ok = ok && binary_writer_open(&stream_writer, filenames[1], &metadata, results.num_rows);
+    if (ok) {
+        ResultSink sink = { binary_sink_consume, &stream_writer };
+        int steps = euler_radioactive_decay_stream(N0, lambda, t0, tf, delta_t,
+                                                   EULER_MODE_SEQUENTIAL, RESULT_LAYOUT_SOA, &sink, 1);
+        ok = binary_writer_close(&stream_writer) && steps == results.num_rows - 1;
+    }
+
+    // BACA KEMBALI KEDUA FILE
+    // =======================
+    size_t header_bytes = BINARY_HEADER_BYTES(SIMULATION_NUM_COLUMNS);
+    size_t file_bytes = header_bytes + SIMULATION_NUM_COLUMNS * (size_t)results.num_rows * sizeof(double);
+    unsigned char* contents[2] = { malloc(file_bytes), malloc(file_bytes) };
+    for (int f = 0; f < 2 && ok; f++) {
+        FILE* fp = fopen(filenames[f], "rb");
+        ok = contents[f] != NULL && fp != NULL &&
+             fread(contents[f], 1, file_bytes, fp) == file_bytes && fgetc(fp) == EOF;
+        if (fp != NULL) fclose(fp);
+    }
+    ok = ok && memcmp(contents[0], contents[1], file_bytes) == 0;
+
+    // Header dan kolom
+    if (ok) {
+        const unsigned char* header = contents[0];
+        ok = memcmp(header, BINARY_MAGIC, 8) == 0 &&
+             read_u64_le(header + 8) == (BINARY_FORMAT_VERSION | ((unsigned long long)header_bytes << 32)) &&
+             read_u64_le(header + 16) == (unsigned long long)results.num_rows &&
+             read_f64_le(header + 32) == N0 && read_f64_le(header + 56) == delta_t &&
+             strcmp((const char*)header + 64, metadata.method) == 0;
+
+        for (int i = 0; i < results.num_rows && ok; i++) {
+            SimulationStep row = results_row(&results, i);
+            double stored[SIMULATION_NUM_COLUMNS];
+            for (size_t c = 0; c < SIMULATION_NUM_COLUMNS; c++) {
+                stored[c] = read_f64_le(contents[0] + header_bytes +
+                                        (c * (size_t)results.num_rows + (size_t)i) * sizeof(double));
+            }
+            ok = memcmp(stored, &row, sizeof(row)) == 0;
+        }
+    }
+
+    printf("Verifikasi format biner: %d baris, array penuh vs streaming -> %s\n",
+           results.num_rows, ok ? "LOLOS" : "GAGAL");
+
+    free(contents[0]);
+    free(contents[1]);
+    results_free(&results);
+    remove(filenames[0]);
+    remove(filenames[1]);
+    return ok ? 0 : 1;
+}
+
+/**
+ * VERIFIKASI PUSTAKA DATA NUKLIDA
+ * ===============================
+ * 
+ * Pustaka sintetis ~3000 nuklida (ditambah rantai Rn-222 dengan nilai
+ * chain_radon222) ditulis sebagai teks, dimuat, dikompilasi ke image biner,
+ * lalu image dimuat kembali (mmap). Keduanya harus identik byte-per-byte,
+ * setiap nuklida harus ditemukan menurut ZAI dan nama kanonik, ZAI yang tidak
+ * ada harus menghasilkan NULL, rantai dari pustaka harus sama dengan
+ * chain_radon222, jaringan dari pustaka harus memuat setiap cabang dan
+ * menjaga jumlah atom, dan image dengan indeks atau record rusak harus
+ * ditolak.
+ * 
+ * Return:
+ * @return int - 0 jika lolos, 1 jika tidak
+ */
+static int verify_nuclide_library(double N0, double T_half) {
+    const char* filenames[2] = { "verify_nuclides.txt", "verify_nuclides.bin" };
+    enum { FILLER_Z = 100, FILLER_PER_Z = 30 };
+
+    // Rantai Rn-222 (Bi-210 sengaja tidak ada sehingga rantai berhenti di
+    // Pb-210, At-218 tidak ada untuk menguji anak di luar pustaka), lalu
+    // nuklida sintetis Z = 1..100, A = 2Z..2Z+29, tiap ke-7 stabil
+    FILE* fp = fopen(filenames[0], "w");
+    int ok = fp != NULL;
+    if (ok) {
+        fprintf(fp, "# Pustaka verifikasi\n");
+        fprintf(fp, "Rn-222 %.17gs alpha:Po-218:1\n", T_half);
+        fprintf(fp, "po218  3.098m alpha:Pb-214:0.9998 beta-:At-218:0.0002\n");
+        fprintf(fp, "Pb-214 26.8m beta-:Bi-214:1\n");
+        fprintf(fp, "Bi-214 19.9m beta-:Po-214:0.99979 alpha:Tl-210:0.00021\n");
+        fprintf(fp, "Po-214 164.3e-6s alpha:Pb-210:1\n");
+        fprintf(fp, "Pb-210 22.2y beta-:Bi-210:1\n");
+        for (uint32_t z = 1; z <= FILLER_Z; z++) {
+            for (uint32_t k = 0; k < FILLER_PER_Z; k++) {
+                uint32_t zai = z * 10000u + (2u * z + k) * 10u;
+                char name[NUCLIDE_NAME_BYTES], daughter[NUCLIDE_NAME_BYTES];
+                nuclide_name_from_zai(zai, name, sizeof(name));
+                nuclide_name_from_zai(zai + 10000u, daughter, sizeof(daughter));
+                if (zai % 7 == 0) {
+                    fprintf(fp, "%s stable\n", name);
+                } else {
+                    fprintf(fp, "%s %.17gs beta-:%s:1\n", name, 1.0 + (double)(zai % 9973u), daughter);
+                }
+            }
+        }
+        ok = fclose(fp) == 0;
+    }
+
+    NuclideLibrary libraries[2];
+    memset(libraries, 0, sizeof(libraries));
+    double load_seconds[2] = { 0.0, 0.0 };
+    double start = stats_now();
+    ok = ok && nuclide_library_load(&libraries[0], filenames[0]);
+    load_seconds[0] = stats_now() - start;
+    ok = ok && nuclide_library_write_image(&libraries[0], filenames[1]);
+    start = stats_now();
+    ok = ok && nuclide_library_load(&libraries[1], filenames[1]);
+    load_seconds[1] = stats_now() - start;
+
+    ok = ok && libraries[0].num_nuclides == 6 + FILLER_Z * FILLER_PER_Z &&
+         libraries[0].block_bytes == libraries[1].block_bytes &&
+         memcmp(libraries[0].block, libraries[1].block, libraries[0].block_bytes) == 0;
+
+    // Pencarian menurut ZAI, nama kanonik, dan ZAI yang tidak ada
+    for (int l = 0; l < 2 && ok; l++) {
+        const NuclideLibrary* library = &libraries[l];
+        for (uint32_t i = 0; i < library->num_nuclides && ok; i++) {
+            const NuclideRecord* record = &library->records[i];
+            ok = nuclide_find_zai(library, record->zai) == record &&
+                 nuclide_find(library, record->name) == record &&
+                 nuclide_find_zai(library, record->zai + 1) == NULL;
+        }
+        const NuclideRecord* radon = nuclide_find(library, "Rn-222");
+        ok = ok && radon != NULL && nuclide_find(library, "rn222") == radon &&
+             nuclide_find(library, "862220") == radon && nuclide_find(library, "Bi-210") == NULL &&
+             nuclide_find(library, "Xx-1") == NULL;
+    }
+
+    // Rantai dari pustaka vs chain_radon222
+    double worst_half_life = 0.0;
+    if (ok) {
+        DecayChain reference, loaded;
+        chain_radon222(&reference, N0, T_half);
+        int species = nuclide_library_chain(&libraries[1], nuclide_find(&libraries[1], "Rn-222"), N0, &loaded);
+        ok = species == reference.num_species;
+        for (int s = 0; s < species && ok; s++) {
+            double deviation = fabs(loaded.species[s].half_life_s - reference.species[s].half_life_s) /
+                               reference.species[s].half_life_s;
+            if (deviation > worst_half_life) worst_half_life = deviation;
+            ok = strcmp(loaded.species[s].name, reference.species[s].name) == 0 &&
+                 loaded.species[s].branching == reference.species[s].branching &&
+                 loaded.species[s].N0 == reference.species[s].N0;
+        }
+        ok = ok && worst_half_life <= 4.0 * DBL_EPSILON;
+    }
+
+    // Jaringan dari pustaka: setiap record dan setiap cabang (termasuk cabang
+    // minor Po-218 -> At-218, anak di luar pustaka sebagai ujung stabil), dan
+    // satu step CRAM dari Rn-222 menjaga jumlah atom
+    double network_conservation = INFINITY;
+    if (ok) {
+        const NuclideLibrary* library = &libraries[1];
+        DecayNetwork network;
+        ok = nuclide_library_network(library, &network);
+        uint32_t num_branches = 0;
+        for (uint32_t i = 0; i < library->num_nuclides && ok; i++) {
+            ok = strcmp(network.names[i], library->records[i].name) == 0;
+            num_branches += library->records[i].num_branches;
+        }
+        int astatine = ok ? network_find(&network, "At-218") : -1;
+        ok = ok && network.num_transitions == (int)num_branches &&
+             astatine >= (int)library->num_nuclides && isinf(network.half_life_s[astatine]);
+
+        NetworkSolver solver;
+        double* N = ok ? (double*)calloc((size_t)network.num_nuclides, sizeof(double)) : NULL;
+        ok = ok && N != NULL && network_solver_init(&solver, &network);
+        if (ok) {
+            N[nuclide_find(library, "Rn-222") - library->records] = N0;
+            network_solver_step(&solver, 4.0 * T_half, N, N);
+            double total = 0.0;
+            for (int i = 0; i < network.num_nuclides; i++) total += N[i];
+            network_conservation = fabs(total - N0) / N0;
+            ok = network_conservation < 1e-12 && N[astatine] > 0.0;
+            network_solver_free(&solver);
+        }
+        free(N);
+        network_free(&network);
+    }
+
+    // Image rusak harus ditolak saat dimuat (bukan macet saat pencarian):
+    // semua slot indeks berisi entri 1 (tanpa slot kosong), satu slot terisi
+    // dikosongkan (record tidak terjangkau), waktu paruh NaN, satu record
+    // dirujuk dua slot sementara record lain tidak terjangkau (jumlah slot
+    // terisi tetap n), dan offset record yang membuat offset + ukuran overflow
+    enum { NUM_CORRUPTIONS = 5 };
+    int rejected = 0;
+    size_t image_bytes = libraries[0].block_bytes;
+    unsigned char* corrupt = ok ? (unsigned char*)malloc(image_bytes) : NULL;
+    for (int c = 0; c < NUM_CORRUPTIONS && corrupt != NULL; c++) {
+        memcpy(corrupt, libraries[0].block, image_bytes);
+        NuclideImageHeader* header = (NuclideImageHeader*)corrupt;
+        uint32_t* index = (uint32_t*)(corrupt + header->index_offset);
+        NuclideRecord* records = (NuclideRecord*)(corrupt + header->records_offset);
+        if (c == 0) {
+            for (uint32_t s = 0; s < header->index_slots; s++) index[s] = 1;
+        } else if (c == 1) {
+            uint32_t s = 0;
+            while (index[s] == 0) s++;
+            index[s] = 0;
+        } else if (c == 2) {
+            records[0].half_life_s = NAN;
+        } else if (c == 3) {
+            // Entri slot s disalin ke slot kosong berikutnya (masih dalam run
+            // probe-nya), lalu record lain yang sendirian di run-nya dihapus
+            uint32_t mask = header->index_slots - 1, s = 0;
+            while (index[s] == 0 || index[(s + 1) & mask] != 0) s++;
+            uint32_t duplicate = (s + 1) & mask;
+            index[duplicate] = index[s];
+            for (uint32_t u = 0; u < header->index_slots; u++) {
+                if (u == s || u == duplicate || index[u] == 0) continue;
+                if (index[(u - 1) & mask] == 0 && index[(u + 1) & mask] == 0) {
+                    index[u] = 0;
+                    break;
+                }
+            }
+        } else {
+            header->records_offset = UINT64_MAX - 47;
+        }
+
+        FILE* image = fopen(filenames[1], "wb");
+        int written = image != NULL && fwrite(corrupt, 1, image_bytes, image) == image_bytes;
+        if (image != NULL && fclose(image) != 0) written = 0;
+        NuclideLibrary damaged;
+        if (!written) break;
+        if (nuclide_library_load(&damaged, filenames[1])) {
+            nuclide_library_free(&damaged);
+        } else {
+            rejected++;
+        }
+    }
+    free(corrupt);
+    ok = ok && rejected == NUM_CORRUPTIONS;
+
+    printf("Verifikasi pustaka nuklida: %u nuklida, muat teks %.3f ms, image (%s) %.3f ms, "
+           "pencarian ZAI/nama dan rantai Rn-222 (deviasi waktu paruh %.1e), kekekalan atom jaringan %.1e, "
+           "image rusak ditolak %d/%d -> %s\n",
+           libraries[0].num_nuclides, load_seconds[0] * 1e3, libraries[1].mapped ? "mmap" : "dibaca",
+           load_seconds[1] * 1e3, worst_half_life, network_conservation, rejected, NUM_CORRUPTIONS, ok ? "LOLOS" : "GAGAL");
+
+    nuclide_library_free(&libraries[0]);
+    nuclide_library_free(&libraries[1]);
+    remove(filenames[0]);
+    remove(filenames[1]);
+    return ok ? 0 : 1;
+}
+
+/**
+ * FUNGSI UTAMA PROGRAM UJI
+ * ========================
+ * 
+ * Parameter fisik dan sweep dari opsi (default Rn-222, sweep default) ditambah
+ * satu kasus halus T/250000 (10^6 step) untuk mode langsung, formatter CSV,
+ * dan format biner.
+ */
+int main(int argc, char** argv) {
+    RunOptions options;
+    run_options_init(&options);
+    CliStatus status = run_options_parse_args(&options, argc, argv);
+    if (status != CLI_RUN) {
+        run_options_free(&options);
+        return (status == CLI_EXIT_SUCCESS) ? 0 : 1;
+    }
+
+    double N0 = options.N0;
+    double T_half = options.half_life_s;
+    double lambda = options.lambda;
+    double t_start = options.t_start;
+    double t_end = options.t_end;
+    int num_cases = options.delta_t_sweep.count;
+
+    double* delta_t = (double*)malloc((size_t)(num_cases + 1) * sizeof(double));
+    if (delta_t == NULL) {
+        printf("Error: Gagal mengalokasikan memori untuk verifikasi.\n");
+        run_options_free(&options);
+        return 1;
+    }
+    memcpy(delta_t, options.delta_t_sweep.values, (size_t)num_cases * sizeof(double));
+    delta_t[num_cases] = T_half / 250000.0;
+
+    int direct_failed = verify_direct_mode(N0, lambda, t_start, t_end, delta_t, num_cases + 1);
+    int integrator_failed = verify_integrators(N0, lambda, t_start, t_end, T_half / 10.0);
+    int convergence_failed = verify_convergence(N0, lambda, t_start, t_end, T_half / 10.0);
+    int target_failed = verify_target_search(N0, lambda, t_start, t_end);
+    int adaptive_failed = verify_adaptive(N0, lambda, t_start, t_end);
+    int precision_failed = verify_precision_modes(N0, lambda, t_start, t_end);
+    int chain_failed = verify_chain(N0, T_half, t_start, t_end);
+    int network_failed = verify_network(N0, T_half, t_start, t_end);
+    int stochastic_failed = verify_stochastic(lambda, t_start, t_end);
+    int ensemble_failed = verify_ensemble(N0, lambda, t_start, t_end);
+    int vexp_failed = verify_vexp_ulp();
+    int csv_failed = verify_csv_format(N0, lambda, t_start, t_end, delta_t[num_cases]);
+    int binary_failed = verify_binary_output(N0, lambda, t_start, t_end, delta_t[num_cases]);
+    int nuclide_failed = verify_nuclide_library(N0, T_half);
+
+    free(delta_t);
+    run_options_free(&options);
+    return (direct_failed || integrator_failed || convergence_failed || target_failed ||
+            adaptive_failed || precision_failed || chain_failed || network_failed ||
+            stochastic_failed || ensemble_failed || vexp_failed ||
+            csv_failed || binary_failed || nuclide_failed) ? 1 : 0;
+}
@@ -0,0 +1,424 @@
+/**
+ * ========================================================================
+ * IMPLEMENTASI KERNEL EKSPONENSIAL TERVEKTORISASI
+ * ========================================================================
+ *
+ * Lihat vexp.h untuk deskripsi algoritma dan batas akurasi. Jalur AVX2 dan
+ * AVX-512 dikompilasi dengan atribut target GCC/Clang sehingga file ini tidak
+ * membutuhkan flag -mavx2 / -mavx512f; pemilihan jalur dilakukan saat runtime
+ * dengan __builtin_cpu_supports().
+ */
+
+#include "vexp.h"
+
+#include <math.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <stdint.h>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define VEXP_HAVE_X86 1
+#include <immintrin.h>
+#else
+#define VEXP_HAVE_X86 0
+#endif
+
+// KONSTANTA REDUKSI ARGUMEN
+// =========================
+// ln2_hi hanya memiliki 32 bit signifikan sehingga k * ln2_hi eksak untuk |k| < 2^20
+#define VEXP_LOG2E   1.4426950408889634074
+#define VEXP_LN2_HI  6.93147180369123816490e-01
+#define VEXP_LN2_LO  1.90821492927058770002e-10
+#define VEXP_SHIFTER 6755399441055744.0      // 1.5 * 2^52, untuk pembulatan ke integer
+#define VEXP_LIMIT   708.0                   // di luar |x| <= 708 pakai libm
+
+// KOEFISIEN TAYLOR 1/k! UNTUK e^r, k = 2..13
+// ==========================================
+#define VEXP_C2  5.00000000000000000000e-01
+#define VEXP_C3  1.66666666666666666667e-01
+#define VEXP_C4  4.16666666666666666667e-02
+#define VEXP_C5  8.33333333333333333333e-03
+#define VEXP_C6  1.38888888888888888889e-03
+#define VEXP_C7  1.98412698412698412698e-04
+#define VEXP_C8  2.48015873015873015873e-05
+#define VEXP_C9  2.75573192239858906526e-06
+#define VEXP_C10 2.75573192239858906526e-07
+#define VEXP_C11 2.50521083854417187751e-08
+#define VEXP_C12 2.08767569878680989792e-09
+#define VEXP_C13 1.60590438368216145994e-10
+
+// ISA terdeteksi dan ISA aktif; -1 = belum ditentukan. Atomik karena
+// vexp_array dipanggil dari thread pekerja (sweep, ensemble) tanpa
+// inisialisasi di muka; deteksi idempoten sehingga balapan pertama aman.
+static _Atomic int vexp_supported_isa = -1;
+static _Atomic int vexp_current_isa = -1;
+
+/**
+ * JALUR SKALAR
+ * ============
+ * Algoritma yang sama dengan jalur SIMD, dipakai sebagai fallback dan untuk
+ * sisa elemen yang tidak memenuhi satu vektor penuh.
+ */
+static double vexp_scalar(double x) {
+    if (!(fabs(x) <= VEXP_LIMIT)) {
+        return exp(x);
+    }
+
+    double kd = x * VEXP_LOG2E + VEXP_SHIFTER;
+    uint64_t ki;
+    memcpy(&ki, &kd, sizeof(ki));
+    kd -= VEXP_SHIFTER;
+
+    double r = (x - kd * VEXP_LN2_HI) - kd * VEXP_LN2_LO;
+
+    double p = VEXP_C13;
+    p = p * r + VEXP_C12;
+    p = p * r + VEXP_C11;
+    p = p * r + VEXP_C10;
+    p = p * r + VEXP_C9;
+    p = p * r + VEXP_C8;
+    p = p * r + VEXP_C7;
+    p = p * r + VEXP_C6;
+    p = p * r + VEXP_C5;
+    p = p * r + VEXP_C4;
+    p = p * r + VEXP_C3;
+    p = p * r + VEXP_C2;
+    p = p * r + 1.0;
+    p = p * r + 1.0;
+
+    // 2^k: 12 bit terbawah (k + 1023) digeser ke posisi eksponen
+    uint64_t scale_bits = (ki + 1023u) << 52;
+    double scale;
+    memcpy(&scale, &scale_bits, sizeof(scale));
+    return p * scale;
+}
+
+static void vexp_array_scalar(const double* x, double* y, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        y[i] = vexp_scalar(x[i]);
+    }
+}
+
+static void vexp_fill_analytic_scalar(
+    double N0, double lambda,
+    const double* time_s, const double* N_numerical,
+    double* N_analytical, double* error_absolute, double* error_relative,
+    size_t stride, size_t begin, size_t n
+) {
+    for (size_t i = begin; i < n; i++) {
+        size_t k = i * stride;
+        double N_exact = N0 * vexp_scalar(-lambda * time_s[k]);
+        double abs_error = fabs(N_numerical[k] - N_exact);
+        N_analytical[k] = N_exact;
+        error_absolute[k] = abs_error;
+        error_relative[k] = (N_exact != 0.0) ? (abs_error / N_exact) * 100.0 : 0.0;
+    }
+}
+
+#if VEXP_HAVE_X86
+
+/**
+ * JALUR AVX2 + FMA (4 LANE)
+ * =========================
+ */
+__attribute__((target("avx2,fma")))
+static __m256d vexp_avx2(__m256d x) {
+    const __m256d abs_mask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7fffffffffffffffLL));
+    const __m256d shifter = _mm256_set1_pd(VEXP_SHIFTER);
+
+    __m256d kd = _mm256_fmadd_pd(x, _mm256_set1_pd(VEXP_LOG2E), shifter);
+    __m256i ki = _mm256_castpd_si256(kd);
+    kd = _mm256_sub_pd(kd, shifter);
+
+    __m256d r = _mm256_fnmadd_pd(kd, _mm256_set1_pd(VEXP_LN2_HI), x);
+    r = _mm256_fnmadd_pd(kd, _mm256_set1_pd(VEXP_LN2_LO), r);
+
+    __m256d p = _mm256_set1_pd(VEXP_C13);
+    p = _mm256_fmadd_pd(p, r, _mm256_set1_pd(VEXP_C12));
+    p = _mm256_fmadd_pd(p, r, _mm256_set1_pd(VEXP_C11));
+    p = _mm256_fmadd_pd(p, r, _mm256_set1_pd(VEXP_C10));
+    p = _mm256_fmadd_pd(p, r, _mm256_set1_pd(VEXP_C9));
+    p = _mm256_fmadd_pd(p, r, _mm256_set1_pd(VEXP_C8));
+    p = _mm256_fmadd_pd(p, r, _mm256_set1_pd(VEXP_C7));
+    p = _mm256_fmadd_pd(p, r, _mm256_set1_pd(VEXP_C6));
+    p = _mm256_fmadd_pd(p, r, _mm256_set1_pd(VEXP_C5));
+    p = _mm256_fmadd_pd(p, r, _mm256_set1_pd(VEXP_C4));
+    p = _mm256_fmadd_pd(p, r, _mm256_set1_pd(VEXP_C3));
+    p = _mm256_fmadd_pd(p, r, _mm256_set1_pd(VEXP_C2));
+    p = _mm256_fmadd_pd(p, r, _mm256_set1_pd(1.0));
+    p = _mm256_fmadd_pd(p, r, _mm256_set1_pd(1.0));
+
+    __m256i scale_bits = _mm256_slli_epi64(_mm256_add_epi64(ki, _mm256_set1_epi64x(1023)), 52);
+    __m256d y = _mm256_mul_pd(p, _mm256_castsi256_pd(scale_bits));
+
+    // Lane di luar rentang aman (atau NaN) dihitung ulang dengan libm
+    __m256d in_range = _mm256_cmp_pd(_mm256_and_pd(x, abs_mask), _mm256_set1_pd(VEXP_LIMIT), _CMP_LE_OQ);
+    if (_mm256_movemask_pd(in_range) != 0xF) {
+        double xs[4], ys[4];
+        _mm256_storeu_pd(xs, x);
+        _mm256_storeu_pd(ys, y);
+        for (int l = 0; l < 4; l++) {
+            if (!(fabs(xs[l]) <= VEXP_LIMIT)) ys[l] = exp(xs[l]);
+        }
+        y = _mm256_loadu_pd(ys);
+    }
+    return y;
+}
+
+__attribute__((target("avx2,fma")))
+static void vexp_array_avx2(const double* x, double* y, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_pd(y + i, vexp_avx2(_mm256_loadu_pd(x + i)));
+    }
+    vexp_array_scalar(x + i, y + i, n - i);
+}
+
+__attribute__((target("avx2,fma")))
+static void vexp_fill_analytic_avx2(
+    double N0, double lambda,
+    const double* time_s, const double* N_numerical,
+    double* N_analytical, double* error_absolute, double* error_relative,
+    size_t stride, size_t n
+) {
+    const __m256d v_N0 = _mm256_set1_pd(N0);
+    const __m256d v_neg_lambda = _mm256_set1_pd(-lambda);
+    const __m256d v_hundred = _mm256_set1_pd(100.0);
+    const __m256d v_zero = _mm256_setzero_pd();
+    const __m256d abs_mask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7fffffffffffffffLL));
+    const long long s = (long long)stride;
+    const __m256i gather_index = _mm256_set_epi64x(3 * s, 2 * s, s, 0);
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        size_t k = i * stride;
+        __m256d t, N_num;
+        if (stride == 1) {
+            t = _mm256_loadu_pd(time_s + k);
+            N_num = _mm256_loadu_pd(N_numerical + k);
+        } else {
+            t = _mm256_i64gather_pd(time_s + k, gather_index, 8);
+            N_num = _mm256_i64gather_pd(N_numerical + k, gather_index, 8);
+        }
+
+        __m256d N_exact = _mm256_mul_pd(v_N0, vexp_avx2(_mm256_mul_pd(v_neg_lambda, t)));
+        __m256d abs_error = _mm256_and_pd(_mm256_sub_pd(N_num, N_exact), abs_mask);
+        __m256d rel_error = _mm256_mul_pd(_mm256_div_pd(abs_error, N_exact), v_hundred);
+        rel_error = _mm256_and_pd(rel_error, _mm256_cmp_pd(N_exact, v_zero, _CMP_NEQ_UQ));
+
+        if (stride == 1) {
+            _mm256_storeu_pd(N_analytical + k, N_exact);
+            _mm256_storeu_pd(error_absolute + k, abs_error);
+            _mm256_storeu_pd(error_relative + k, rel_error);
+        } else {
+            // AVX2 tidak memiliki scatter: simpan per lane
+            double a[4], e[4], r[4];
+            _mm256_storeu_pd(a, N_exact);
+            _mm256_storeu_pd(e, abs_error);
+            _mm256_storeu_pd(r, rel_error);
+            for (int l = 0; l < 4; l++) {
+                N_analytical[k + l * stride] = a[l];
+                error_absolute[k + l * stride] = e[l];
+                error_relative[k + l * stride] = r[l];
+            }
+        }
+    }
+
+    vexp_fill_analytic_scalar(N0, lambda, time_s, N_numerical,
+                              N_analytical, error_absolute, error_relative, stride, i, n);
+}
+
+/**
+ * JALUR AVX-512F (8 LANE)
+ * =======================
+ */
+__attribute__((target("avx512f")))
+static __m512d vexp_avx512(__m512d x) {
+    const __m512d shifter = _mm512_set1_pd(VEXP_SHIFTER);
+
+    __m512d kd = _mm512_fmadd_pd(x, _mm512_set1_pd(VEXP_LOG2E), shifter);
+    __m512i ki = _mm512_castpd_si512(kd);
+    kd = _mm512_sub_pd(kd, shifter);
+
+    __m512d r = _mm512_fnmadd_pd(kd, _mm512_set1_pd(VEXP_LN2_HI), x);
+    r = _mm512_fnmadd_pd(kd, _mm512_set1_pd(VEXP_LN2_LO), r);
+
+    __m512d p = _mm512_set1_pd(VEXP_C13);
+    p = _mm512_fmadd_pd(p, r, _mm512_set1_pd(VEXP_C12));
+    p = _mm512_fmadd_pd(p, r, _mm512_set1_pd(VEXP_C11));
+    p = _mm512_fmadd_pd(p, r, _mm512_set1_pd(VEXP_C10));
+    p = _mm512_fmadd_pd(p, r, _mm512_set1_pd(VEXP_C9));
+    p = _mm512_fmadd_pd(p, r, _mm512_set1_pd(VEXP_C8));
+    p = _mm512_fmadd_pd(p, r, _mm512_set1_pd(VEXP_C7));
+    p = _mm512_fmadd_pd(p, r, _mm512_set1_pd(VEXP_C6));
+    p = _mm512_fmadd_pd(p, r, _mm512_set1_pd(VEXP_C5));
+    p = _mm512_fmadd_pd(p, r, _mm512_set1_pd(VEXP_C4));
+    p = _mm512_fmadd_pd(p, r, _mm512_set1_pd(VEXP_C3));
+    p = _mm512_fmadd_pd(p, r, _mm512_set1_pd(VEXP_C2));
+    p = _mm512_fmadd_pd(p, r, _mm512_set1_pd(1.0));
+    p = _mm512_fmadd_pd(p, r, _mm512_set1_pd(1.0));
+
+    __m512i scale_bits = _mm512_slli_epi64(_mm512_add_epi64(ki, _mm512_set1_epi64(1023)), 52);
+    __m512d y = _mm512_mul_pd(p, _mm512_castsi512_pd(scale_bits));
+
+    __mmask8 in_range = _mm512_cmp_pd_mask(_mm512_abs_pd(x), _mm512_set1_pd(VEXP_LIMIT), _CMP_LE_OQ);
+    if (in_range != 0xFF) {
+        double xs[8], ys[8];
+        _mm512_storeu_pd(xs, x);
+        _mm512_storeu_pd(ys, y);
+        for (int l = 0; l < 8; l++) {
+            if (!(fabs(xs[l]) <= VEXP_LIMIT)) ys[l] = exp(xs[l]);
+        }
+        y = _mm512_loadu_pd(ys);
+    }
+    return y;
+}
+
+__attribute__((target("avx512f")))
+static void vexp_array_avx512(const double* x, double* y, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm512_storeu_pd(y + i, vexp_avx512(_mm512_loadu_pd(x + i)));
+    }
+    vexp_array_scalar(x + i, y + i, n - i);
+}
+
+__attribute__((target("avx512f")))
+static void vexp_fill_analytic_avx512(
+    double N0, double lambda,
+    const double* time_s, const double* N_numerical,
+    double* N_analytical, double* error_absolute, double* error_relative,
+    size_t stride, size_t n
+) {
+    const __m512d v_N0 = _mm512_set1_pd(N0);
+    const __m512d v_neg_lambda = _mm512_set1_pd(-lambda);
+    const __m512d v_hundred = _mm512_set1_pd(100.0);
+    const long long s = (long long)stride;
+    const __m512i index = _mm512_set_epi64(7 * s, 6 * s, 5 * s, 4 * s, 3 * s, 2 * s, s, 0);
+
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        size_t k = i * stride;
+        __m512d t, N_num;
+        if (stride == 1) {
+            t = _mm512_loadu_pd(time_s + k);
+            N_num = _mm512_loadu_pd(N_numerical + k);
+        } else {
+            t = _mm512_i64gather_pd(index, time_s + k, 8);
+            N_num = _mm512_i64gather_pd(index, N_numerical + k, 8);
+        }
+
+        __m512d N_exact = _mm512_mul_pd(v_N0, vexp_avx512(_mm512_mul_pd(v_neg_lambda, t)));
+        __m512d abs_error = _mm512_abs_pd(_mm512_sub_pd(N_num, N_exact));
+        __mmask8 nonzero = _mm512_cmp_pd_mask(N_exact, _mm512_setzero_pd(), _CMP_NEQ_UQ);
+        __m512d rel_error = _mm512_maskz_mul_pd(nonzero, _mm512_div_pd(abs_error, N_exact), v_hundred);
+
+        if (stride == 1) {
+            _mm512_storeu_pd(N_analytical + k, N_exact);
+            _mm512_storeu_pd(error_absolute + k, abs_error);
+            _mm512_storeu_pd(error_relative + k, rel_error);
+        } else {
+            _mm512_i64scatter_pd(N_analytical + k, index, N_exact, 8);
+            _mm512_i64scatter_pd(error_absolute + k, index, abs_error, 8);
+            _mm512_i64scatter_pd(error_relative + k, index, rel_error, 8);
+        }
+    }
+
+    vexp_fill_analytic_scalar(N0, lambda, time_s, N_numerical,
+                              N_analytical, error_absolute, error_relative, stride, i, n);
+}
+
+#endif // VEXP_HAVE_X86
+
+/**
+ * DETEKSI DAN PEMILIHAN ISA
+ * =========================
+ */
+VexpIsa vexp_detect_isa(void) {
+    int supported = atomic_load_explicit(&vexp_supported_isa, memory_order_relaxed);
+    if (supported < 0) {
+        supported = VEXP_ISA_SCALAR;
+#if VEXP_HAVE_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            supported = VEXP_ISA_AVX512;
+        } else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            supported = VEXP_ISA_AVX2;
+        }
+#endif
+        atomic_store_explicit(&vexp_supported_isa, supported, memory_order_relaxed);
+    }
+    return (VexpIsa)supported;
+}
+
+VexpIsa vexp_active_isa(void) {
+    int isa = atomic_load_explicit(&vexp_current_isa, memory_order_relaxed);
+    if (isa < 0) {
+        // Tidak menimpa vexp_set_isa yang mungkin berjalan di antaranya
+        int expected = -1;
+        isa = (int)vexp_detect_isa();
+        if (!atomic_compare_exchange_strong(&vexp_current_isa, &expected, isa)) isa = expected;
+    }
+    return (VexpIsa)isa;
+}
+
+// Turunkan ISA yang diminta ke ISA terbaik yang didukung CPU
+static VexpIsa vexp_clamp_isa(VexpIsa isa) {
+    VexpIsa supported = vexp_detect_isa();
+    return (isa > supported) ? supported : isa;
+}
+
+VexpIsa vexp_set_isa(VexpIsa isa) {
+    VexpIsa active = vexp_clamp_isa(isa);
+    atomic_store(&vexp_current_isa, (int)active);
+    return active;
+}
+
+const char* vexp_isa_name(VexpIsa isa) {
+    switch (isa) {
+        case VEXP_ISA_AVX512: return "avx512";
+        case VEXP_ISA_AVX2:   return "avx2";
+        default:              return "scalar";
+    }
+}
+
+void vexp_array_isa(VexpIsa isa, const double* x, double* y, size_t n) {
+#if VEXP_HAVE_X86
+    switch (vexp_clamp_isa(isa)) {
+        case VEXP_ISA_AVX512: vexp_array_avx512(x, y, n); return;
+        case VEXP_ISA_AVX2:   vexp_array_avx2(x, y, n); return;
+        default: break;
+    }
+#else
+    (void)isa;
+#endif
+    vexp_array_scalar(x, y, n);
+}
+
+void vexp_array(const double* x, double* y, size_t n) {
+    vexp_array_isa(vexp_active_isa(), x, y, n);
+}
+
+void vexp_fill_analytic(
+    double N0, double lambda,
+    const double* time_s, const double* N_numerical,
+    double* N_analytical, double* error_absolute, double* error_relative,
+    size_t stride, size_t n
+) {
+#if VEXP_HAVE_X86
+    switch (vexp_active_isa()) {
+        case VEXP_ISA_AVX512:
+            vexp_fill_analytic_avx512(N0, lambda, time_s, N_numerical,
+                                      N_analytical, error_absolute, error_relative, stride, n);
+            return;
+        case VEXP_ISA_AVX2:
+            vexp_fill_analytic_avx2(N0, lambda, time_s, N_numerical,
+                                    N_analytical, error_absolute, error_relative, stride, n);
+            return;
+        default:
+            break;
+    }
+#endif
+    vexp_fill_analytic_scalar(N0, lambda, time_s, N_numerical,
+                              N_analytical, error_absolute, error_relative, stride, 0, n);
+}
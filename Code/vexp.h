@@ -0,0 +1,109 @@
+/**
+ * ========================================================================
+ * KERNEL EKSPONENSIAL TERVEKTORISASI (AVX2 / AVX-512 / SKALAR)
+ * ========================================================================
+ *
+ * Modul ini menghitung exp(x) untuk seluruh array sekaligus dan mengisi kolom
+ * solusi analitik serta kolom error hasil simulasi dalam satu lintasan.
+ * Implementasi dipilih saat runtime sesuai kemampuan CPU:
+ *
+ * - AVX-512F   : 8 double per instruksi
+ * - AVX2 + FMA : 4 double per instruksi
+ * - Skalar     : fallback portabel (algoritma yang sama, tanpa intrinsik)
+ *
+ * Algoritma: reduksi argumen x = k*ln2 + r (Cody-Waite, |r| <= ln2/2),
+ * polinomial Taylor derajat 13 untuk e^r (Horner), lalu skala 2^k melalui
+ * manipulasi bit eksponen. Lane dengan |x| > 708 (mendekati overflow /
+ * underflow / subnormal) dan NaN dihitung ulang dengan exp() dari libm.
+ *
+ * BATAS AKURASI: untuk semua x berhingga, |vexp(x) - exp(x)| <= VEXP_MAX_ULP
+ * ULP relatif terhadap exp() libm. Batas ini diperiksa oleh program uji
+ * `build/test` (ctest verify) untuk setiap jalur ISA yang didukung CPU.
+ */
+
+#ifndef VEXP_H
+#define VEXP_H
+
+#include <stddef.h>
+
+// Batas error terdokumentasi terhadap exp() libm (dalam ULP)
+#define VEXP_MAX_ULP 2.0
+
+/**
+ * JALUR INSTRUKSI YANG TERSEDIA
+ */
+typedef enum {
+    VEXP_ISA_SCALAR = 0,
+    VEXP_ISA_AVX2 = 1,
+    VEXP_ISA_AVX512 = 2
+} VexpIsa;
+
+/**
+ * Mengembalikan ISA terbaik yang didukung CPU saat ini (dideteksi sekali,
+ * lalu disimpan).
+ */
+VexpIsa vexp_detect_isa(void);
+
+/**
+ * Mengembalikan ISA yang sedang dipakai oleh vexp_array / vexp_fill_analytic.
+ * Default-nya adalah hasil vexp_detect_isa(). Aman dipanggil dari beberapa
+ * thread sekaligus tanpa inisialisasi di muka.
+ */
+VexpIsa vexp_active_isa(void);
+
+/**
+ * Memaksa pemakaian ISA tertentu (misalnya untuk benchmark). Jika CPU tidak
+ * mendukung ISA yang diminta, dipakai ISA terbaik yang didukung.
+ *
+ * @return VexpIsa - ISA yang benar-benar aktif setelah pemanggilan
+ */
+VexpIsa vexp_set_isa(VexpIsa isa);
+
+/**
+ * Nama ISA untuk ditampilkan ("scalar", "avx2", "avx512").
+ */
+const char* vexp_isa_name(VexpIsa isa);
+
+/**
+ * Menghitung y[i] = exp(x[i]) untuk i = 0..n-1 dengan ISA aktif.
+ */
+void vexp_array(const double* x, double* y, size_t n);
+
+/**
+ * Sama seperti vexp_array, tetapi dengan ISA yang ditentukan pemanggil
+ * (dipakai untuk verifikasi setiap jalur). ISA yang tidak didukung CPU
+ * diturunkan ke ISA terbaik yang didukung.
+ */
+void vexp_array_isa(VexpIsa isa, const double* x, double* y, size_t n);
+
+/**
+ * MENGISI KOLOM ANALITIK DAN ERROR DALAM SATU LINTASAN
+ * ====================================================
+ *
+ * Untuk setiap baris i:
+ *   N_analytical[i]    = N0 * exp(-lambda * time_s[i])
+ *   error_absolute[i]  = |N_numerical[i] - N_analytical[i]|
+ *   error_relative[i]  = error_absolute[i] / N_analytical[i] * 100  (0 jika N_analytical = 0)
+ *
+ * Setiap kolom diakses sebagai base[i * stride], sehingga fungsi ini bekerja
+ * untuk array-of-structs (stride = jumlah double per struct) maupun array
+ * kolom kontigu (stride = 1).
+ *
+ * @param N0              - Jumlah atom awal
+ * @param lambda          - Konstanta peluruhan (s⁻¹)
+ * @param time_s          - Kolom waktu (input)
+ * @param N_numerical     - Kolom hasil numerik (input)
+ * @param N_analytical    - Kolom hasil analitik (output)
+ * @param error_absolute  - Kolom error absolut (output)
+ * @param error_relative  - Kolom error relatif dalam persen (output)
+ * @param stride          - Jarak antar baris dalam satuan double
+ * @param n               - Jumlah baris
+ */
+void vexp_fill_analytic(
+    double N0, double lambda,
+    const double* time_s, const double* N_numerical,
+    double* N_analytical, double* error_absolute, double* error_relative,
+    size_t stride, size_t n
+);
+
+#endif // VEXP_H